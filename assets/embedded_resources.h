@@ -1,35 +0,0 @@
-#pragma once
-#include <cstddef>
-
-// Embedded sound files
-extern const unsigned char click_wav_data[];
-extern const size_t click_wav_data_size;
-
-extern const unsigned char bell_wav_data[];
-extern const size_t bell_wav_data_size;
-
-extern const unsigned char hydration_wav_data[];
-extern const size_t hydration_wav_data_size;
-
-extern const unsigned char walk_wav_data[];
-extern const size_t walk_wav_data_size;
-
-// Embedded font files
-extern const unsigned char roboto_medium_data[];
-extern const size_t roboto_medium_data_size;
-
-extern const unsigned char fontawesome_data[];
-extern const size_t fontawesome_data_size;
-
-extern const unsigned char formula1_bold_data[];
-extern const size_t formula1_bold_data_size;
-
-extern const unsigned char formula1_wide_data[];
-extern const size_t formula1_wide_data_size;
-
-extern const unsigned char formula1_regular_data[];
-extern const size_t formula1_regular_data_size;
-
-// Embedded app icon (PNG)
-extern const unsigned char app_icon_png_data[];
-extern const size_t app_icon_png_data_size;
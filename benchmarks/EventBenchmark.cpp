@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include "core/Event.h"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+namespace {
+// The previous Event: one tree node and one std::function per handler
+template <typename... Args>
+class MapEvent {
+  public:
+    using Handler = std::function<void(Args...)>;
+    using HandlerId = std::size_t;
+
+    HandlerId subscribe(Handler handler) {
+        const auto id = m_next_id++;
+        m_handlers[id] = std::move(handler);
+        return id;
+    }
+
+    void unsubscribe(HandlerId id) {
+        m_handlers.erase(id);
+    }
+
+    void emit(Args... args) const {
+        for (const auto& [id, handler] : m_handlers) {
+            if (handler) {
+                handler(args...);
+            }
+        }
+    }
+
+  private:
+    std::map<HandlerId, Handler> m_handlers;
+    HandlerId m_next_id = 0;
+};
+
+// Handlers capture two pointers, like the controller subscriptions in the app
+template <typename EventType>
+void subscribeCounters(EventType& event, std::vector<int>& counters, int count) {
+    counters.assign(static_cast<std::size_t>(count), 0);
+    for (int& counter : counters) {
+        int* sink = &counter;
+        [[maybe_unused]] const auto id = event.subscribe([sink, &counters](int value) {
+            *sink += value;
+            benchmark::DoNotOptimize(counters.data());
+        });
+    }
+}
+
+template <typename EventType>
+void runEmit(benchmark::State& state) {
+    EventType event;
+    std::vector<int> counters;
+    subscribeCounters(event, counters, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        event.emit(1);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename EventType>
+void runSubscribeUnsubscribe(benchmark::State& state) {
+    EventType event;
+    std::vector<int> counters;
+    subscribeCounters(event, counters, static_cast<int>(state.range(0)));
+    int received = 0;
+
+    for (auto _ : state) {
+        const auto id = event.subscribe([&received](int value) { received += value; });
+        event.unsubscribe(id);
+    }
+
+    benchmark::DoNotOptimize(received);
+}
+} // namespace
+
+// Baseline: std::map of std::function
+static void BM_EventEmitMap(benchmark::State& state) {
+    runEmit<MapEvent<int>>(state);
+}
+BENCHMARK(BM_EventEmitMap)->Arg(1)->Arg(8)->Arg(64);
+
+// Contiguous slots with inline callables
+static void BM_EventEmitFlat(benchmark::State& state) {
+    runEmit<Event<int>>(state);
+}
+BENCHMARK(BM_EventEmitFlat)->Arg(1)->Arg(8)->Arg(64);
+
+static void BM_EventSubscribeUnsubscribeMap(benchmark::State& state) {
+    runSubscribeUnsubscribe<MapEvent<int>>(state);
+}
+BENCHMARK(BM_EventSubscribeUnsubscribeMap)->Arg(1)->Arg(8)->Arg(64);
+
+static void BM_EventSubscribeUnsubscribeFlat(benchmark::State& state) {
+    runSubscribeUnsubscribe<Event<int>>(state);
+}
+BENCHMARK(BM_EventSubscribeUnsubscribeFlat)->Arg(1)->Arg(8)->Arg(64);
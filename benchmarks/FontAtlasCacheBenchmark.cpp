@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+#include "app/FontAtlasCache.h"
+
+#include <filesystem>
+
+using namespace WorkBalance::App;
+
+namespace {
+// Roughly the size of the app's atlas: a 120 px timer face plus smaller text and icon fonts
+constexpr int ATLAS_WIDTH = 2048;
+constexpr int ATLAS_HEIGHT = 1024;
+constexpr int GLYPHS_PER_FONT = 400;
+constexpr int FONT_COUNT = 4;
+
+[[nodiscard]] CachedFontAtlas makeAtlas() {
+    CachedFontAtlas atlas;
+    atlas.width = ATLAS_WIDTH;
+    atlas.height = ATLAS_HEIGHT;
+    atlas.pixels.resize(static_cast<size_t>(ATLAS_WIDTH) * ATLAS_HEIGHT);
+    for (size_t i = 0; i < atlas.pixels.size(); ++i) {
+        atlas.pixels[i] = static_cast<std::uint8_t>(i * 31U);
+    }
+    atlas.line_uvs.resize(64);
+    for (int font_index = 0; font_index < FONT_COUNT; ++font_index) {
+        CachedFont& font = atlas.fonts.emplace_back();
+        font.size = 18.0f;
+        for (int glyph = 0; glyph < GLYPHS_PER_FONT; ++glyph) {
+            font.glyphs.push_back(CachedGlyph{static_cast<std::uint32_t>(32 + glyph), CachedGlyph::FLAG_VISIBLE});
+        }
+    }
+    return atlas;
+}
+} // namespace
+
+// Warm-start path: read and validate the cached atlas instead of rasterizing the fonts
+static void BM_FontAtlasCacheLoad(benchmark::State& state) {
+    const auto path = std::filesystem::temp_directory_path() / "workbalance_bench" / FontAtlasCache::DEFAULT_FILENAME;
+    const FontAtlasCache cache(path);
+    constexpr std::uint64_t key = 1;
+    if (!cache.save(key, makeAtlas()).has_value()) {
+        state.SkipWithError("Failed to write font cache");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto atlas = cache.load(key);
+        if (!atlas.has_value()) {
+            state.SkipWithError("Failed to load font cache");
+            break;
+        }
+        benchmark::DoNotOptimize(atlas->pixels.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+    std::filesystem::remove_all(path.parent_path());
+}
+BENCHMARK(BM_FontAtlasCacheLoad)->Unit(benchmark::kMillisecond);
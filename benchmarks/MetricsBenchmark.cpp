@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include "core/Metrics.h"
+
+#include <cstdint>
+
+using namespace WorkBalance::Core;
+
+// Budget for any of these: 20 ns per sample
+
+static void BM_CounterIncrement(benchmark::State& state) {
+    Counter counter;
+    for (auto _ : state) {
+        counter.increment();
+    }
+    benchmark::DoNotOptimize(counter.value());
+}
+BENCHMARK(BM_CounterIncrement)->Threads(1)->Threads(4);
+
+static void BM_GaugeSet(benchmark::State& state) {
+    Gauge gauge;
+    double value = 0.0;
+    for (auto _ : state) {
+        gauge.set(value);
+        value += 1.0;
+    }
+    benchmark::DoNotOptimize(gauge.value());
+}
+BENCHMARK(BM_GaugeSet);
+
+static void BM_HistogramRecord(benchmark::State& state) {
+    Histogram histogram;
+    // Spread over many buckets, like frame times that vary from microseconds to milliseconds
+    std::uint64_t value = 1;
+    for (auto _ : state) {
+        histogram.record(value);
+        value = (value * 2862933555777941757ULL + 3037000493ULL) >> 40;
+    }
+    benchmark::DoNotOptimize(histogram.snapshot().count);
+}
+BENCHMARK(BM_HistogramRecord)->Threads(1)->Threads(4);
+
+// Includes the two steady_clock reads, which dominate
+static void BM_ScopedLatency(benchmark::State& state) {
+    Histogram histogram;
+    for (auto _ : state) {
+        const ScopedLatency latency{&histogram};
+    }
+    benchmark::DoNotOptimize(histogram.snapshot().count);
+}
+BENCHMARK(BM_ScopedLatency);
@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+#include "core/Observable.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+namespace {
+constexpr int INPUT_COUNT = 16;
+constexpr int DERIVED_COUNT = 1000;
+constexpr int CHANGES_PER_BATCH = 8;
+constexpr int READS_PER_BATCH = 10;
+
+// The previous ComputedObservable: computed in the constructor, recomputed by update()
+template <typename T>
+class EagerComputed {
+  public:
+    explicit EagerComputed(std::function<T()> compute) : m_compute(std::move(compute)), m_value(m_compute()) {
+    }
+
+    [[nodiscard]] const T& get() const noexcept {
+        return m_value;
+    }
+
+    void update() {
+        T new_value = m_compute();
+        if (m_value != new_value) {
+            const T old_value = std::exchange(m_value, std::move(new_value));
+            for (const auto& observer : m_observers) {
+                observer(old_value, m_value);
+            }
+        }
+    }
+
+    void observe(std::function<void(const T&, const T&)> observer) {
+        m_observers.push_back(std::move(observer));
+    }
+
+  private:
+    std::function<T()> m_compute;
+    T m_value;
+    std::vector<std::function<void(const T&, const T&)>> m_observers;
+};
+
+// 1k derived values, each summing two of the inputs
+struct Graph {
+    std::vector<std::unique_ptr<Observable<int>>> inputs;
+    std::vector<std::unique_ptr<ComputedObservable<int>>> derived;
+    std::vector<std::unique_ptr<EagerComputed<int>>> eager;
+
+    Graph() {
+        for (int i = 0; i < INPUT_COUNT; ++i) {
+            inputs.push_back(std::make_unique<Observable<int>>(i));
+        }
+        for (int i = 0; i < DERIVED_COUNT; ++i) {
+            const Observable<int>& a = input(i);
+            const Observable<int>& b = input(i * 7 + 3);
+            derived.push_back(std::make_unique<ComputedObservable<int>>([&a, &b] { return a.get() + b.get(); }));
+            eager.push_back(std::make_unique<EagerComputed<int>>([&a, &b] { return a.get() + b.get(); }));
+        }
+    }
+
+    [[nodiscard]] Observable<int>& input(int index) {
+        return *inputs[static_cast<std::size_t>(index % INPUT_COUNT)];
+    }
+};
+
+void changeInputs(Graph& graph, int round) {
+    for (int i = 0; i < CHANGES_PER_BATCH; ++i) {
+        graph.input(i).set(round + i);
+    }
+}
+} // namespace
+
+// Baseline: every input change is followed by updating the whole graph by hand
+static void BM_ObservableGraphEagerUpdate(benchmark::State& state) {
+    Graph graph;
+    int round = 0;
+    int sum = 0;
+
+    for (auto _ : state) {
+        changeInputs(graph, ++round);
+        for (auto& value : graph.eager) {
+            value->update();
+        }
+        for (int i = 0; i < READS_PER_BATCH; ++i) {
+            sum += graph.eager[static_cast<std::size_t>(i * 97)]->get();
+        }
+    }
+
+    benchmark::DoNotOptimize(sum);
+}
+BENCHMARK(BM_ObservableGraphEagerUpdate);
+
+// Lazy: changes mark dependents stale, only the values read are recomputed
+static void BM_ObservableGraphLazyRead(benchmark::State& state) {
+    Graph graph;
+    for (auto& value : graph.derived) {
+        benchmark::DoNotOptimize(value->get());
+    }
+    int round = 0;
+    int sum = 0;
+
+    for (auto _ : state) {
+        changeInputs(graph, ++round);
+        for (int i = 0; i < READS_PER_BATCH; ++i) {
+            sum += graph.derived[static_cast<std::size_t>(i * 97)]->get();
+        }
+    }
+
+    benchmark::DoNotOptimize(sum);
+}
+BENCHMARK(BM_ObservableGraphLazyRead);
+
+// Every derived value observed: without a transaction each input change notifies on its own
+static void BM_ObservableGraphObservedPerSet(benchmark::State& state) {
+    Graph graph;
+    std::size_t notifications = 0;
+    for (auto& value : graph.derived) {
+        value->observe([&notifications](int, int) { ++notifications; });
+    }
+    int round = 0;
+
+    for (auto _ : state) {
+        changeInputs(graph, ++round);
+    }
+
+    state.counters["notifications_per_batch"] =
+        static_cast<double>(notifications) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_ObservableGraphObservedPerSet);
+
+// Same changes in one transaction: each derived value is recomputed and reported once
+static void BM_ObservableGraphObservedTransaction(benchmark::State& state) {
+    Graph graph;
+    std::size_t notifications = 0;
+    for (auto& value : graph.derived) {
+        value->observe([&notifications](int, int) { ++notifications; });
+    }
+    int round = 0;
+
+    for (auto _ : state) {
+        const ObservableTransaction transaction;
+        changeInputs(graph, ++round);
+    }
+
+    state.counters["notifications_per_batch"] =
+        static_cast<double>(notifications) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_ObservableGraphObservedTransaction);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+#include "core/Persistence.h"
+#include "core/Task.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+namespace {
+constexpr int TASK_COUNT = 100'000;
+
+[[nodiscard]] std::string makeTaskName(int index) {
+    // Mix of short repeated names (interned) and longer unique ones
+    if (index % 4 == 0) {
+        return "Code review";
+    }
+    return "Task #" + std::to_string(index) + " - implement the feature and write the tests";
+}
+
+[[nodiscard]] PersistentData makeData(int count) {
+    PersistentData data;
+    data.tasks.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        data.tasks.push_back(Task{data.task_names.intern(makeTaskName(i)), i % 3 == 0, 4, i % 5});
+    }
+    return data;
+}
+
+[[nodiscard]] size_t ownedStringBytes(const std::vector<std::string>& names) {
+    size_t bytes = names.capacity() * sizeof(std::string);
+    for (const auto& name : names) {
+        // Strings beyond the SSO buffer own a separate heap block
+        if (name.capacity() > std::string{}.capacity()) {
+            bytes += name.capacity() + 1;
+        }
+    }
+    return bytes;
+}
+} // namespace
+
+// Baseline: one heap string per task, copied in one at a time
+static void BM_LoadTasksPerStringCopy(benchmark::State& state) {
+    const PersistentData data = makeData(static_cast<int>(state.range(0)));
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        std::vector<std::string> names;
+        names.reserve(data.tasks.size());
+        for (const auto& task : data.tasks) {
+            names.emplace_back(task.name);
+        }
+        bytes = ownedStringBytes(names);
+        benchmark::DoNotOptimize(names.data());
+    }
+
+    state.counters["name_bytes"] = static_cast<double>(bytes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadTasksPerStringCopy)->Arg(TASK_COUNT)->Unit(benchmark::kMillisecond);
+
+// Arena: the task vector and name pool move into TaskManager wholesale
+static void BM_LoadTasksAdoptArena(benchmark::State& state) {
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        PersistentData data = makeData(static_cast<int>(state.range(0)));
+        TaskManager manager;
+        state.ResumeTiming();
+
+        manager.adoptTasks(std::move(data.tasks), std::move(data.task_names));
+        bytes = manager.getNamePool().bytesReserved();
+        benchmark::DoNotOptimize(manager.getTasks().data());
+    }
+
+    state.counters["name_bytes"] = static_cast<double>(bytes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadTasksAdoptArena)->Arg(TASK_COUNT)->Unit(benchmark::kMillisecond);
+
+// End to end: parse the JSON file and adopt the result
+static void BM_PersistenceLoadTasks(benchmark::State& state) {
+    const auto directory = std::filesystem::temp_directory_path() / "workbalance_bench";
+    std::filesystem::create_directories(directory);
+    const PersistenceManager persistence(directory);
+    if (!persistence.save(makeData(static_cast<int>(state.range(0)))).has_value()) {
+        state.SkipWithError("Failed to write benchmark data");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto loaded = persistence.load();
+        if (!loaded.has_value()) {
+            state.SkipWithError("Failed to load benchmark data");
+            break;
+        }
+        TaskManager manager;
+        manager.adoptTasks(std::move(loaded->tasks), std::move(loaded->task_names));
+        benchmark::DoNotOptimize(manager.getTasks().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(BM_PersistenceLoadTasks)->Arg(TASK_COUNT)->Unit(benchmark::kMillisecond)->Iterations(1);
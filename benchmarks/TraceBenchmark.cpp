@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+#include "core/Trace.h"
+
+using namespace WorkBalance::Core;
+
+// Every zone in the main loop pays this even when nobody is tracing
+static void BM_TraceZoneDisabled(benchmark::State& state) {
+    Tracer tracer;
+    for (auto _ : state) {
+        const TraceZone zone{"zone", tracer};
+    }
+}
+BENCHMARK(BM_TraceZoneDisabled);
+
+// Includes the two steady_clock reads, which dominate
+static void BM_TraceZoneEnabled(benchmark::State& state) {
+    static Tracer tracer;
+    tracer.setEnabled(true);
+    for (auto _ : state) {
+        const TraceZone zone{"zone", tracer};
+    }
+}
+BENCHMARK(BM_TraceZoneEnabled)->Threads(1)->Threads(4);
+
+static void BM_TraceExport(benchmark::State& state) {
+    Tracer tracer;
+    tracer.setEnabled(true);
+    for (std::size_t i = 0; i < Tracer::DEFAULT_EVENTS_PER_THREAD; ++i) {
+        tracer.record("zone", Tracer::Clock::now(), Tracer::Clock::now());
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tracer.toChromeTraceJson());
+    }
+}
+BENCHMARK(BM_TraceExport)->Unit(benchmark::kMillisecond);
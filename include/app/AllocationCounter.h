@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace WorkBalance::App {
+
+/// @brief Counts heap allocations made through operator new in this process
+///
+/// AllocationCounter.cpp replaces the global operator new and delete, so it is linked into the
+/// GUI application and the tests, never into WorkBalanceCore. Allocations that go straight to
+/// malloc (such as ImGui's own) are not counted.
+class AllocationCounter {
+  public:
+    /// @brief Allocations since process start, from every thread
+    [[nodiscard]] static std::uint64_t allocations() noexcept;
+};
+
+} // namespace WorkBalance::App
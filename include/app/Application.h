@@ -2,11 +2,20 @@
 
 #include <memory>
 
+namespace WorkBalance::System {
+class SingleInstance;
+} // namespace WorkBalance::System
+
 namespace WorkBalance::App {
+class StartupProfiler;
+
 class Application {
   public:
     /// @param launched_at_startup Set to true when app is auto-started by Windows (via --startup flag)
-    explicit Application(bool launched_at_startup = false);
+    /// @param profiler Receives startup phase timings and prints them after the first frame; may be null
+    /// @param instance Answers commands forwarded by later launches from the main loop; may be null
+    explicit Application(bool launched_at_startup = false, StartupProfiler* profiler = nullptr,
+                         System::SingleInstance* instance = nullptr);
     ~Application();
 
     Application(Application&&) noexcept = default;
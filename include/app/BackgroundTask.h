@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace WorkBalance::App {
+
+/// @brief Runs one job on its own thread and hands its result to whoever joins it
+///
+/// Meant for startup work that does not need the main thread: the job starts on
+/// construction and get() blocks until it has finished. Exceptions thrown by the job are
+/// rethrown from get(). If no thread can be started, the job runs inside get() instead.
+template <typename T>
+class BackgroundTask {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    template <typename Function>
+        requires std::is_invocable_r_v<T, Function&>
+    explicit BackgroundTask(Function function) : m_future(start(std::move(function))) {
+    }
+
+    BackgroundTask(const BackgroundTask&) = delete;
+    BackgroundTask& operator=(const BackgroundTask&) = delete;
+    BackgroundTask(BackgroundTask&&) = delete;
+    BackgroundTask& operator=(BackgroundTask&&) = delete;
+
+    /// @brief Waits for the job and takes its result; may only be called once
+    [[nodiscard]] T get() {
+        Completed completed = m_future.get();
+        m_duration_ms = completed.duration_ms;
+        return std::move(completed.value);
+    }
+
+    /// @brief How long the job itself ran, excluding time spent waiting to be joined
+    /// @return The duration once get() has returned, otherwise nullopt
+    [[nodiscard]] std::optional<double> durationMs() const noexcept {
+        return m_duration_ms;
+    }
+
+  private:
+    struct Completed {
+        T value;
+        double duration_ms = 0.0;
+    };
+
+    template <typename Function>
+    static std::future<Completed> start(Function function) {
+        auto job = [function = std::move(function)]() mutable {
+            const auto started = Clock::now();
+            T value = function();
+            const std::chrono::duration<double, std::milli> elapsed = Clock::now() - started;
+            return Completed{std::move(value), elapsed.count()};
+        };
+
+        try {
+            return std::async(std::launch::async, job);
+        } catch (const std::system_error&) {
+            return std::async(std::launch::deferred, std::move(job));
+        }
+    }
+
+    std::future<Completed> m_future;
+    std::optional<double> m_duration_ms;
+};
+
+} // namespace WorkBalance::App
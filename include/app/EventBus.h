@@ -0,0 +1,79 @@
+#pragma once
+
+#include <app/ApplicationEvents.h>
+#include <core/MpscQueue.h>
+#include <core/Timer.h>
+#include <core/WellnessTypes.h>
+
+#include <atomic>
+#include <cstddef>
+#include <variant>
+
+namespace WorkBalance::App {
+
+/// @brief A timer finished on a worker thread
+struct TimerCompletedMessage {
+    Core::TimerMode mode;
+};
+
+/// @brief A wellness reminder fired on a worker thread
+struct WellnessTimerCompletedMessage {
+    Core::WellnessType type;
+};
+
+/// @brief Tasks were changed outside the UI thread (e.g. by a sync job)
+struct TasksChangedMessage {};
+
+/// @brief Something outside the UI thread asked the application to quit
+struct CloseRequestedMessage {};
+
+using EventBusMessage =
+    std::variant<TimerCompletedMessage, WellnessTimerCompletedMessage, TasksChangedMessage, CloseRequestedMessage>;
+
+/// @brief Hands events from worker threads to the UI thread without locking
+///
+/// ApplicationEvents handlers run on the UI thread and are not thread-safe, so other threads
+/// post() a message instead of emitting directly. The main loop calls dispatch() once per
+/// iteration to emit everything posted since. post() never blocks and never allocates; it
+/// wakes the main loop through the wake callback so a message is not left waiting for the
+/// next frame timeout.
+///
+/// Example usage:
+/// @code
+/// EventBus bus;
+/// bus.setWakeCallback(glfwPostEmptyEvent);
+/// std::jthread worker([&] { (void)bus.post(TimerCompletedMessage{Core::TimerMode::Pomodoro}); });
+/// bus.dispatch(events);  // on the UI thread: emits events.onTimerComplete
+/// @endcode
+class EventBus {
+  public:
+    using WakeCallback = void (*)();
+
+    /// Messages posted while the UI thread is busy; more than this many between frames are dropped
+    static constexpr std::size_t CAPACITY = 256;
+
+    /// @brief Sets the function post() calls to wake the UI thread; it must be callable from any thread
+    /// Call before worker threads start posting
+    void setWakeCallback(WakeCallback wake) noexcept {
+        m_wake.store(wake, std::memory_order_release);
+    }
+
+    /// @brief Queues a message for the UI thread; safe to call from any thread
+    /// @return false if the queue was full and the message was dropped
+    [[nodiscard]] bool post(const EventBusMessage& message) noexcept;
+
+    /// @brief Emits every queued message on @p events; call from the UI thread only
+    /// @return Number of messages dispatched
+    std::size_t dispatch(ApplicationEvents& events);
+
+    /// @brief True if dispatch() has something to emit; call from the UI thread only
+    [[nodiscard]] bool hasPending() const noexcept {
+        return m_queue.hasItems();
+    }
+
+  private:
+    Core::MpscQueue<EventBusMessage, CAPACITY> m_queue;
+    std::atomic<WakeCallback> m_wake{nullptr};
+};
+
+} // namespace WorkBalance::App
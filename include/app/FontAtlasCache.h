@@ -0,0 +1,88 @@
+#pragma once
+
+#include <core/Persistence.h>
+
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace WorkBalance::App {
+
+/// @brief A baked glyph, mirroring the public fields of ImFontGlyph
+struct CachedGlyph {
+    static constexpr std::uint32_t FLAG_COLORED = 1U << 0U;
+    static constexpr std::uint32_t FLAG_VISIBLE = 1U << 1U;
+
+    std::uint32_t codepoint = 0;
+    std::uint32_t flags = 0;
+    float advance_x = 0.0f;
+    float x0 = 0.0f;
+    float y0 = 0.0f;
+    float x1 = 0.0f;
+    float y1 = 0.0f;
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 0.0f;
+    float v1 = 0.0f;
+};
+
+/// @brief Metrics and glyph table of one font in the atlas
+struct CachedFont {
+    float size = 0.0f;
+    float ascent = 0.0f;
+    float descent = 0.0f;
+    std::uint32_t ellipsis_char = 0; ///< Glyph drawn for elided text
+    std::uint32_t fallback_char = 0; ///< Glyph drawn for codepoints the font lacks
+    std::vector<CachedGlyph> glyphs;
+};
+
+/// @brief Everything ImFontAtlas::Build() produces that rendering depends on
+struct CachedFontAtlas {
+    std::int32_t width = 0;
+    std::int32_t height = 0;
+    std::vector<std::uint8_t> pixels; ///< Alpha8, width * height bytes
+    std::array<float, 2> white_pixel_uv{};
+    std::vector<std::array<float, 4>> line_uvs;
+    std::vector<CachedFont> fonts;
+};
+
+/// @brief Stores a baked font atlas on disk so later launches can skip rasterization
+///
+/// The file is tagged with a caller-supplied key that hashes every build input (font data,
+/// sizes, glyph ranges, ImGui version). A file written for another key, or one that is
+/// truncated or corrupted, is rejected and the caller falls back to a full build.
+class FontAtlasCache {
+  public:
+    static constexpr std::string_view DEFAULT_FILENAME = "workbalance_fonts.cache";
+
+    explicit FontAtlasCache(std::filesystem::path path);
+
+    /// @brief Cache file for fonts baked at a UI scale, one per scale
+    /// @details Keeps monitors of different DPI from overwriting each other's atlas, so moving a
+    /// window back and forth between them rasterizes each scale only once. Scale 1 keeps
+    /// DEFAULT_FILENAME.
+    /// @param directory Directory holding the cache files
+    /// @param scale Quantized UI scale from Core::DisplayLayout
+    [[nodiscard]] static std::filesystem::path pathForScale(const std::filesystem::path& directory, float scale);
+
+    /// @brief Reads the cached atlas
+    /// @param key Hash of the inputs the atlas has to match
+    /// @return The atlas, or CacheMismatch when the file was built from other inputs
+    [[nodiscard]] std::expected<CachedFontAtlas, Core::PersistenceError> load(std::uint64_t key) const;
+
+    /// @brief Replaces the cache file with the given atlas
+    [[nodiscard]] std::expected<void, Core::PersistenceError> save(std::uint64_t key,
+                                                                   const CachedFontAtlas& atlas) const;
+
+    [[nodiscard]] const std::filesystem::path& getPath() const noexcept {
+        return m_path;
+    }
+
+  private:
+    std::filesystem::path m_path;
+};
+
+} // namespace WorkBalance::App
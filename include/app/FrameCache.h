@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace WorkBalance::App {
+
+/// @brief Incremental 64-bit FNV-1a hash over everything a frame reads
+///
+/// Used to detect frames whose inputs are identical to the previous one.
+class FrameSignature {
+  public:
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    FrameSignature& add(const T& value) noexcept {
+        addBytes(&value, sizeof(T));
+        return *this;
+    }
+
+    FrameSignature& add(std::string_view text) noexcept {
+        addBytes(text.data(), text.size());
+        return *this;
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept {
+        return m_hash;
+    }
+
+  private:
+    void addBytes(const void* data, std::size_t size) noexcept {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            m_hash = (m_hash ^ bytes[i]) * FNV_PRIME;
+        }
+    }
+
+    static constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    static constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+    std::uint64_t m_hash = FNV_OFFSET_BASIS;
+};
+
+/// @brief Decides whether a frame has to be rebuilt, can re-submit the last draw data, or can be skipped
+///
+/// A frame is rebuilt when its signature changes, when the caller forces it (pending input,
+/// animation) and for a few settle frames afterwards so hover and popup state can catch up.
+/// Otherwise the previous frame is still on screen: nothing is drawn unless the window
+/// contents were damaged, in which case the cached draw data is presented again.
+class FrameCache {
+  public:
+    enum class Action : std::uint8_t {
+        Build, ///< Run NewFrame, build widgets, render and present
+        Reuse, ///< Present the previous draw data without rebuilding widgets
+        Skip   ///< The presented frame is still valid - do nothing
+    };
+
+    struct Stats {
+        std::uint64_t frames_built = 0;
+        std::uint64_t frames_reused = 0;
+        std::uint64_t frames_skipped = 0;
+    };
+
+    /// @brief Extra frames built after the last change so ImGui's one-frame-late state settles
+    static constexpr int SETTLE_FRAMES = 2;
+
+    /// @brief Choose how to produce the next frame
+    /// @param signature Hash of the state the frame is built from
+    /// @param force_build Rebuild even if the signature is unchanged
+    [[nodiscard]] Action beginFrame(std::uint64_t signature, bool force_build) noexcept;
+
+    /// @brief The window contents were lost (expose/refresh); present again on the next frame
+    void invalidateFramebuffer() noexcept {
+        m_framebuffer_damaged = true;
+    }
+
+    /// @brief The last draw data was replaced by another NewFrame and cannot be re-submitted
+    void invalidateDrawData() noexcept {
+        m_draw_data_valid = false;
+    }
+
+    /// @brief Force the next frame to be rebuilt
+    void invalidate() noexcept {
+        m_has_frame = false;
+    }
+
+    [[nodiscard]] const Stats& getStats() const noexcept {
+        return m_stats;
+    }
+
+  private:
+    Stats m_stats;
+    std::uint64_t m_last_signature = 0;
+    int m_settle_frames = 0;
+    bool m_has_frame = false;
+    bool m_draw_data_valid = false;
+    bool m_framebuffer_damaged = false;
+};
+
+} // namespace WorkBalance::App
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <app/FrameCache.h>
+
+namespace WorkBalance::App {
+
+/// @brief Per-frame timings of the main loop, kept for the last HISTORY frames
+///
+/// The loop brackets each frame with beginFrame()/endFrame() and times its stages with
+/// ScopedStage. Samples live in fixed arrays, so neither recording nor reading allocates,
+/// and the performance HUD can draw from them without showing up in its own numbers.
+class FrameProfiler {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Stage : std::uint8_t {
+        Poll,    ///< Window events, event bus, tray and remote commands
+        Update,  ///< Timers, wellness timers and tray state
+        BuildUi, ///< ImGui NewFrame and widget building
+        Render,  ///< Clearing and submitting ImGui draw data
+        Swap,    ///< Presenting the main window
+        Overlay  ///< Updating, building and presenting the timer overlay
+    };
+
+    static constexpr std::size_t STAGE_COUNT = 6;
+    static constexpr std::array<const char*, STAGE_COUNT> STAGE_NAMES{"Poll",   "Update", "Build UI",
+                                                                      "Render", "Swap",   "Overlay"};
+
+    /// About 1.8 seconds at the target frame rate
+    static constexpr std::size_t HISTORY = 256;
+
+    struct Sample {
+        float interval_ms = 0.0f; ///< Since the previous frame began; what the user perceives
+        float idle_ms = 0.0f;     ///< Waiting between the previous frame's end and this one's start
+        float cpu_ms = 0.0f;      ///< From beginFrame() to endFrame()
+        std::array<float, STAGE_COUNT> stage_ms{};
+        std::uint32_t draw_calls = 0;
+        std::uint32_t vertices = 0;
+        std::uint64_t allocations = 0;
+        FrameCache::Action action = FrameCache::Action::Skip;
+    };
+
+    struct Summary {
+        float average_interval_ms = 0.0f;
+        float max_interval_ms = 0.0f;
+        float average_cpu_ms = 0.0f;
+        std::array<float, STAGE_COUNT> average_stage_ms{};
+    };
+
+    /// @brief Times the enclosing scope and adds it to a stage of the current frame
+    class ScopedStage {
+      public:
+        ScopedStage(FrameProfiler& profiler, Stage stage) noexcept
+            : m_profiler(profiler), m_stage(stage), m_start(Clock::now()) {
+        }
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+
+        ~ScopedStage() {
+            m_profiler.addStageTime(m_stage, Clock::now() - m_start);
+        }
+
+      private:
+        FrameProfiler& m_profiler;
+        Stage m_stage;
+        Clock::time_point m_start;
+    };
+
+    /// @brief Starts a frame
+    /// @param allocations Process-wide heap allocation count at the start of the frame
+    void beginFrame(Clock::time_point now, std::uint64_t allocations) noexcept;
+
+    /// @brief Finishes the frame and stores it as the latest sample
+    void endFrame(Clock::time_point now, std::uint64_t allocations) noexcept;
+
+    void addStageTime(Stage stage, Clock::duration duration) noexcept;
+
+    /// @brief Records what was submitted for the main window this frame
+    void setDrawStats(std::uint32_t draw_calls, std::uint32_t vertices) noexcept {
+        m_current.draw_calls = draw_calls;
+        m_current.vertices = vertices;
+    }
+
+    /// @brief Records how the frame cache produced this frame
+    void setAction(FrameCache::Action action) noexcept {
+        m_current.action = action;
+    }
+
+    /// @brief Number of completed frames stored, at most HISTORY
+    [[nodiscard]] std::size_t size() const noexcept {
+        return m_count;
+    }
+
+    /// @brief The most recent completed frame; only valid when size() > 0
+    [[nodiscard]] const Sample& latest() const noexcept {
+        return m_samples[(m_next + HISTORY - 1) % HISTORY];
+    }
+
+    /// @brief Frame intervals in ring order, for ImGui::PlotLines with historyOffset()
+    [[nodiscard]] const std::array<float, HISTORY>& intervalHistory() const noexcept {
+        return m_intervals_ms;
+    }
+
+    /// @brief Index of the oldest entry in intervalHistory()
+    [[nodiscard]] std::size_t historyOffset() const noexcept {
+        return m_count < HISTORY ? 0 : m_next;
+    }
+
+    /// @brief Averages and worst case over the stored frames
+    [[nodiscard]] Summary summarize() const noexcept;
+
+  private:
+    std::array<Sample, HISTORY> m_samples{};
+    std::array<float, HISTORY> m_intervals_ms{};
+    std::size_t m_next = 0;
+    std::size_t m_count = 0;
+
+    Sample m_current;
+    Clock::time_point m_frame_start{};
+    Clock::time_point m_previous_start{};
+    Clock::time_point m_previous_end{};
+    std::uint64_t m_allocations_at_start = 0;
+    bool m_has_previous = false;
+};
+
+} // namespace WorkBalance::App
@@ -2,12 +2,86 @@
 
 #include <imgui.h>
 
+#include <filesystem>
+#include <memory>
+#include <vector>
+
 struct GLFWwindow;
 
 namespace WorkBalance::App {
+/// @brief Deep copy of a rendered frame's draw lists
+///
+/// ImGui owns a single ImDrawData that every Render() overwrites. A snapshot keeps a window's
+/// last frame around so it can be presented again after other windows have built frames.
+class DrawDataSnapshot {
+  public:
+    DrawDataSnapshot() = default;
+    ~DrawDataSnapshot();
+
+    DrawDataSnapshot(const DrawDataSnapshot&) = delete;
+    DrawDataSnapshot& operator=(const DrawDataSnapshot&) = delete;
+    DrawDataSnapshot(DrawDataSnapshot&&) = delete;
+    DrawDataSnapshot& operator=(DrawDataSnapshot&&) = delete;
+
+    /// @brief Replace the snapshot with a copy of the given draw data
+    void capture(const ImDrawData* draw_data);
+
+    /// @brief Submit the captured draw lists to the renderer backend
+    void render();
+
+    void clear() noexcept;
+
+    [[nodiscard]] bool empty() const noexcept {
+        return m_lists.empty();
+    }
+
+  private:
+    std::vector<ImDrawList*> m_lists;
+    ImDrawData m_draw_data;
+};
+
 class ImGuiLayer {
   public:
-    explicit ImGuiLayer(GLFWwindow* window);
+    /// @brief How the font atlas was produced at startup
+    struct FontLoadStats {
+        double milliseconds = 0.0;
+        bool from_cache = false;
+        size_t texture_bytes = 0; ///< GPU memory of the uploaded atlas texture
+    };
+
+    /// @brief A baked font atlas and the faces in it, built without an ImGui context
+    ///
+    /// Rasterizing (or reading the cache) touches neither ImGui's context nor OpenGL, so it can
+    /// run on any thread. The texture upload happens later, on the first frame.
+    struct Fonts {
+        ImFontAtlas atlas;
+        ImFont* large = nullptr;
+        ImFont* timer = nullptr;
+        ImFont* button = nullptr;
+        ImFont* overlay = nullptr;
+        // Glyph subsets the atlas points into; they must outlive every atlas build
+        ImVector<ImWchar> icon_glyphs;
+        ImVector<ImWchar> timer_glyphs;
+        ImVector<ImWchar> button_glyphs;
+        ImVector<ImWchar> overlay_glyphs;
+        ImVector<ImWchar> overlay_icon_glyphs;
+        FontLoadStats stats;
+        float scale = 1.0f; ///< UI scale the faces were baked for
+    };
+
+    /// @brief Build the application's fonts
+    /// @param font_cache_path Baked font atlas cache; an empty path always rasterizes the fonts
+    /// @param scale UI scale from Core::DisplayLayout; every face is baked at its size times this
+    [[nodiscard]] static std::unique_ptr<Fonts> loadFonts(const std::filesystem::path& font_cache_path,
+                                                          float scale = 1.0f);
+
+    /// @param window Window to attach the GLFW and OpenGL backends to, or nullptr for none
+    /// @param font_cache_path Baked font atlas cache; an empty path always rasterizes the fonts
+    explicit ImGuiLayer(GLFWwindow* window, const std::filesystem::path& font_cache_path = {});
+
+    /// @param window Window to attach the GLFW and OpenGL backends to, or nullptr for none
+    /// @param fonts Fonts from loadFonts(), possibly built on another thread
+    ImGuiLayer(GLFWwindow* window, std::unique_ptr<Fonts> fonts);
     ~ImGuiLayer();
 
     ImGuiLayer(const ImGuiLayer&) = delete;
@@ -18,29 +92,43 @@ class ImGuiLayer {
     static void newFrame();
     static void render();
 
+    /// @brief Draw the draw data from the last render() again without rebuilding the UI
+    static void renderCachedDrawData();
+
     [[nodiscard]] ImFont* largeFont() const noexcept {
-        return m_large_font;
+        return m_fonts->large;
     }
     [[nodiscard]] ImFont* timerFont() const noexcept {
-        return m_timer_font;
+        return m_fonts->timer;
     }
     [[nodiscard]] ImFont* buttonFont() const noexcept {
-        return m_button_font;
+        return m_fonts->button;
     }
     [[nodiscard]] ImFont* overlayFont() const noexcept {
-        return m_overlay_font;
+        return m_fonts->overlay;
     }
 
+    [[nodiscard]] const FontLoadStats& fontLoadStats() const noexcept {
+        return m_fonts->stats;
+    }
+
+    [[nodiscard]] float fontScale() const noexcept {
+        return m_fonts->scale;
+    }
+
+    /// @brief Replaces the fonts and rescales the style to match, e.g. after a DPI change
+    /// @details Call between frames with the GL context current. Draw data rendered earlier
+    /// refers to the old atlas texture and must not be presented again.
+    void setFonts(std::unique_ptr<Fonts> fonts);
+
   private:
-    void loadFonts(ImGuiIO& io);
-    static void applyStyle();
+    static void buildFontAtlas(Fonts& fonts, const std::filesystem::path& font_cache_path);
+    static void applyStyle(float scale);
 
     bool m_initialized = false;
     bool m_owns_backends = false;
-    ImFont* m_large_font = nullptr;
-    ImFont* m_timer_font = nullptr;
-    ImFont* m_button_font = nullptr;
-    ImFont* m_overlay_font = nullptr;
+    // Shared with the ImGui context, which does not own it: destroyed after the context
+    std::unique_ptr<Fonts> m_fonts;
 };
 
 } // namespace WorkBalance::App
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WorkBalance::App {
+
+/// @brief Times the consecutive phases of application startup
+///
+/// Phases are laps: each lap() closes the phase that began at the previous lap (or at
+/// construction) and names it. The report is a single JSON object suitable for scripts.
+class StartupProfiler {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase {
+        std::string name;
+        double start_ms = 0.0;
+        double duration_ms = 0.0;
+    };
+
+    struct Value {
+        std::string name;
+        double value = 0.0;
+    };
+
+    /// @brief Marks a phase boundary while class members are being constructed
+    ///
+    /// Placed between members, it times the construction of the members declared before it.
+    struct Checkpoint {
+        Checkpoint(StartupProfiler* profiler, std::string_view name) {
+            if (profiler != nullptr) {
+                profiler->lap(name);
+            }
+        }
+    };
+
+    explicit StartupProfiler(Clock::time_point origin = Clock::now());
+
+    /// @brief Ends the current phase and starts the next one
+    void lap(std::string_view name);
+    void lap(std::string_view name, Clock::time_point now);
+
+    /// @brief Attaches a named number (cache hits, sizes) to the report
+    void addValue(std::string_view name, double value);
+
+    /// @brief Records the time the first frame was presented; later calls are ignored
+    void markFirstFrame();
+    void markFirstFrame(Clock::time_point now);
+
+    [[nodiscard]] const std::vector<Phase>& getPhases() const noexcept {
+        return m_phases;
+    }
+
+    [[nodiscard]] std::optional<double> getTimeToFirstFrame() const noexcept {
+        return m_first_frame_ms;
+    }
+
+    /// @brief Phase breakdown, values and time-to-first-frame as a single-line JSON object
+    [[nodiscard]] std::string toJson() const;
+
+  private:
+    [[nodiscard]] double millisecondsSinceOrigin(Clock::time_point time) const;
+
+    Clock::time_point m_origin;
+    Clock::time_point m_last_lap;
+    std::vector<Phase> m_phases;
+    std::vector<Value> m_values;
+    std::optional<double> m_first_frame_ms;
+};
+
+} // namespace WorkBalance::App
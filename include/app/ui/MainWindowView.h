@@ -4,11 +4,13 @@
 #include <memory>
 #include <string_view>
 
+#include <app/FrameProfiler.h>
 #include <app/ImGuiLayer.h>
 #include <app/ui/callbacks/SettingsCallbacks.h>
 #include <app/ui/callbacks/TaskCallbacks.h>
 #include <app/ui/callbacks/TimerCallbacks.h>
 #include <app/ui/callbacks/WindowCallbacks.h>
+#include <app/ui/components/PerformanceHud.h>
 #include <app/ui/components/SettingsPopup.h>
 #include <app/ui/components/TaskListPanel.h>
 #include <app/ui/components/TimerPanel.h>
@@ -43,6 +45,8 @@ struct MainWindowCallbacks {
     std::function<void(size_t index, std::string_view name, int estimated, int completed)> onTaskUpdated;
     std::function<void(size_t index)> onTaskCompletionToggled;
     std::function<void(size_t from_index, size_t to_index)> onTaskMoved;
+    std::function<std::vector<Core::ArchivedTask>(std::string_view query)> onArchiveSearch;
+    std::function<void(std::uint64_t id)> onArchivedTaskRestored;
     // Navigation callback
     std::function<void(WorkBalance::NavigationTab)> onTabChanged;
 
@@ -61,6 +65,8 @@ struct MainWindowCallbacks {
                                    .onTaskUpdated = std::move(task.onUpdate),
                                    .onTaskCompletionToggled = std::move(task.onToggleCompletion),
                                    .onTaskMoved = std::move(task.onMove),
+                                   .onArchiveSearch = std::move(task.onArchiveSearch),
+                                   .onArchivedTaskRestored = std::move(task.onArchiveRestore),
                                    .onTabChanged = std::move(window.onTabChanged)};
     }
 };
@@ -93,6 +99,9 @@ class MainWindowView {
     /// @brief Sets callbacks for wellness timer interactions
     void setWellnessCallbacks(WellnessCallbacks callbacks);
 
+    /// @brief Sets the frame history shown by the performance HUD (owned by Application)
+    void setFrameProfiler(const App::FrameProfiler* profiler);
+
     void render();
 
   private:
@@ -136,6 +145,9 @@ class MainWindowView {
 
     // Task list panel component
     std::unique_ptr<Components::TaskListPanel> m_task_list_panel;
+
+    // Performance HUD component, created once a frame profiler is set
+    std::unique_ptr<Components::PerformanceHud> m_performance_hud;
 };
 
 } // namespace WorkBalance::App::UI
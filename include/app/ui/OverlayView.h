@@ -1,11 +1,16 @@
 #pragma once
 
 #include <app/ImGuiLayer.h>
+#include <core/MemoryAccounting.h>
 #include <core/Timer.h>
 #include <core/WellnessTimer.h>
 #include <system/OverlayWindow.h>
 #include <ui/AppState.h>
 
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+
 namespace WorkBalance::App::UI {
 class OverlayView {
   public:
@@ -20,21 +25,53 @@ class OverlayView {
         m_eye_care_timer = eye_care;
     }
 
+    /// @brief Refreshes the overlay text and hashes everything the overlay draws
+    ///
+    /// Must be called before renderContent() each tick; the overlay only has to be
+    /// rebuilt when the returned signature changes.
+    /// @param overlay_window The overlay window whose size is part of the signature.
+    [[nodiscard]] std::uint64_t computeSignature(const System::OverlayWindow& overlay_window);
+
     /// @brief Renders the content of the overlay window.
     /// @param overlay_window The overlay window to render content for.
     void renderContent(System::OverlayWindow& overlay_window);
 
-    /// @brief Renders the overlay window frame.
+    /// @brief Renders the overlay window frame and keeps a copy of it for presentCachedFrame().
     /// @param overlay_window The overlay window to render the frame for.
     void renderFrame(System::OverlayWindow& overlay_window);
 
+    /// @brief Draws the last rendered overlay frame again without building a new ImGui frame.
+    /// @param overlay_window The overlay window to present the cached frame in.
+    void presentCachedFrame(System::OverlayWindow& overlay_window);
+
+    /// @brief Forgets the measured text size, e.g. after the overlay font was re-baked at another scale.
+    void invalidateTextLayout() noexcept {
+        m_measured_text.clear();
+        m_measured_scale = 0.0f;
+    }
+
+    /// @brief Frees the cached overlay frame, e.g. when the overlay window is destroyed.
+    void releaseCachedFrame() noexcept {
+        m_cached_frame.clear();
+    }
+
   private:
+    void updateDisplayText();
+    static void prepareFramebuffer(int width, int height);
+
     App::ImGuiLayer& m_imgui;
     Core::Timer& m_timer;
     AppState& m_state;
     Core::WellnessTimer* m_water_timer = nullptr;
     Core::WellnessTimer* m_standup_timer = nullptr;
     Core::WellnessTimer* m_eye_care_timer = nullptr;
+
+    std::pmr::string m_display_text{Core::MemoryAccounting::resource(Core::MemoryTag::UiStrings)};
+    float m_font_scale = 1.0f;
+    std::pmr::string m_measured_text{Core::MemoryAccounting::resource(Core::MemoryTag::UiStrings)};
+    float m_measured_scale = 0.0f;
+    ImVec2 m_text_size{};
+    DrawDataSnapshot m_cached_frame;
 };
 
 } // namespace WorkBalance::App::UI
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <core/TaskArchive.h>
+
+#include <cstdint>
 #include <functional>
 #include <string_view>
+#include <vector>
 
 namespace WorkBalance::App::UI {
 
@@ -12,6 +16,8 @@ struct TaskCallbacks {
     std::function<void(size_t index, std::string_view name, int estimated, int completed)> onUpdate;
     std::function<void(size_t index)> onToggleCompletion;
     std::function<void(size_t from_index, size_t to_index)> onMove;
+    std::function<std::vector<Core::ArchivedTask>(std::string_view query)> onArchiveSearch;
+    std::function<void(std::uint64_t id)> onArchiveRestore;
 };
 
 } // namespace WorkBalance::App::UI
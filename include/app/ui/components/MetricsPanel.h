@@ -0,0 +1,28 @@
+#pragma once
+
+#include <core/Metrics.h>
+#include <ui/AppState.h>
+
+namespace WorkBalance::App::UI::Components {
+
+/// @brief Debug window listing every metric in the registry, toggled with F3
+/// @details Shows counters and gauges as plain values and histograms as sample count with
+/// p50/p99/max latencies. Closing the window clears AppState::show_metrics_panel.
+class MetricsPanel {
+  public:
+    /// @brief Constructs the metrics panel component
+    /// @param metrics Registry to read; only read while rendering
+    /// @param state Reference to the application state
+    MetricsPanel(const Core::MetricsRegistry& metrics, AppState& state);
+
+    /// @brief Renders the panel as a floating window if it is enabled
+    void render();
+
+  private:
+    void renderHistograms();
+
+    const Core::MetricsRegistry& m_metrics;
+    AppState& m_state;
+};
+
+} // namespace WorkBalance::App::UI::Components
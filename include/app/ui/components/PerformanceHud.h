@@ -0,0 +1,29 @@
+#pragma once
+
+#include <app/FrameProfiler.h>
+#include <ui/AppState.h>
+
+namespace WorkBalance::App::UI::Components {
+
+/// @brief Debug window with the frame-time graph, per-stage costs and tagged memory, toggled with F2
+/// @details Reads the FrameProfiler's fixed history and formats into stack buffers, so drawing
+/// the HUD allocates nothing. Closing the window clears AppState::show_performance_hud.
+class PerformanceHud {
+  public:
+    /// @brief Constructs the performance HUD component
+    /// @param profiler Frame history to read; only read while rendering
+    /// @param state Reference to the application state
+    PerformanceHud(const FrameProfiler& profiler, AppState& state);
+
+    /// @brief Renders the HUD as a floating window if it is enabled
+    void render();
+
+  private:
+    void renderStages(const FrameProfiler::Sample& latest, const FrameProfiler::Summary& summary);
+    void renderMemory();
+
+    const FrameProfiler& m_profiler;
+    AppState& m_state;
+};
+
+} // namespace WorkBalance::App::UI::Components
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <string_view>
+#include <vector>
 
 #include <app/ImGuiLayer.h>
 #include <core/Task.h>
+#include <core/TaskArchive.h>
 #include <ui/AppState.h>
 
 namespace WorkBalance::App::UI::Components {
@@ -20,6 +23,8 @@ class TaskListPanel {
         std::function<void(size_t index, std::string_view name, int estimated, int completed)> onTaskUpdated;
         std::function<void(size_t index)> onTaskToggled;
         std::function<void(size_t from_index, size_t to_index)> onTaskMoved;
+        std::function<std::vector<Core::ArchivedTask>(std::string_view query)> onArchiveSearch;
+        std::function<void(std::uint64_t id)> onArchivedTaskRestored;
     };
 
     /// @brief Constructs the task list panel component
@@ -43,6 +48,9 @@ class TaskListPanel {
     /// @brief Renders the Add Task popup dialog
     void renderAddTaskPopup();
 
+    /// @brief Renders the collapsible archive search with restore buttons
+    void renderArchiveSection();
+
     Core::TaskManager& m_task_manager;
     AppState& m_state;
     Callbacks m_callbacks;
@@ -50,6 +58,12 @@ class TaskListPanel {
     // Static buffer for new task name input
     char m_new_task_buffer[256] = "";
     int m_new_task_estimated = 1;
+
+    // Archive search state; results are only re-queried when the query changes
+    char m_archive_query[256] = "";
+    std::vector<Core::ArchivedTask> m_archive_results;
+    bool m_archive_open = false;
+    bool m_archive_results_stale = true;
 };
 
 } // namespace WorkBalance::App::UI::Components
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace WorkBalance::Core {
+
+/// @brief Appends trivially copyable values to a byte buffer in native byte order
+class ByteWriter {
+  public:
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T& value) {
+        writeBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void writeSpan(std::span<const T> values) {
+        writeBytes(values.data(), values.size_bytes());
+    }
+
+    [[nodiscard]] const std::string& bytes() const noexcept {
+        return m_bytes;
+    }
+
+  private:
+    void writeBytes(const void* data, std::size_t size) {
+        m_bytes.append(static_cast<const char*>(data), size);
+    }
+
+    std::string m_bytes;
+};
+
+/// @brief Reads values written by ByteWriter, failing instead of reading past the end
+class ByteReader {
+  public:
+    explicit ByteReader(std::span<const char> bytes) : m_bytes(bytes) {
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] bool read(T& value) {
+        return readBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] bool readVector(std::vector<T>& values, std::size_t count) {
+        if (count > remaining() / sizeof(T)) {
+            return false;
+        }
+        values.resize(count);
+        return readBytes(values.data(), count * sizeof(T));
+    }
+
+    /// @brief Advances past @p size bytes, e.g. ones the caller views in place
+    [[nodiscard]] bool skip(std::size_t size) {
+        if (size > remaining()) {
+            return false;
+        }
+        m_offset += size;
+        return true;
+    }
+
+    [[nodiscard]] std::size_t remaining() const noexcept {
+        return m_bytes.size() - m_offset;
+    }
+
+  private:
+    bool readBytes(void* data, std::size_t size) {
+        if (size > remaining()) {
+            return false;
+        }
+        std::memcpy(data, m_bytes.data() + m_offset, size);
+        m_offset += size;
+        return true;
+    }
+
+    std::span<const char> m_bytes;
+    std::size_t m_offset = 0;
+};
+
+} // namespace WorkBalance::Core
@@ -51,11 +51,16 @@ struct Configuration {
     // Overlay position defaults
     static constexpr float DEFAULT_OVERLAY_POSITION_X = 100.0f;
     static constexpr float DEFAULT_OVERLAY_POSITION_Y = 100.0f;
+    // A hidden overlay gives back its window and GL context after this long
+    static constexpr int OVERLAY_RELEASE_DELAY_SECONDS = 5 * 60;
 
     // Frame rate settings
     static constexpr double TARGET_FPS = 144.0;
     static constexpr double FRAME_TIME = 1.0 / TARGET_FPS;
 
+    // How often metrics are written to metrics.prom in the config directory
+    static constexpr int METRICS_EXPORT_INTERVAL_SECONDS = 60;
+
     // Theme colors
     static constexpr ImVec4 POMODORO_BG_COLOR{0.85f, 0.35f, 0.35f, 1.0f};
     static constexpr ImVec4 SHORT_BREAK_BG_COLOR{0.22f, 0.52f, 0.54f, 1.0f};
@@ -74,6 +79,7 @@ struct Configuration {
     static constexpr int DEFAULT_ESTIMATED_POMODOROS = 1;
     static constexpr int DEFAULT_COMPLETED_POMODOROS = 0;
     static constexpr int MAX_TASK_NAME_LENGTH = 256;
+    static constexpr int DEFAULT_ARCHIVE_AFTER_DAYS = 14; // 0 disables archiving
 
     // Sound defaults
     static constexpr bool DEFAULT_SOUND_ENABLED = true;
@@ -0,0 +1,59 @@
+#pragma once
+
+namespace WorkBalance::Core {
+
+/// @brief Rectangle in GLFW screen coordinates
+struct ScreenRect {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    [[nodiscard]] bool empty() const noexcept {
+        return width <= 0 || height <= 0;
+    }
+
+    [[nodiscard]] bool contains(int point_x, int point_y) const noexcept {
+        return point_x >= x && point_x < x + width && point_y >= y && point_y < y + height;
+    }
+};
+
+/// @brief DPI scaling and window placement arithmetic, kept free of GLFW so it can be tested
+///
+/// Sizes in Configuration are logical units for a 96 DPI display. The UI scale converts them
+/// to screen coordinates: on Windows and X11 those are pixels, so the scale is the monitor's
+/// content scale, while macOS and Wayland already scale screen coordinates themselves and
+/// report as many framebuffer pixels per coordinate as the content scale, leaving 1.
+class DisplayLayout {
+  public:
+    static constexpr float MIN_UI_SCALE = 0.5f;
+    static constexpr float MAX_UI_SCALE = 4.0f;
+    /// @brief Scales are rounded to this step so slightly different monitors share baked fonts
+    static constexpr float UI_SCALE_STEP = 0.25f;
+    /// @brief Logical space left above and below the main window in its monitor's work area
+    static constexpr int WORK_AREA_MARGIN = 20;
+
+    /// @brief Rounds @p scale to UI_SCALE_STEP within [MIN_UI_SCALE, MAX_UI_SCALE]
+    [[nodiscard]] static float quantizeScale(float scale) noexcept;
+
+    /// @brief Logical-to-screen-coordinate scale of a window
+    /// @param content_scale The window's content scale from GLFW
+    /// @param window_width Width in screen coordinates; 0 if unknown, such as before the window exists
+    /// @param framebuffer_width Width in pixels; 0 if unknown or iconified
+    [[nodiscard]] static float uiScale(float content_scale, int window_width, int framebuffer_width) noexcept;
+
+    /// @brief A logical length in screen coordinates, rounded to the nearest coordinate
+    [[nodiscard]] static int scaleLength(int logical, float scale) noexcept;
+
+    /// @brief A @p width x @p height rectangle centred in @p area
+    [[nodiscard]] static ScreenRect centeredIn(const ScreenRect& area, int width, int height) noexcept;
+
+    /// @brief A @p width x @p height rectangle centred horizontally, @p top below the top of @p area
+    [[nodiscard]] static ScreenRect topCenteredIn(const ScreenRect& area, int width, int height, int top) noexcept;
+
+    /// @brief Height of the normal main window: the work area less WORK_AREA_MARGIN above and below
+    /// @param fallback Returned when @p work_area is empty
+    [[nodiscard]] static int normalWindowHeight(const ScreenRect& work_area, float scale, int fallback) noexcept;
+};
+
+} // namespace WorkBalance::Core
@@ -1,8 +1,11 @@
 #pragma once
 
-#include <functional>
-#include <map>
+#include "InplaceFunction.h"
+
+#include <algorithm>
 #include <cstddef>
+#include <utility>
+#include <vector>
 
 namespace WorkBalance::Core {
 
@@ -18,10 +21,16 @@ namespace WorkBalance::Core {
 /// onValueChanged.emit(42);  // Prints "Value: 42"
 /// onValueChanged.unsubscribe(id);
 /// @endcode
+///
+/// Handlers live in one contiguous array in subscription order, with small callables stored
+/// inline, so emitting never allocates and subscribing allocates only when the array grows.
+/// Handlers may subscribe, unsubscribe or clear from inside emit(): removals leave a tombstone
+/// that is compacted once the outermost emit() returns, and handlers added meanwhile are first
+/// called by the next emit().
 template <typename... Args>
 class Event {
   public:
-    using Handler = std::function<void(Args...)>;
+    using Handler = InplaceFunction<void(Args...)>;
     using HandlerId = std::size_t;
 
     /// @brief Subscribe a handler to this event
@@ -29,22 +38,37 @@ class Event {
     /// @return A unique identifier that can be used to unsubscribe
     [[nodiscard]] HandlerId subscribe(Handler handler) {
         const auto id = m_next_id++;
-        m_handlers[id] = std::move(handler);
+        // Appending to m_slots mid-emit could move the handler that is running
+        auto& slots = m_emit_depth > 0 ? m_pending : m_slots;
+        slots.push_back(Slot{id, false, std::move(handler)});
+        ++m_subscriber_count;
         return id;
     }
 
     /// @brief Unsubscribe a handler from this event
     /// @param id The identifier returned from subscribe()
     void unsubscribe(HandlerId id) {
-        m_handlers.erase(id);
+        // Ids are handed out in increasing order, so m_slots stays sorted by id
+        const auto it = std::ranges::lower_bound(m_slots, id, {}, &Slot::id);
+        if (it != m_slots.end() && it->id == id) {
+            if (!it->removed) {
+                removeSlot(it);
+            }
+            return;
+        }
+        if (std::erase_if(m_pending, [id](const Slot& slot) { return slot.id == id; }) > 0) {
+            --m_subscriber_count;
+        }
     }
 
     /// @brief Emit the event, calling all subscribed handlers
     /// @param args The arguments to pass to the handlers
-    void emit(Args... args) const {
-        for (const auto& [id, handler] : m_handlers) {
-            if (handler) {
-                handler(args...);
+    void emit(Args... args) {
+        const EmitScope scope{*this};
+        const std::size_t count = m_slots.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!m_slots[i].removed) {
+                m_slots[i].handler(args...);
             }
         }
     }
@@ -52,23 +76,85 @@ class Event {
     /// @brief Check if there are any subscribers
     /// @return true if at least one handler is subscribed
     [[nodiscard]] bool hasSubscribers() const noexcept {
-        return !m_handlers.empty();
+        return m_subscriber_count > 0;
     }
 
     /// @brief Get the number of subscribers
     /// @return The count of subscribed handlers
     [[nodiscard]] std::size_t subscriberCount() const noexcept {
-        return m_handlers.size();
+        return m_subscriber_count;
     }
 
     /// @brief Remove all subscribers
     void clear() noexcept {
-        m_handlers.clear();
+        m_pending.clear();
+        if (m_emit_depth > 0) {
+            for (auto it = m_slots.begin(); it != m_slots.end(); ++it) {
+                if (!it->removed) {
+                    removeSlot(it);
+                }
+            }
+            return;
+        }
+        m_slots.clear();
+        m_tombstone_count = 0;
+        m_subscriber_count = 0;
     }
 
   private:
-    std::map<HandlerId, Handler> m_handlers;
+    struct Slot {
+        HandlerId id;
+        bool removed;
+        Handler handler;
+    };
+
+    // Tracks nested emit() calls and applies deferred changes when the outermost one returns
+    class EmitScope {
+      public:
+        explicit EmitScope(Event& event) noexcept : m_event(event) {
+            ++m_event.m_emit_depth;
+        }
+        ~EmitScope() {
+            if (--m_event.m_emit_depth == 0) {
+                m_event.applyDeferredChanges();
+            }
+        }
+        EmitScope(const EmitScope&) = delete;
+        EmitScope& operator=(const EmitScope&) = delete;
+
+      private:
+        Event& m_event;
+    };
+
+    void removeSlot(typename std::vector<Slot>::iterator it) noexcept {
+        --m_subscriber_count;
+        if (m_emit_depth > 0) {
+            // The handler may be the one running; destroy it after the emit
+            it->removed = true;
+            ++m_tombstone_count;
+        } else {
+            m_slots.erase(it);
+        }
+    }
+
+    void applyDeferredChanges() {
+        if (m_tombstone_count > 0) {
+            std::erase_if(m_slots, [](const Slot& slot) { return slot.removed; });
+            m_tombstone_count = 0;
+        }
+        if (!m_pending.empty()) {
+            m_slots.insert(m_slots.end(), std::make_move_iterator(m_pending.begin()),
+                           std::make_move_iterator(m_pending.end()));
+            m_pending.clear();
+        }
+    }
+
+    std::vector<Slot> m_slots;   // Sorted by id; removed slots are tombstones during emit()
+    std::vector<Slot> m_pending; // Subscribed during emit(), appended to m_slots afterwards
     HandlerId m_next_id = 0;
+    std::size_t m_subscriber_count = 0;
+    std::size_t m_tombstone_count = 0;
+    int m_emit_depth = 0;
 };
 
 /// @brief Convenience type aliases for common event signatures
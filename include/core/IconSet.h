@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace WorkBalance::Core {
+
+/// @brief One size of an icon: tightly packed, non-premultiplied RGBA8 rows, top row first
+struct IconImage {
+    int width = 0;
+    int height = 0;
+    std::span<const std::uint8_t> pixels;
+};
+
+/// @brief An icon rendered at several sizes, ready to hand to the windowing system
+///
+/// build() runs at build time and does all decoding and scaling, so loading an icon at
+/// runtime is only a matter of pointing into the stored pixels.
+class IconSet {
+  public:
+    /// @brief Scales an image down to each requested size and serializes the result
+    /// @param rgba Source pixels, width * height * 4 bytes
+    /// @param sizes Edge lengths to produce; sizes larger than the source are skipped, and the
+    ///        source size itself is always included
+    [[nodiscard]] static std::vector<std::uint8_t> build(std::span<const std::uint8_t> rgba, int width, int height,
+                                                         std::span<const int> sizes);
+
+    /// @brief Indexes serialized icon data without copying the pixels
+    /// @param data Output of build(); must outlive the IconSet. Malformed data yields no images.
+    explicit IconSet(std::span<const std::uint8_t> data);
+
+    /// @brief All sizes, smallest first
+    [[nodiscard]] const std::vector<IconImage>& getImages() const noexcept {
+        return m_images;
+    }
+
+    /// @brief The smallest image at least @p size pixels wide, or the largest one
+    /// @return nullptr if the set is empty
+    [[nodiscard]] const IconImage* select(int size) const noexcept;
+
+  private:
+    std::vector<IconImage> m_images;
+};
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace WorkBalance::Core {
+
+template <typename Signature, std::size_t Capacity = 4 * sizeof(void*)>
+class InplaceFunction;
+
+/// @brief Move-only callable wrapper that keeps small callables in an inline buffer
+/// @tparam Capacity Bytes of inline storage; the default fits a lambda capturing four pointers
+///
+/// Unlike std::function, whose small-object buffer size is unspecified, callables up to
+/// @p Capacity bytes are guaranteed not to allocate. Larger ones (or ones that may throw
+/// while moving) are kept on the heap, so any callable is accepted.
+template <typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+    static_assert(Capacity >= sizeof(void*), "Capacity must at least hold the pointer to a heap-stored callable");
+
+  public:
+    // User-provided so that const empty instances are allowed; the buffer stays uninitialized
+    InplaceFunction() noexcept {
+    }
+
+    InplaceFunction(std::nullptr_t) noexcept {
+    }
+
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction> &&
+                 std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InplaceFunction(F&& callable) {
+        using Callable = std::decay_t<F>;
+        if constexpr (isNullable<Callable>()) {
+            // An empty std::function or a null pointer stays empty, like it does in std::function
+            if (callable == nullptr) {
+                return;
+            }
+        }
+        if constexpr (fitsInline<Callable>()) {
+            ::new (static_cast<void*>(m_storage)) Callable(std::forward<F>(callable));
+            m_ops = &INLINE_OPS<Callable>;
+        } else {
+            ::new (static_cast<void*>(m_storage)) Callable*(new Callable(std::forward<F>(callable)));
+            m_ops = &HEAP_OPS<Callable>;
+        }
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept : m_ops(std::exchange(other.m_ops, nullptr)) {
+        if (m_ops != nullptr) {
+            m_ops->relocate(m_storage, other.m_storage);
+        }
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            m_ops = std::exchange(other.m_ops, nullptr);
+            if (m_ops != nullptr) {
+                m_ops->relocate(m_storage, other.m_storage);
+            }
+        }
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() {
+        reset();
+    }
+
+    /// @brief Invokes the stored callable; must not be empty
+    R operator()(Args... args) const {
+        return m_ops->invoke(m_storage, std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return m_ops != nullptr;
+    }
+
+    /// @brief Destroys the stored callable, leaving this empty
+    void reset() noexcept {
+        if (m_ops != nullptr) {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+  private:
+    struct Ops {
+        R (*invoke)(void* storage, Args&&... args);
+        // Move-constructs into dst from src and destroys src
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename Callable>
+    [[nodiscard]] static constexpr bool isNullable() noexcept {
+        if constexpr (std::is_pointer_v<Callable> || std::is_member_pointer_v<Callable>) {
+            return true;
+        } else if constexpr (requires { typename Callable::result_type; }) {
+            return std::is_same_v<Callable, std::function<typename Callable::result_type(Args...)>>;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename Callable>
+    [[nodiscard]] static constexpr bool fitsInline() noexcept {
+        return sizeof(Callable) <= Capacity && alignof(Callable) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Callable>;
+    }
+
+    template <typename Callable>
+    static constexpr Ops INLINE_OPS{
+        [](void* storage, Args&&... args) -> R {
+            return std::invoke(*std::launder(static_cast<Callable*>(storage)), std::forward<Args>(args)...);
+        },
+        [](void* dst, void* src) noexcept {
+            Callable* source = std::launder(static_cast<Callable*>(src));
+            ::new (dst) Callable(std::move(*source));
+            source->~Callable();
+        },
+        [](void* storage) noexcept { std::launder(static_cast<Callable*>(storage))->~Callable(); },
+    };
+
+    template <typename Callable>
+    static constexpr Ops HEAP_OPS{
+        [](void* storage, Args&&... args) -> R {
+            return std::invoke(**std::launder(static_cast<Callable**>(storage)), std::forward<Args>(args)...);
+        },
+        [](void* dst, void* src) noexcept { ::new (dst) Callable*(*std::launder(static_cast<Callable**>(src))); },
+        [](void* storage) noexcept { delete *std::launder(static_cast<Callable**>(storage)); },
+    };
+
+    alignas(std::max_align_t) mutable std::byte m_storage[Capacity];
+    const Ops* m_ops = nullptr;
+};
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+
+namespace WorkBalance::Core {
+
+/// @brief Subsystems whose heap use is accounted separately
+enum class MemoryTag : std::uint8_t {
+    Tasks,       ///< Task names in the task list, undo history and archive index
+    Persistence, ///< Settings file buffers while loading
+    UiStrings,   ///< Text kept between frames by the views
+    Audio,       ///< miniaudio's engine, decoders and sound buffers
+    ImGui        ///< ImGui's context, draw lists and font atlas
+};
+
+inline constexpr std::size_t MEMORY_TAG_COUNT = 5;
+
+/// @brief Short lowercase name of a tag, used in metric names
+[[nodiscard]] std::string_view getMemoryTagName(MemoryTag tag) noexcept;
+
+/// @brief Current and peak bytes allocated under one tag; updated from any thread
+class MemoryAccount {
+  public:
+    void add(std::size_t bytes) noexcept;
+    void remove(std::size_t bytes) noexcept;
+
+    [[nodiscard]] std::uint64_t current() const noexcept {
+        return m_current.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Highest current() seen since start
+    [[nodiscard]] std::uint64_t peak() const noexcept {
+        return m_peak.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<std::uint64_t> m_current{0};
+    std::atomic<std::uint64_t> m_peak{0};
+};
+
+/// @brief Memory resource that counts what passes through it, then forwards upstream
+class TaggedMemoryResource final : public std::pmr::memory_resource {
+  public:
+    explicit TaggedMemoryResource(MemoryAccount& account,
+                                  std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+        : m_account(account), m_upstream(upstream) {
+    }
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    MemoryAccount& m_account;
+    std::pmr::memory_resource* m_upstream;
+};
+
+/// @brief Process-wide accounts and memory resources, one per MemoryTag
+///
+/// C++ containers take resource(tag). C libraries with allocator hooks (ImGui, miniaudio)
+/// call allocate()/reallocate()/deallocate(), which keep the size in a small header so frees
+/// without a size can still be accounted.
+///
+/// Example usage:
+/// @code
+/// std::pmr::string text{MemoryAccounting::resource(MemoryTag::UiStrings)};
+/// text = "25:00";
+/// const auto bytes = MemoryAccounting::account(MemoryTag::UiStrings).current();
+/// @endcode
+class MemoryAccounting {
+  public:
+    [[nodiscard]] static MemoryAccount& account(MemoryTag tag) noexcept;
+    [[nodiscard]] static std::pmr::memory_resource* resource(MemoryTag tag) noexcept;
+
+    /// @brief malloc() that accounts under @p tag; returns nullptr on failure
+    [[nodiscard]] static void* allocate(MemoryTag tag, std::size_t size) noexcept;
+
+    /// @brief realloc() for pointers from allocate() with the same tag
+    [[nodiscard]] static void* reallocate(MemoryTag tag, void* pointer, std::size_t size) noexcept;
+
+    /// @brief free() for pointers from allocate() with the same tag; null is ignored
+    static void deallocate(MemoryTag tag, void* pointer) noexcept;
+};
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include "Persistence.h"
+
+namespace WorkBalance::Core {
+
+/// @brief Monotonically increasing count, safe to increment from any thread
+class Counter {
+  public:
+    void increment(std::uint64_t amount = 1) noexcept {
+        m_value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<std::uint64_t> m_value{0};
+};
+
+/// @brief Value that goes up and down (queue depth, task count), safe to set from any thread
+class Gauge {
+  public:
+    void set(double value) noexcept {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] double value() const noexcept {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<double> m_value{0.0};
+};
+
+/// @brief Distribution of durations in nanoseconds, safe to record from any thread
+///
+/// Buckets are log-linear like an HDR histogram: every power of two is split into
+/// SUB_BUCKETS equal buckets, so any recorded value is known to within 12.5% whatever its
+/// magnitude. Values below SUB_BUCKETS ns get a bucket each; values of 2^41 ns (about 37
+/// minutes) or more land in the last bucket. Recording is two relaxed atomic adds.
+class Histogram {
+  public:
+    static constexpr unsigned SUB_BUCKET_BITS = 3;
+    static constexpr std::uint64_t SUB_BUCKETS = std::uint64_t{1} << SUB_BUCKET_BITS;
+    static constexpr unsigned MAX_EXPONENT = 40;
+    static constexpr std::size_t BUCKET_COUNT = SUB_BUCKETS + ((MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS);
+
+    /// @brief Consistent-enough copy of the buckets for reporting
+    struct Snapshot {
+        std::array<std::uint64_t, BUCKET_COUNT> buckets{};
+        std::uint64_t count = 0;
+        std::uint64_t sum = 0;
+
+        /// @brief Upper bound of the bucket holding the q-th quantile (0 <= q <= 1); 0 when empty
+        [[nodiscard]] std::uint64_t quantile(double q) const noexcept;
+    };
+
+    void record(std::uint64_t nanoseconds) noexcept {
+        m_buckets[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+
+    void record(std::chrono::nanoseconds duration) noexcept {
+        record(duration.count() > 0 ? static_cast<std::uint64_t>(duration.count()) : 0);
+    }
+
+    [[nodiscard]] Snapshot snapshot() const noexcept;
+
+    [[nodiscard]] static constexpr std::size_t bucketIndex(std::uint64_t value) noexcept {
+        if (value < SUB_BUCKETS) {
+            return static_cast<std::size_t>(value);
+        }
+        const auto exponent = static_cast<unsigned>(std::bit_width(value)) - 1;
+        if (exponent > MAX_EXPONENT) {
+            return BUCKET_COUNT - 1;
+        }
+        const std::uint64_t sub_bucket = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+        return static_cast<std::size_t>(((exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS) + sub_bucket);
+    }
+
+    /// @brief Largest value that falls into bucket @p index
+    [[nodiscard]] static constexpr std::uint64_t bucketUpperBound(std::size_t index) noexcept {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        const auto exponent = static_cast<unsigned>(index / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+        const std::uint64_t sub_bucket = index % SUB_BUCKETS;
+        const unsigned shift = exponent - SUB_BUCKET_BITS;
+        return ((SUB_BUCKETS + sub_bucket + 1) << shift) - 1;
+    }
+
+  private:
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> m_buckets{};
+    std::atomic<std::uint64_t> m_sum{0};
+};
+
+/// @brief Records the lifetime of the scope into a histogram; does nothing for a null histogram
+class ScopedLatency {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ScopedLatency(Histogram* histogram) noexcept
+        : m_histogram(histogram), m_start(histogram != nullptr ? Clock::now() : Clock::time_point{}) {
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+    ~ScopedLatency() {
+        if (m_histogram != nullptr) {
+            m_histogram->record(Clock::now() - m_start);
+        }
+    }
+
+  private:
+    Histogram* m_histogram;
+    Clock::time_point m_start;
+};
+
+/// @brief Named metrics, exported in the Prometheus text format
+///
+/// Register every metric on one thread before others record into it (typically at
+/// startup); the returned references stay valid for the registry's lifetime and may then
+/// be updated from any thread. Registering an existing name returns the existing metric.
+///
+/// Example usage:
+/// @code
+/// MetricsRegistry registry;
+/// Counter& saves = registry.counter("workbalance_saves_total", "Settings saves");
+/// Histogram& save_time = registry.histogram("workbalance_save_seconds", "Time to save settings");
+/// {
+///     const ScopedLatency latency{&save_time};
+///     save();
+/// }
+/// saves.increment();
+/// @endcode
+class MetricsRegistry {
+  public:
+    template <typename Metric>
+    struct Named {
+        std::string name;
+        std::string help;
+        Metric metric;
+    };
+
+    static constexpr std::string_view DEFAULT_FILENAME = "metrics.prom";
+
+    MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    Counter& counter(std::string_view name, std::string_view help);
+    Gauge& gauge(std::string_view name, std::string_view help);
+    /// Recorded in nanoseconds, exported in seconds as Prometheus expects
+    Histogram& histogram(std::string_view name, std::string_view help);
+
+    [[nodiscard]] const std::deque<Named<Counter>>& counters() const noexcept {
+        return m_counters;
+    }
+
+    [[nodiscard]] const std::deque<Named<Gauge>>& gauges() const noexcept {
+        return m_gauges;
+    }
+
+    [[nodiscard]] const std::deque<Named<Histogram>>& histograms() const noexcept {
+        return m_histograms;
+    }
+
+    /// @brief Every metric in the Prometheus text exposition format
+    /// Histograms list only the buckets that have samples, plus +Inf
+    [[nodiscard]] std::string toPrometheusText() const;
+
+    /// @brief Replaces @p path with toPrometheusText(), e.g. for node_exporter's textfile collector
+    [[nodiscard]] std::expected<void, PersistenceError> writePrometheusFile(const std::filesystem::path& path) const;
+
+  private:
+    std::deque<Named<Counter>> m_counters;
+    std::deque<Named<Gauge>> m_gauges;
+    std::deque<Named<Histogram>> m_histograms;
+};
+
+} // namespace WorkBalance::Core
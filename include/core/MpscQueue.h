@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace WorkBalance::Core {
+
+/// @brief Bounded lock-free queue for many producer threads and one consumer thread
+/// @tparam Capacity Number of slots, a power of two
+///
+/// A ring of slots, each tagged with a sequence number that says whether the slot is free for
+/// the producer claiming position N (sequence == N) or holds that producer's item for the
+/// consumer (sequence == N + 1). Producers claim positions with one CAS and never wait on each
+/// other; the consumer never writes anything a producer spins on. Nothing allocates after
+/// construction.
+///
+/// Example usage:
+/// @code
+/// MpscQueue<int, 64> queue;
+/// std::jthread worker([&] { (void)queue.tryPush(42); });  // any thread
+/// while (auto value = queue.tryPop()) { use(*value); }   // owning thread only
+/// @endcode
+template <typename T, std::size_t Capacity>
+class MpscQueue {
+    static_assert(Capacity >= 2 && std::has_single_bit(Capacity), "Capacity must be a power of two");
+    static_assert(std::is_nothrow_move_constructible_v<T>, "Items are moved in and out without a way to undo");
+
+  public:
+    MpscQueue() noexcept {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpscQueue() {
+        while (tryPop()) {
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /// @brief Appends an item; safe to call from any thread
+    /// @return false if the queue is full (the item is dropped)
+    [[nodiscard]] bool tryPush(T value) noexcept {
+        std::size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[position & MASK];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == position) {
+                if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    ::new (static_cast<void*>(cell.storage)) T(std::move(value));
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+                // Lost the race; position now holds the current value
+            } else if (sequence < position) {
+                // The consumer has not freed this slot from the previous lap yet
+                return false;
+            } else {
+                position = m_enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Removes the oldest item; only the consumer thread may call this
+    /// @return nullopt if the queue is empty
+    [[nodiscard]] std::optional<T> tryPop() noexcept {
+        Cell& cell = m_cells[m_dequeue_position & MASK];
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeue_position + 1) {
+            return std::nullopt;
+        }
+        T* item = std::launder(reinterpret_cast<T*>(cell.storage));
+        std::optional<T> value{std::move(*item)};
+        item->~T();
+        // Free the slot for the producer one lap ahead
+        cell.sequence.store(m_dequeue_position + Capacity, std::memory_order_release);
+        ++m_dequeue_position;
+        return value;
+    }
+
+    /// @brief True if the next tryPop() would return an item; only the consumer thread may call this
+    [[nodiscard]] bool hasItems() const noexcept {
+        return m_cells[m_dequeue_position & MASK].sequence.load(std::memory_order_acquire) == m_dequeue_position + 1;
+    }
+
+    [[nodiscard]] static constexpr std::size_t capacity() noexcept {
+        return Capacity;
+    }
+
+  private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    // Keeps the producer and consumer counters off each other's cache line
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::array<Cell, Capacity> m_cells;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_enqueue_position{0};
+    alignas(CACHE_LINE_SIZE) std::size_t m_dequeue_position = 0;
+};
+
+} // namespace WorkBalance::Core
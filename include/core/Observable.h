@@ -1,13 +1,120 @@
 #pragma once
 
+#include <concepts>
+#include <cstddef>
 #include <functional>
+#include <optional>
 #include <utility>
 #include <vector>
 
 namespace WorkBalance::Core {
 
+class ComputedNode;
+
+/// @brief Batches observable changes so each observer is notified once, when the outermost scope ends
+///
+/// Values change immediately, so reads inside the scope see them, but observers run at commit
+/// with the value from before the scope and the final one. An observable that ends up back at
+/// its original value is not reported. Outside a transaction every set() commits on its own.
+///
+/// Example usage:
+/// @code
+/// {
+///     ObservableTransaction transaction;
+///     water.set(3);
+///     standups.set(2);
+///     water.set(4);
+/// } // water observers run once with (old, 4), standups observers once with (old, 2)
+/// @endcode
+class ObservableTransaction {
+  public:
+    ObservableTransaction() noexcept;
+    /// Observers run here, so they must not throw
+    ~ObservableTransaction();
+
+    ObservableTransaction(const ObservableTransaction&) = delete;
+    ObservableTransaction& operator=(const ObservableTransaction&) = delete;
+
+    /// @brief True while an ObservableTransaction is open on this thread
+    [[nodiscard]] static bool isActive() noexcept;
+};
+
+/// @brief Bookkeeping shared by Observable and ComputedObservable: who depends on the value,
+/// and whether a notification is queued for the current transaction
+///
+/// Copies start out unlinked; dependency edges and queued notifications belong to one object.
+class ObservableNode {
+  public:
+    ObservableNode() noexcept = default;
+    ObservableNode(const ObservableNode&) noexcept {
+    }
+    ObservableNode& operator=(const ObservableNode&) noexcept {
+        return *this;
+    }
+    virtual ~ObservableNode();
+
+  protected:
+    /// @brief Records this node as an input of the ComputedObservable being evaluated, if any
+    void recordRead() const;
+
+    /// @brief Marks every ComputedObservable derived from this node as stale
+    void invalidateDependents() const;
+
+    /// @brief Queues flushNotification() for the end of the current transaction
+    void scheduleNotification();
+
+    [[nodiscard]] bool isNotificationScheduled() const noexcept {
+        return m_scheduled;
+    }
+
+    /// @brief Delivers the notification queued by scheduleNotification()
+    virtual void flushNotification() = 0;
+
+  private:
+    friend class ComputedNode;
+    friend class ObservableTransaction;
+
+    mutable std::vector<ComputedNode*> m_dependents;
+    bool m_scheduled = false;
+};
+
+/// @brief Dependency tracking behind ComputedObservable
+class ComputedNode : public ObservableNode {
+  public:
+    ComputedNode() noexcept = default;
+    ComputedNode(const ComputedNode&) noexcept : ObservableNode() {
+    }
+    ComputedNode& operator=(const ComputedNode&) noexcept {
+        return *this;
+    }
+    ~ComputedNode() override;
+
+  protected:
+    /// @brief Runs @p evaluate while recording every observable it reads as an input
+    void track(const std::function<void()>& evaluate) const;
+
+    [[nodiscard]] bool isStale() const noexcept {
+        return m_stale;
+    }
+
+    /// @brief Called when an input changed while the value was fresh
+    virtual void onInvalidated() = 0;
+
+  private:
+    friend class ObservableNode;
+
+    void addSource(const ObservableNode* source) const;
+    void invalidate();
+
+    // Inputs read by the last evaluation; m_sources[0, m_tracked_count) are confirmed by the current one
+    mutable std::vector<const ObservableNode*> m_sources;
+    mutable std::size_t m_tracked_count = 0;
+    mutable bool m_stale = true;
+};
+
 /// @brief Observable wrapper that notifies observers when value changes
-/// @tparam T The type of value being observed (must support operator!=)
+/// @tparam T The type of value being observed; types without operator== (such as ImVec4)
+///           count as changed on every set()
 ///
 /// Example usage:
 /// @code
@@ -19,7 +126,7 @@ namespace WorkBalance::Core {
 /// count.set(5);  // No trigger (same value)
 /// @endcode
 template <typename T>
-class Observable {
+class Observable : public ObservableNode {
   public:
     /// @brief Observer callback signature: receives old and new values
     using Observer = std::function<void(const T&, const T&)>;
@@ -31,21 +138,21 @@ class Observable {
 
     /// @brief Get the current value
     /// @return Const reference to the current value
-    [[nodiscard]] const T& get() const noexcept {
+    [[nodiscard]] const T& get() const {
+        recordRead();
         return m_value;
     }
 
     /// @brief Implicit conversion to the underlying type
-    [[nodiscard]] operator const T&() const noexcept {
-        return m_value;
+    [[nodiscard]] operator const T&() const {
+        return get();
     }
 
     /// @brief Set a new value, notifying observers if changed
     /// @param new_value The new value to set
     void set(T new_value) {
-        if (m_value != new_value) {
-            T old_value = std::exchange(m_value, std::move(new_value));
-            notifyObservers(old_value, m_value);
+        if (differs(m_value, new_value)) {
+            assign(std::move(new_value), false);
         }
     }
 
@@ -53,8 +160,7 @@ class Observable {
     /// @param new_value The new value to set
     /// @note This always notifies observers, even if the value hasn't changed
     void forceSet(T new_value) {
-        T old_value = std::exchange(m_value, std::move(new_value));
-        notifyObservers(old_value, m_value);
+        assign(std::move(new_value), true);
     }
 
     /// @brief Add an observer that will be called when the value changes
@@ -83,78 +189,150 @@ class Observable {
     /// @return true if the value changed (and observers were notified)
     template <typename F>
     bool modify(F&& modifier) {
-        T old_value = m_value;
-        modifier(m_value);
-        if (old_value != m_value) {
-            notifyObservers(old_value, m_value);
+        T new_value = m_value;
+        std::forward<F>(modifier)(new_value);
+        if (differs(m_value, new_value)) {
+            assign(std::move(new_value), false);
             return true;
         }
         return false;
     }
 
   private:
-    void notifyObservers(const T& old_value, const T& new_value) {
-        for (const auto& observer : m_observers) {
-            if (observer) {
-                observer(old_value, new_value);
+    [[nodiscard]] static bool differs(const T& lhs, const T& rhs) {
+        if constexpr (std::equality_comparable<T>) {
+            return lhs != rhs;
+        } else {
+            return true;
+        }
+    }
+
+    void assign(T new_value, bool force) {
+        const ObservableTransaction transaction;
+        if (hasObservers() && !isNotificationScheduled()) {
+            // Observers hear about the change relative to the value before the transaction
+            m_committed_value.emplace(std::move(m_value));
+            scheduleNotification();
+        }
+        m_value = std::move(new_value);
+        m_force_notify = isNotificationScheduled() && (m_force_notify || force);
+        invalidateDependents();
+    }
+
+    void flushNotification() override {
+        if (!m_committed_value) {
+            return;
+        }
+        const T old_value = std::move(*m_committed_value);
+        m_committed_value.reset();
+        if (std::exchange(m_force_notify, false) || differs(old_value, m_value)) {
+            for (const auto& observer : m_observers) {
+                if (observer) {
+                    observer(old_value, m_value);
+                }
             }
         }
     }
 
     T m_value;
     std::vector<Observer> m_observers;
+    std::optional<T> m_committed_value; // Set while a notification is pending
+    bool m_force_notify = false;
 };
 
 /// @brief Computed observable that derives its value from other observables
 /// @tparam T The computed value type
 ///
+/// The compute function runs lazily: on the first read, and on the next read after any
+/// Observable or ComputedObservable it read last time has changed. Those inputs are recorded
+/// automatically. Observed values are recomputed when the change commits, so observers are
+/// notified once per transaction. Inputs that are not observables (plain variables) are not
+/// tracked; call update() after changing them.
+///
 /// Example usage:
 /// @code
 /// Observable<int> width{10};
 /// Observable<int> height{20};
 /// ComputedObservable<int> area([&]() { return width.get() * height.get(); });
-/// // Note: computed value must be manually updated when dependencies change
+/// width.set(30);
+/// area.get();  // 600, recomputed on this read
 /// @endcode
 template <typename T>
-class ComputedObservable {
+class ComputedObservable : public ComputedNode {
   public:
     using ComputeFunc = std::function<T()>;
     using Observer = std::function<void(const T&, const T&)>;
 
-    explicit ComputedObservable(ComputeFunc compute) : m_compute(std::move(compute)), m_cached_value(m_compute()) {
+    explicit ComputedObservable(ComputeFunc compute) : m_compute(std::move(compute)) {
     }
 
-    /// @brief Get the cached computed value
-    [[nodiscard]] const T& get() const noexcept {
-        return m_cached_value;
+    /// @brief Get the value, recomputing it first if an input changed since the last read
+    [[nodiscard]] const T& get() const {
+        recordRead();
+        if (isStale()) {
+            recompute();
+        }
+        return *m_cached_value;
     }
 
     /// @brief Implicit conversion
-    [[nodiscard]] operator const T&() const noexcept {
-        return m_cached_value;
+    [[nodiscard]] operator const T&() const {
+        return get();
     }
 
-    /// @brief Recompute the value and notify observers if changed
+    /// @brief Recompute the value now and notify observers if changed
+    /// Needed after changing an input that is not an observable
     void update() {
-        T new_value = m_compute();
-        if (m_cached_value != new_value) {
-            T old_value = std::exchange(m_cached_value, std::move(new_value));
-            for (const auto& observer : m_observers) {
-                if (observer) {
-                    observer(old_value, m_cached_value);
-                }
-            }
+        const ObservableTransaction transaction;
+        std::optional<T> old_value = std::move(m_cached_value);
+        recompute();
+        if (old_value && *old_value != *m_cached_value) {
+            invalidateDependents();
+            notifyObservers(*old_value, *m_cached_value);
         }
     }
 
     /// @brief Add an observer
+    /// The value is computed now so later changes have a value to compare against
     void observe(Observer observer) {
+        static_cast<void>(get());
         m_observers.push_back(std::move(observer));
     }
 
   private:
+    void recompute() const {
+        track([this] { m_cached_value.emplace(m_compute()); });
+    }
+
+    void onInvalidated() override {
+        if (!m_observers.empty() && !isNotificationScheduled()) {
+            m_notified_value = m_cached_value;
+            scheduleNotification();
+        }
+    }
+
+    void flushNotification() override {
+        if (!m_notified_value) {
+            return;
+        }
+        const T old_value = std::move(*m_notified_value);
+        m_notified_value.reset();
+        if (old_value != get()) {
+            notifyObservers(old_value, *m_cached_value);
+        }
+    }
+
+    void notifyObservers(const T& old_value, const T& new_value) {
+        for (const auto& observer : m_observers) {
+            if (observer) {
+                observer(old_value, new_value);
+            }
+        }
+    }
+
     ComputeFunc m_compute;
-    T m_cached_value;
+    mutable std::optional<T> m_cached_value;
+    std::optional<T> m_notified_value; // Last value observers saw, while a notification is pending
     std::vector<Observer> m_observers;
 };
 
@@ -1,18 +1,29 @@
 #pragma once
 
 #include "Configuration.h"
+#include "MemoryAccounting.h"
+#include "StringPool.h"
 #include "Task.h"
 
 #include <expected>
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace WorkBalance::Core {
 
 /// @brief Error types that can occur during persistence operations
-enum class PersistenceError { FileNotFound, FileOpenError, ParseError, WriteError, DirectoryCreateError };
+enum class PersistenceError {
+    FileNotFound,
+    FileOpenError,
+    ParseError,
+    WriteError,
+    DirectoryCreateError,
+    EntryNotFound,
+    CacheMismatch
+};
 
 /// @brief Get a human-readable description of a persistence error
 [[nodiscard]] constexpr std::string_view getPersistenceErrorMessage(PersistenceError error) noexcept {
@@ -27,11 +38,23 @@ enum class PersistenceError { FileNotFound, FileOpenError, ParseError, WriteErro
             return "Failed to write configuration file";
         case PersistenceError::DirectoryCreateError:
             return "Failed to create configuration directory";
+        case PersistenceError::EntryNotFound:
+            return "Archived entry not found";
+        case PersistenceError::CacheMismatch:
+            return "Cached data does not match the current build";
         default:
             return "Unknown persistence error";
     }
 }
 
+/// @brief Escape text for a JSON string literal, including control characters
+[[nodiscard]] std::string escapeJson(std::string_view text);
+
+/// @brief Replace a file's contents without readers ever seeing a partial write
+/// @details Writes beside the target as "<path>.tmp" and renames over it, creating the directory if needed
+[[nodiscard]] std::expected<void, PersistenceError> writeFileAtomically(const std::filesystem::path& path,
+                                                                        std::string_view contents);
+
 /// @brief User-configurable settings that persist across sessions
 struct UserSettings {
     int pomodoro_duration_minutes = Configuration::DEFAULT_POMODORO_MINUTES;
@@ -66,6 +89,8 @@ struct UserSettings {
     // Startup settings
     bool start_with_windows = false;
     bool start_minimized = true;
+    // Task archive settings
+    int archive_after_days = Configuration::DEFAULT_ARCHIVE_AFTER_DAYS;
     // Sound settings
     bool pomodoro_sound_enabled = Configuration::DEFAULT_SOUND_ENABLED;
     int pomodoro_sound_volume = Configuration::DEFAULT_SOUND_VOLUME;
@@ -83,9 +108,21 @@ struct UserSettings {
 };
 
 /// @brief Persistent application data including tasks and settings
+///
+/// Loaded task names live in `task_names`, so the whole arena can be handed to
+/// TaskManager::adoptTasks() in one move. Tasks added for saving may instead point
+/// into the TaskManager's pool, which must outlive the save call.
 struct PersistentData {
+    PersistentData() = default;
+    PersistentData(const PersistentData& other);
+    PersistentData& operator=(const PersistentData& other);
+    PersistentData(PersistentData&&) noexcept = default;
+    PersistentData& operator=(PersistentData&&) noexcept = default;
+    ~PersistentData() = default;
+
     UserSettings settings;
     std::vector<Task> tasks;
+    StringPool task_names{StringPool::DEFAULT_CHUNK_SIZE, MemoryAccounting::resource(MemoryTag::Tasks)};
     int current_task_index = 0;
 };
 
@@ -112,10 +149,12 @@ class PersistenceManager {
         return m_config_path;
     }
 
-  private:
+    /// @brief Per-user directory that holds the configuration and other app data
     [[nodiscard]] static std::filesystem::path getDefaultConfigDirectory();
+
+  private:
     [[nodiscard]] static std::string serializeToJson(const PersistentData& data);
-    [[nodiscard]] static std::optional<PersistentData> deserializeFromJson(const std::string& json);
+    [[nodiscard]] static std::optional<PersistentData> deserializeFromJson(std::string_view json);
 
     std::filesystem::path m_config_path;
 };
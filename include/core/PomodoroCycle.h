@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Timer.h"
+
+namespace WorkBalance::Core {
+
+/// @brief Tracks progress through the pomodoro cycle and decides which timer follows each one
+///
+/// Pomodoros are followed by short breaks until `pomodoros_before_long_break` of them have been
+/// completed, and by long breaks from then on. The count starts over once `long_breaks_in_cycle`
+/// long breaks have been taken.
+class PomodoroCycle {
+  public:
+    /// @brief Records a completed timer and returns the mode to switch to
+    [[nodiscard]] TimerMode advance(TimerMode completed, int pomodoros_before_long_break,
+                                    int long_breaks_in_cycle) noexcept;
+
+    /// @brief Starts the cycle over
+    void reset() noexcept;
+
+    [[nodiscard]] int getPomodorosCompleted() const noexcept {
+        return m_pomodoros_completed;
+    }
+    [[nodiscard]] int getLongBreaksTaken() const noexcept {
+        return m_long_breaks_taken;
+    }
+
+  private:
+    int m_pomodoros_completed = 0;
+    int m_long_breaks_taken = 0;
+};
+
+} // namespace WorkBalance::Core
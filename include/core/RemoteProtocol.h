@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Timer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WorkBalance::Core {
+
+/// @brief What a later launch asks the running instance to do
+enum class RemoteAction : std::uint8_t { Show = 1, ToggleTimer = 2, StartBreak = 3, Status = 4, Quit = 5 };
+
+/// @brief The break a RemoteAction::StartBreak command starts
+enum class BreakKind : std::uint8_t { ShortBreak, LongBreak, Water, Standup, EyeCare };
+
+/// @brief A command forwarded from the command line to the running instance
+struct RemoteCommand {
+    RemoteAction action = RemoteAction::Show;
+    BreakKind break_kind = BreakKind::ShortBreak; ///< Only used by StartBreak
+
+    bool operator==(const RemoteCommand&) const = default;
+};
+
+/// @brief The running instance's answer, printed by the launch that sent the command
+struct RemoteReply {
+    bool success = true;
+    std::string message;
+
+    bool operator==(const RemoteReply&) const = default;
+};
+
+/// @brief What a running instance reports for --status
+struct SessionStatus {
+    TimerMode mode = TimerMode::Pomodoro;
+    TimerState state = TimerState::Stopped;
+    int remaining_seconds = 0;
+    int water_glasses = 0;
+    int water_goal = 0;
+    int standups = 0;
+    int eye_breaks = 0;
+};
+
+/// @brief Formats a status as the two lines printed by --status
+[[nodiscard]] std::string formatSessionStatus(const SessionStatus& status);
+
+/// @brief Parses a break name as typed on the command line: short, long, water, standup or eye
+[[nodiscard]] std::optional<BreakKind> parseBreakKind(std::string_view name) noexcept;
+
+/// @brief The command-line name of a break, the inverse of parseBreakKind()
+[[nodiscard]] std::string_view getBreakKindName(BreakKind kind) noexcept;
+
+/// @brief Wire format spoken over the single-instance socket
+///
+/// Every message is a frame: a 32-bit payload length followed by the payload. A command payload
+/// is [version, action, break kind]; a reply payload is [version, success, message bytes]. Both
+/// ends run on the same machine, so integers use native byte order.
+namespace RemoteProtocol {
+inline constexpr std::uint8_t VERSION = 1;
+inline constexpr std::size_t LENGTH_PREFIX_SIZE = sizeof(std::uint32_t);
+inline constexpr std::uint32_t MAX_PAYLOAD_SIZE = 4096;
+
+/// @brief Serializes a command into a complete frame
+[[nodiscard]] std::vector<std::uint8_t> encode(const RemoteCommand& command);
+
+/// @brief Serializes a reply into a complete frame; messages beyond MAX_PAYLOAD_SIZE are truncated
+[[nodiscard]] std::vector<std::uint8_t> encode(const RemoteReply& reply);
+
+/// @brief Reads the payload length from the start of a frame
+/// @return nullopt if the length exceeds MAX_PAYLOAD_SIZE
+[[nodiscard]] std::optional<std::uint32_t>
+decodeLength(std::span<const std::uint8_t, LENGTH_PREFIX_SIZE> prefix) noexcept;
+
+/// @brief Parses a command payload (the frame without its length prefix)
+[[nodiscard]] std::optional<RemoteCommand> decodeCommand(std::span<const std::uint8_t> payload) noexcept;
+
+/// @brief Parses a reply payload (the frame without its length prefix)
+[[nodiscard]] std::optional<RemoteReply> decodeReply(std::span<const std::uint8_t> payload);
+} // namespace RemoteProtocol
+
+} // namespace WorkBalance::Core
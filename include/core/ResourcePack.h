@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WorkBalance::Core {
+
+/// @brief Read-only archive of named, zstd-compressed assets
+///
+/// The pack is produced at build time by build() and linked into the executable as a single
+/// blob. Entries are decompressed on first request and kept for the lifetime of the pack, so
+/// assets that are never used are never expanded. get() may be called from any thread.
+class ResourcePack {
+  public:
+    /// @brief An asset to store with build()
+    struct Source {
+        std::string name;
+        std::span<const std::uint8_t> data;
+    };
+
+    /// @brief Serializes a pack; entries that zstd cannot shrink are stored as-is
+    /// @param compression_level zstd level used for every entry
+    [[nodiscard]] static std::vector<std::uint8_t> build(std::span<const Source> sources, int compression_level);
+
+    /// @brief Indexes a pack without decompressing anything
+    /// @param blob Pack bytes; must outlive the ResourcePack. A malformed blob yields an empty pack.
+    explicit ResourcePack(std::span<const std::uint8_t> blob);
+    ~ResourcePack() = default;
+
+    ResourcePack(const ResourcePack&) = delete;
+    ResourcePack& operator=(const ResourcePack&) = delete;
+    ResourcePack(ResourcePack&&) = delete;
+    ResourcePack& operator=(ResourcePack&&) = delete;
+
+    [[nodiscard]] bool isValid() const noexcept {
+        return m_valid;
+    }
+
+    [[nodiscard]] bool contains(std::string_view name) const noexcept;
+
+    /// @brief Contents of an entry, decompressed on the first call
+    /// @return The bytes, valid as long as the pack; empty if the entry is missing or corrupt
+    [[nodiscard]] std::span<const std::uint8_t> get(std::string_view name);
+
+    /// @brief Bytes held in decompressed entries
+    [[nodiscard]] std::size_t getDecompressedBytes() const;
+
+  private:
+    struct Entry {
+        std::string_view name; ///< Points into the blob
+        std::span<const std::uint8_t> stored;
+        std::uint64_t size = 0;
+        std::vector<std::uint8_t> contents; ///< Decompressed bytes once loaded
+        bool loaded = false;
+    };
+
+    [[nodiscard]] static bool decompress(Entry& entry);
+
+    std::vector<Entry> m_entries; ///< Sorted by name
+    bool m_valid = false;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace WorkBalance::Core
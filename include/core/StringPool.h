@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace WorkBalance::Core {
+
+/// @brief Append-only arena that owns string bytes in large contiguous chunks
+///
+/// Strings are copied into the arena once and handed out as std::string_view handles.
+/// Chunks never move or shrink, so handles stay valid until clear() or destruction,
+/// and moving the pool moves every string at once without touching the bytes.
+/// Short strings are interned: identical names share a single copy.
+///
+/// Example usage:
+/// @code
+/// StringPool pool;
+/// std::string_view a = pool.intern("Write report");
+/// std::string_view b = pool.intern("Write report");
+/// assert(a.data() == b.data());  // interned
+/// @endcode
+class StringPool {
+  public:
+    /// @brief Default chunk capacity in bytes
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+    /// @brief Strings up to this length are deduplicated
+    static constexpr std::size_t SMALL_STRING_MAX = 32;
+
+    StringPool() = default;
+    /// @param resource Where chunks are allocated; lets owners account their name bytes
+    explicit StringPool(std::size_t chunk_size,
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept;
+
+    // Non-copyable: handles point into the chunks, a copy would alias them
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    // Movable: chunk storage is heap allocated, so handles survive the move
+    StringPool(StringPool&&) noexcept = default;
+    StringPool& operator=(StringPool&&) noexcept = default;
+
+    /// @brief Copy a string into the arena
+    /// @param text The string to store
+    /// @return A view into arena-owned storage (empty view for empty input)
+    [[nodiscard]] std::string_view intern(std::string_view text);
+
+    /// @brief Check if a view points into this pool's storage (O(log chunks))
+    [[nodiscard]] bool owns(std::string_view text) const noexcept;
+
+    /// @brief Ensure at least the given number of bytes can be appended without a new chunk
+    void reserve(std::size_t bytes);
+
+    /// @brief Release all storage, invalidating every handle
+    void clear() noexcept;
+
+    /// @brief Bytes occupied by stored strings
+    [[nodiscard]] std::size_t bytesUsed() const noexcept {
+        return m_bytes_used;
+    }
+
+    /// @brief Bytes allocated for chunks (including unused tail space)
+    [[nodiscard]] std::size_t bytesReserved() const noexcept {
+        return m_bytes_reserved;
+    }
+
+    /// @brief Number of allocated chunks
+    [[nodiscard]] std::size_t chunkCount() const noexcept {
+        return m_chunks.size();
+    }
+
+    /// @brief The resource chunks come from, for building a replacement pool
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept {
+        return m_resource;
+    }
+
+  private:
+    struct ChunkDeleter {
+        std::pmr::memory_resource* resource = nullptr;
+        std::size_t capacity = 0;
+
+        void operator()(char* data) const noexcept {
+            resource->deallocate(data, capacity, 1);
+        }
+    };
+
+    struct Chunk {
+        std::unique_ptr<char[], ChunkDeleter> data;
+        std::size_t capacity = 0;
+        std::size_t used = 0;
+    };
+
+    [[nodiscard]] std::string_view append(std::string_view text);
+
+    std::size_t m_chunk_size = DEFAULT_CHUNK_SIZE;
+    std::pmr::memory_resource* m_resource = std::pmr::get_default_resource();
+    std::vector<Chunk> m_chunks;
+    // (chunk start address, chunk index) sorted by address for owns()
+    std::vector<std::pair<std::uintptr_t, std::size_t>> m_chunk_index;
+    std::unordered_set<std::string_view> m_small_strings;
+    std::size_t m_bytes_used = 0;
+    std::size_t m_bytes_reserved = 0;
+};
+
+} // namespace WorkBalance::Core
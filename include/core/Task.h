@@ -1,17 +1,28 @@
 #pragma once
 
+#include "MemoryAccounting.h"
+#include "StringPool.h"
+#include "TaskHistory.h"
+
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 namespace WorkBalance::Core {
+/// @brief A unit of work tracked in pomodoros
+/// @note `name` is a view: tasks owned by a TaskManager point into its StringPool,
+///       tasks in PersistentData point into PersistentData::task_names.
 struct Task {
-    std::string name;
+    std::string_view name;
     bool completed = false;
     int estimated_pomodoros = 1;
     int completed_pomodoros = 0;
+    /// Unix time (seconds) when the task was last marked completed, 0 if unknown
+    std::int64_t completed_at = 0;
 
     [[nodiscard]] bool isComplete() const noexcept;
 
@@ -20,6 +31,11 @@ struct Task {
 
 class TaskManager {
   public:
+    TaskManager() = default;
+
+    /// @brief Construct with a custom time source for edit coalescing (useful for testing)
+    explicit TaskManager(std::shared_ptr<ITimeSource> time_source);
+
     void addTask(std::string_view name, int estimated_pomodoros = 1);
 
     void removeTask(size_t index);
@@ -28,10 +44,33 @@ class TaskManager {
 
     void toggleTaskCompletion(size_t index);
 
-    void incrementTaskPomodoros(size_t index);
+    /// @brief Count a finished pomodoro towards a task
+    /// @param record_history false when the timer finished it rather than the user, so undo
+    ///        only ever reverts the user's own edits
+    void incrementTaskPomodoros(size_t index, bool record_history = true);
 
     void moveTask(size_t from_index, size_t to_index);
 
+    /// @brief Replace all tasks, taking ownership of the arena their names live in
+    /// @param tasks Tasks whose names point into `names` (other names are re-interned)
+    /// @param names The arena backing the task names; moved in without copying strings
+    void adoptTasks(std::vector<Task> tasks, StringPool names);
+
+    /// @brief Append a fully specified task, e.g. one restored from the archive
+    /// @note Not an undoable edit: undo would drop the task after it left the archive.
+    void restoreTask(const Task& task);
+
+    /// @brief Completed tasks finished before the cutoff, without removing them
+    /// @param cutoff Unix time (seconds); tasks with `completed_at < cutoff` are returned
+    /// @return Copies in list order. Their names stay valid until the next edit.
+    [[nodiscard]] std::vector<Task> getCompletedBefore(std::int64_t cutoff) const;
+
+    /// @brief Remove completed tasks finished before the cutoff so they can be archived
+    /// @param cutoff Unix time (seconds); tasks with `completed_at < cutoff` are taken
+    /// @return The removed tasks, in list order. Their names stay valid until the next edit.
+    /// @note Drops the undo history, since recorded positions no longer line up.
+    [[nodiscard]] std::vector<Task> takeCompletedBefore(std::int64_t cutoff);
+
     [[nodiscard]] std::vector<const Task*> getIncompleteTasks() const;
 
     [[nodiscard]] std::span<const Task> getTasks() const noexcept;
@@ -46,12 +85,60 @@ class TaskManager {
     [[nodiscard]] int getCompletedPomodoros() const noexcept;
     [[nodiscard]] int getTargetPomodoros() const noexcept;
 
-    void clear() noexcept;
+    /// @brief Counter bumped by every change to the task list, including undo and redo
+    [[nodiscard]] std::uint64_t getRevision() const noexcept {
+        return m_revision;
+    }
+
+    /// @brief Get the arena that owns the task names
+    [[nodiscard]] const StringPool& getNamePool() const noexcept {
+        return m_names;
+    }
+
+    /// @brief Revert the most recent edit (or batch of edits)
+    /// @return true if anything changed
+    bool undo();
+
+    /// @brief Re-apply the most recently undone edit (or batch of edits)
+    /// @return true if anything changed
+    bool redo();
+
+    [[nodiscard]] bool canUndo() const noexcept {
+        return m_history.canUndo();
+    }
+    [[nodiscard]] bool canRedo() const noexcept {
+        return m_history.canRedo();
+    }
+
+    /// @brief Group the following edits into a single undo step until endBatch()
+    void beginBatch() noexcept {
+        m_history.beginBatch();
+    }
+    void endBatch() noexcept {
+        m_history.endBatch();
+    }
+
+    [[nodiscard]] TaskHistory& getHistory() noexcept {
+        return m_history;
+    }
+    [[nodiscard]] const TaskHistory& getHistory() const noexcept {
+        return m_history;
+    }
+
+    void clear();
 
   private:
+    void revert(TaskEdit& edit);
+    void rotateTask(size_t from_index, size_t to_index) noexcept;
     void updateCounters() noexcept;
+    void releaseName(std::string_view name) noexcept;
+    void compactNamesIfWasteful();
 
     std::vector<Task> m_tasks;
+    StringPool m_names{StringPool::DEFAULT_CHUNK_SIZE, MemoryAccounting::resource(MemoryTag::Tasks)};
+    TaskHistory m_history;
+    size_t m_released_name_bytes = 0;
+    std::uint64_t m_revision = 0;
     int m_completed_pomodoros = 0;
     int m_target_pomodoros = 0;
 };
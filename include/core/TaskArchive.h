@@ -0,0 +1,85 @@
+#pragma once
+
+#include "MemoryAccounting.h"
+#include "Persistence.h"
+#include "StringPool.h"
+#include "Task.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WorkBalance::Core {
+
+/// @brief A task read back from the archive
+struct ArchivedTask {
+    std::uint64_t id = 0; ///< Stable handle for restore()
+    std::string name;
+    std::int64_t completed_at = 0;
+    int estimated_pomodoros = 1;
+    int completed_pomodoros = 0;
+};
+
+/// @brief Append-only cold storage for completed tasks
+///
+/// Old completed tasks are moved out of the TaskManager into a line-based file so the
+/// live list, counters and the main config only carry active work. Appending never
+/// reads the file; the in-memory index is built on the first search() or restore().
+/// Restoring writes a tombstone line instead of rewriting the file.
+class TaskArchive {
+  public:
+    static constexpr std::string_view DEFAULT_FILENAME = "workbalance_archive.tsv";
+    static constexpr std::size_t DEFAULT_SEARCH_LIMIT = 50;
+
+    explicit TaskArchive(std::filesystem::path path);
+
+    /// @brief Append tasks to the archive file
+    [[nodiscard]] std::expected<void, PersistenceError> append(std::span<const Task> tasks);
+
+    /// @brief Find archived tasks whose name contains the query (case-insensitive), newest first
+    /// @param query Substring to match; empty matches everything
+    /// @param max_results Maximum number of results
+    [[nodiscard]] std::expected<std::vector<ArchivedTask>, PersistenceError>
+    search(std::string_view query, std::size_t max_results = DEFAULT_SEARCH_LIMIT);
+
+    /// @brief Remove a task from the archive and return it
+    /// @param id Handle from a previous search()
+    [[nodiscard]] std::expected<ArchivedTask, PersistenceError> restore(std::uint64_t id);
+
+    /// @brief Number of tasks currently archived (loads the index)
+    [[nodiscard]] std::expected<std::size_t, PersistenceError> size();
+
+    /// @brief Whether the index has been read from disk yet
+    [[nodiscard]] bool isIndexLoaded() const noexcept {
+        return m_index_loaded;
+    }
+
+    [[nodiscard]] const std::filesystem::path& getPath() const noexcept {
+        return m_path;
+    }
+
+  private:
+    struct IndexEntry {
+        std::uint64_t offset = 0; ///< Byte offset of the record line, used as the id
+        std::int64_t completed_at = 0;
+        std::int32_t estimated_pomodoros = 1;
+        std::int32_t completed_pomodoros = 0;
+        std::string_view name;
+    };
+
+    [[nodiscard]] std::expected<void, PersistenceError> loadIndex();
+    [[nodiscard]] std::expected<void, PersistenceError> appendRaw(const std::string& lines);
+    [[nodiscard]] static ArchivedTask toArchivedTask(const IndexEntry& entry);
+
+    std::filesystem::path m_path;
+    std::vector<IndexEntry> m_entries; // sorted by offset
+    StringPool m_names{StringPool::DEFAULT_CHUNK_SIZE, MemoryAccounting::resource(MemoryTag::Tasks)};
+    bool m_index_loaded = false;
+};
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "ITimeSource.h"
+#include "MemoryAccounting.h"
+#include "StringPool.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string_view>
+
+namespace WorkBalance::Core {
+
+/// @brief A single reversible task operation, stored as the data needed to invert it
+///
+/// Only the fields named in `fields` are meaningful. Reverting an edit turns it into
+/// its own inverse, so the same record moves between the undo and redo stacks.
+struct TaskEdit {
+    enum class Kind : std::uint8_t {
+        Added,    ///< Task inserted at `index`
+        Removed,  ///< Task with the carried fields removed from `index`
+        Modified, ///< Carried fields are the values before the change
+        Moved     ///< Task moved from `index` to `position`
+    };
+
+    /// @brief Bit flags for the task fields carried by an edit
+    enum Field : std::uint8_t {
+        Name = 1U << 0U,
+        Estimated = 1U << 1U,
+        CompletedPomodoros = 1U << 2U,
+        Completed = 1U << 3U,
+        AllFields = Name | Estimated | CompletedPomodoros | Completed
+    };
+
+    Kind kind = Kind::Modified;
+    std::uint8_t fields = 0;
+    bool completed = false;
+    std::uint32_t index = 0;
+    std::uint32_t position = 0;
+    std::uint32_t group = 0;
+    std::int32_t estimated_pomodoros = 0;
+    std::int32_t completed_pomodoros = 0;
+    std::int64_t completed_at = 0; ///< Travels with `completed`, so undo keeps the archive clock
+    std::string_view name;
+};
+
+/// @brief Bounded undo/redo log of task edits
+///
+/// Consecutive edits to the same task within the coalesce window merge into one entry.
+/// Edits recorded between beginBatch() and endBatch() share a group and are undone together.
+/// When the log exceeds its memory limit the oldest groups are dropped.
+class TaskHistory {
+  public:
+    static constexpr std::size_t DEFAULT_MEMORY_LIMIT = 64 * 1024;
+    static constexpr std::chrono::milliseconds DEFAULT_COALESCE_WINDOW{1000};
+
+    explicit TaskHistory(std::shared_ptr<ITimeSource> time_source = createDefaultTimeSource());
+
+    /// @brief Record a new edit, discarding anything that could be redone
+    void record(TaskEdit edit);
+
+    /// @brief Drop the newest step if undoing it would leave the task as it is now
+    ///
+    /// Coalescing can fold a change and its reversal (a toggle clicked twice) into one step
+    /// that restores nothing.
+    /// @param current Snapshot of the edited task after the change, carrying all fields
+    void dropIfUnchanged(const TaskEdit& current) noexcept;
+
+    /// @brief Start grouping edits into a single undo step (nestable)
+    void beginBatch() noexcept;
+
+    /// @brief Close the current batch
+    void endBatch() noexcept;
+
+    /// @brief Prevent the next edit from merging into the previous one
+    void breakCoalescing() noexcept {
+        m_coalesce_open = false;
+    }
+
+    /// @brief Revert the most recent group
+    /// @param revert Callable taking TaskEdit& that applies the inverse and rewrites the edit into it
+    /// @return true if anything was undone
+    template <typename Revert>
+    bool undo(Revert&& revert) {
+        return transfer(m_undo, m_redo, revert);
+    }
+
+    /// @brief Re-apply the most recently undone group
+    /// @param revert Same contract as undo()
+    /// @return true if anything was redone
+    template <typename Revert>
+    bool redo(Revert&& revert) {
+        return transfer(m_redo, m_undo, revert);
+    }
+
+    [[nodiscard]] bool canUndo() const noexcept {
+        return !m_undo.empty();
+    }
+    [[nodiscard]] bool canRedo() const noexcept {
+        return !m_redo.empty();
+    }
+
+    /// @brief Number of recorded edits (not groups) that can be undone
+    [[nodiscard]] std::size_t undoCount() const noexcept {
+        return m_undo.size();
+    }
+    [[nodiscard]] std::size_t redoCount() const noexcept {
+        return m_redo.size();
+    }
+
+    /// @brief Approximate bytes held by both stacks
+    [[nodiscard]] std::size_t memoryUsage() const noexcept {
+        return m_memory_used;
+    }
+    [[nodiscard]] std::size_t getMemoryLimit() const noexcept {
+        return m_memory_limit;
+    }
+    void setMemoryLimit(std::size_t bytes);
+
+    void setCoalesceWindow(std::chrono::milliseconds window) noexcept {
+        m_coalesce_window = window;
+    }
+
+    /// @brief Drop all history
+    void clear() noexcept;
+
+  private:
+    template <typename Revert>
+    bool transfer(std::deque<TaskEdit>& from, std::deque<TaskEdit>& to, Revert& revert) {
+        if (from.empty()) {
+            return false;
+        }
+
+        const std::uint32_t group = from.back().group;
+        while (!from.empty() && from.back().group == group) {
+            TaskEdit edit = from.back();
+            from.pop_back();
+            m_memory_used -= costOf(edit);
+
+            revert(edit);
+            storeName(edit);
+
+            m_memory_used += costOf(edit);
+            to.push_back(edit);
+        }
+
+        m_coalesce_open = false;
+        return true;
+    }
+
+    [[nodiscard]] static bool tryCoalesce(TaskEdit& last, const TaskEdit& edit) noexcept;
+    [[nodiscard]] static bool carriesSameValues(const TaskEdit& edit, const TaskEdit& current) noexcept;
+    [[nodiscard]] static std::size_t costOf(const TaskEdit& edit) noexcept;
+    void storeName(TaskEdit& edit);
+    void clearRedo() noexcept;
+    void trimToLimit();
+    void compactNamesIfWasteful();
+
+    std::shared_ptr<ITimeSource> m_time_source;
+    std::deque<TaskEdit> m_undo;
+    std::deque<TaskEdit> m_redo;
+    StringPool m_names{1024, MemoryAccounting::resource(MemoryTag::Tasks)};
+    std::size_t m_memory_limit = DEFAULT_MEMORY_LIMIT;
+    std::size_t m_memory_used = 0;
+    std::chrono::milliseconds m_coalesce_window = DEFAULT_COALESCE_WINDOW;
+    std::chrono::steady_clock::time_point m_last_record_time{};
+    bool m_coalesce_open = false;
+    std::uint32_t m_next_group = 1;
+    std::uint32_t m_batch_group = 0;
+    std::uint32_t m_batch_depth = 0;
+};
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Persistence.h"
+
+namespace WorkBalance::Core {
+
+/// @brief Fixed-size record of the latest trace events of one thread
+///
+/// Only the owning thread pushes. Any thread may take a snapshot at any time without
+/// stopping the writer: slots overwritten while they were being copied are left out.
+class TraceRing {
+  public:
+    struct Event {
+        const char* name = nullptr;
+        std::int64_t start_ns = 0;
+        std::int64_t duration_ns = 0;
+    };
+
+    /// @param capacity Events kept; rounded up to a power of two
+    explicit TraceRing(std::size_t capacity);
+
+    /// @brief Appends an event, overwriting the oldest once full; owning thread only
+    void push(const char* name, std::int64_t start_ns, std::int64_t duration_ns) noexcept {
+        const std::uint64_t index = m_head.load(std::memory_order_relaxed);
+        Slot& slot = m_slots[index & m_mask];
+        // Release: a reader that sees any of the new values also sees the head published before
+        // them, and so knows the slot was overwritten (see snapshot())
+        slot.name.store(name, std::memory_order_release);
+        slot.start_ns.store(start_ns, std::memory_order_release);
+        slot.duration_ns.store(duration_ns, std::memory_order_release);
+        m_head.store(index + 1, std::memory_order_release);
+    }
+
+    /// @brief Copies the retained events, oldest first; safe from any thread
+    [[nodiscard]] std::vector<Event> snapshot() const;
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return m_mask + 1;
+    }
+
+  private:
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<std::int64_t> start_ns{0};
+        std::atomic<std::int64_t> duration_ns{0};
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_mask;
+    std::atomic<std::uint64_t> m_head{0};
+};
+
+/// @brief Collects timed zones from every thread and exports them as a Chrome trace
+///
+/// Each thread records into its own TraceRing, so recording takes no lock; a thread's ring
+/// is created (under a lock) the first time it records. The export is the JSON trace-event
+/// format read by Perfetto (ui.perfetto.dev) and chrome://tracing. Recording is off until
+/// setEnabled(true); while off, a TraceZone costs one atomic load.
+///
+/// Example usage:
+/// @code
+/// Tracer::instance().setEnabled(true);
+/// {
+///     const TraceZone zone{"PersistenceManager::save"};
+///     save();
+/// }
+/// (void)Tracer::instance().writeChromeTrace("trace.json");
+/// @endcode
+class Tracer {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /// About 10 seconds of the main loop at 144 frames per second
+    static constexpr std::size_t DEFAULT_EVENTS_PER_THREAD = 16384;
+    static constexpr std::string_view DEFAULT_FILENAME = "trace.json";
+
+    /// @brief The process-wide tracer that TraceZone records into by default
+    [[nodiscard]] static Tracer& instance();
+
+    explicit Tracer(std::size_t events_per_thread = DEFAULT_EVENTS_PER_THREAD);
+    ~Tracer();
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    void setEnabled(bool enabled) noexcept {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool isEnabled() const noexcept {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Records a finished zone on the calling thread's ring
+    /// @param name Must outlive the tracer; zone names are string literals
+    void record(const char* name, Clock::time_point start, Clock::time_point end) noexcept;
+
+    /// @brief Names the calling thread in exported traces (threads are "thread N" otherwise)
+    void setThreadName(std::string_view name);
+
+    /// @brief Leaves events recorded before now out of later exports
+    void clear() noexcept;
+
+    /// @brief Every retained event as a Chrome trace-event JSON document
+    [[nodiscard]] std::string toChromeTraceJson() const;
+
+    /// @brief Replaces @p path with toChromeTraceJson()
+    [[nodiscard]] std::expected<void, PersistenceError> writeChromeTrace(const std::filesystem::path& path) const;
+
+  private:
+    struct ThreadRing {
+        ThreadRing(std::thread::id thread_id, std::uint32_t trace_tid, std::size_t capacity)
+            : thread(thread_id), tid(trace_tid), ring(capacity) {
+        }
+
+        std::thread::id thread;
+        std::uint32_t tid;
+        std::string name;
+        TraceRing ring;
+    };
+
+    [[nodiscard]] TraceRing* ringForCurrentThread();
+    [[nodiscard]] ThreadRing& findOrAddThread();
+    [[nodiscard]] std::int64_t sinceOrigin(Clock::time_point time) const noexcept;
+
+    const std::uint64_t m_id; // Tells this tracer's rings apart in the per-thread cache
+    const Clock::time_point m_origin;
+    const std::size_t m_events_per_thread;
+    std::atomic<bool> m_enabled{false};
+    std::atomic<std::int64_t> m_cleared_at_ns{0};
+    mutable std::mutex m_mutex; // Guards m_threads, not the rings
+    std::vector<std::unique_ptr<ThreadRing>> m_threads;
+};
+
+/// @brief Times the enclosing scope as a named zone; does nothing while the tracer is disabled
+class TraceZone {
+  public:
+    explicit TraceZone(const char* name, Tracer& tracer = Tracer::instance()) noexcept
+        : m_tracer(tracer.isEnabled() ? &tracer : nullptr), m_name(name),
+          m_start(m_tracer != nullptr ? Tracer::Clock::now() : Tracer::Clock::time_point{}) {
+    }
+
+    TraceZone(const TraceZone&) = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+    ~TraceZone() {
+        if (m_tracer != nullptr) {
+            m_tracer->record(m_name, m_start, Tracer::Clock::now());
+        }
+    }
+
+  private:
+    Tracer* m_tracer;
+    const char* m_name;
+    Tracer::Clock::time_point m_start;
+};
+
+} // namespace WorkBalance::Core
@@ -2,7 +2,9 @@
 
 #include <chrono>
 #include <functional>
+#include <memory>
 
+#include "ITimeSource.h"
 #include "WellnessTypes.h"
 
 namespace WorkBalance::Core {
@@ -16,7 +18,9 @@ class WellnessTimer {
     /// @param type The wellness type this timer tracks
     /// @param interval_seconds The interval between reminders
     /// @param break_duration_seconds Optional break duration (for standup/eye strain)
-    explicit WellnessTimer(WellnessType type, int interval_seconds, int break_duration_seconds = 0) noexcept;
+    /// @param time_source Clock the timer counts against (a MockTimeSource in tests)
+    explicit WellnessTimer(WellnessType type, int interval_seconds, int break_duration_seconds = 0,
+                           std::shared_ptr<ITimeSource> time_source = createDefaultTimeSource()) noexcept;
 
     /// @brief Updates the timer state
     /// @return true if the timer completed (interval or break)
@@ -86,6 +90,7 @@ class WellnessTimer {
     void resetDailyCounters() noexcept;
 
   private:
+    std::shared_ptr<ITimeSource> m_time_source;
     WellnessType m_type;
     int m_interval_seconds;
     int m_break_duration_seconds;
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <controllers/TimerController.h>
+#include <controllers/WellnessController.h>
+#include <core/ITimeSource.h>
+#include <core/Persistence.h>
+#include <core/PomodoroCycle.h>
+#include <core/RemoteProtocol.h>
+#include <core/Task.h>
+#include <core/Timer.h>
+#include <system/IAudioService.h>
+#include <system/INotificationService.h>
+
+#include <memory>
+
+namespace WorkBalance::Daemon {
+
+/// @brief Timers, reminders and tasks running without any window or GPU
+///
+/// Drives the same core engine as the GUI from the user's saved settings and reports through
+/// the audio and notification services. Both services are optional.
+class HeadlessSession {
+  public:
+    /// @param data Saved state, as loaded by Core::PersistenceManager
+    /// @param audio Plays reminder sounds (can be nullptr)
+    /// @param notifications Shows timer and reminder notifications (can be nullptr)
+    HeadlessSession(Core::PersistentData data, System::IAudioService* audio,
+                    System::INotificationService* notifications,
+                    std::shared_ptr<Core::ITimeSource> time_source = Core::createDefaultTimeSource());
+
+    /// @brief Advances the timers and fires due reminders
+    /// @return true if the pomodoro timer completed, i.e. there is progress worth saving
+    bool update();
+
+    /// @brief Carries out a command forwarded by a `WorkBalance --...` launch
+    [[nodiscard]] Core::RemoteReply handleCommand(const Core::RemoteCommand& command);
+
+    /// @brief Settings as loaded plus the current tasks, for Core::PersistenceManager::save()
+    /// Task names point into this session, which must outlive the save
+    [[nodiscard]] Core::PersistentData snapshot() const;
+
+    [[nodiscard]] Core::SessionStatus getStatus() const;
+
+    /// @brief True once a Quit command was received
+    [[nodiscard]] bool isQuitRequested() const noexcept {
+        return m_quit_requested;
+    }
+
+    [[nodiscard]] const Core::Timer& getTimer() const noexcept {
+        return m_timer;
+    }
+
+  private:
+    void handleTimerComplete();
+    void handleWellnessTimerComplete(Core::WellnessType type);
+    [[nodiscard]] Core::RemoteReply startBreak(Core::BreakKind kind);
+    void playSound(bool enabled, int volume, void (System::IAudioService::*sound)());
+    [[nodiscard]] bool canNotify(bool enabled) const;
+
+    Core::UserSettings m_settings;
+    System::IAudioService* m_audio;
+    System::INotificationService* m_notifications;
+    Core::Timer m_timer;
+    Controllers::TimerController m_timer_controller;
+    Controllers::WellnessController m_wellness;
+    Core::TaskManager m_tasks;
+    Core::PomodoroCycle m_cycle;
+    int m_current_task_index;
+    bool m_quit_requested = false;
+};
+
+} // namespace WorkBalance::Daemon
@@ -3,9 +3,10 @@
 #include "IAudioService.h"
 #include "assets/sounds/miniaudio.h"
 
-#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <span>
 
 namespace WorkBalance::System {
 class AudioManager final : public IAudioService {
@@ -28,7 +29,7 @@ class AudioManager final : public IAudioService {
     [[nodiscard]] int getVolume() const noexcept override;
 
   private:
-    void playEmbeddedSound(const unsigned char* data, size_t size);
+    void playEmbeddedSound(std::span<const std::uint8_t> wav);
     void stopNotificationSounds();
     void cleanupTempFile();
 
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "INotificationService.h"
+
+#include <core/MpscQueue.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+// libdbus connection handle; only DBusNotificationService.cpp includes <dbus/dbus.h>
+struct DBusConnection;
+
+namespace WorkBalance::System {
+
+struct NotificationText;
+
+/// @brief Desktop notifications through the org.freedesktop.Notifications service on D-Bus
+///
+/// Talks to the bus through libdbus. The show*() calls only queue the notification. A worker
+/// thread owns the bus connection and makes the Notify calls, so a slow or hung notification
+/// daemon never stalls the main loop; if it falls QUEUE_CAPACITY notifications behind, newer
+/// ones are dropped. The id the daemon returns for a title is passed as replaces_id the next
+/// time that title is shown, so a repeated reminder updates its popup instead of stacking another one.
+class DBusNotificationService final : public INotificationService {
+  public:
+    static constexpr std::string_view SERVICE_NAME = "org.freedesktop.Notifications";
+    static constexpr std::string_view OBJECT_PATH = "/org/freedesktop/Notifications";
+    static constexpr std::string_view INTERFACE_NAME = "org.freedesktop.Notifications";
+    static constexpr std::string_view APP_NAME = "WorkBalance";
+    static constexpr std::size_t QUEUE_CAPACITY = 16;
+    static constexpr std::chrono::milliseconds DEFAULT_CALL_TIMEOUT{2000};
+
+    /// @param bus_address D-Bus address of the bus to notify on; empty means the session bus
+    /// @param call_timeout How long the worker waits for the daemon to answer one notification.
+    ///        The destructor waits for a call in flight, so this also bounds shutdown.
+    explicit DBusNotificationService(std::string bus_address = {},
+                                     std::chrono::milliseconds call_timeout = DEFAULT_CALL_TIMEOUT);
+    ~DBusNotificationService() override;
+
+    // Non-copyable, non-movable: the worker thread points back at this object
+    DBusNotificationService(const DBusNotificationService&) = delete;
+    DBusNotificationService& operator=(const DBusNotificationService&) = delete;
+    DBusNotificationService(DBusNotificationService&&) = delete;
+    DBusNotificationService& operator=(DBusNotificationService&&) = delete;
+
+    /// @brief Starts the worker thread; connecting to the bus is left to it
+    /// @return false if there is no bus address to connect to
+    [[nodiscard]] bool initialize() override;
+    [[nodiscard]] bool isSupported() const noexcept override;
+
+    void showNotification(std::string_view title, std::string_view message) override;
+    void showPomodoroComplete() override;
+    void showShortBreakComplete() override;
+    void showLongBreakComplete() override;
+    void showWaterReminder() override;
+    void showStandupReminder() override;
+    void showEyeCareReminder() override;
+
+    /// @brief Notifications dropped because the queue was full
+    [[nodiscard]] std::size_t droppedCount() const noexcept {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    /// @brief The session bus address from DBUS_SESSION_BUS_ADDRESS, empty if it is not set
+    [[nodiscard]] static std::string sessionBusAddress();
+
+  private:
+    struct Request {
+        std::string title;
+        std::string message;
+    };
+
+    /// @brief Closes and releases a private libdbus connection
+    struct ConnectionDeleter {
+        void operator()(::DBusConnection* connection) const noexcept;
+    };
+
+    void show(const NotificationText& text);
+    void run(const std::stop_token& stop);
+    bool connect();
+    void deliver(const Request& request);
+
+    std::string m_bus_address;
+    std::chrono::milliseconds m_call_timeout;
+    bool m_supported = false;
+
+    Core::MpscQueue<Request, QUEUE_CAPACITY> m_queue;
+    /// @brief Bumped after every push so the idle worker can wait on it
+    std::atomic<std::uint32_t> m_wakeups{0};
+    std::atomic<std::size_t> m_dropped{0};
+
+    // Only touched by the worker thread
+    std::unique_ptr<::DBusConnection, ConnectionDeleter> m_connection;
+    std::unordered_map<std::string, std::uint32_t> m_notification_ids;
+    bool m_warned = false;
+
+    // Last, so the worker stops before anything it uses is destroyed
+    std::jthread m_worker;
+};
+
+} // namespace WorkBalance::System
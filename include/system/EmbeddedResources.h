@@ -0,0 +1,33 @@
+#pragma once
+
+#include <core/ResourcePack.h>
+
+#include <string_view>
+
+namespace WorkBalance::System {
+
+/// @brief Names of the entries in the embedded resource pack
+///
+/// They must match the name=file pairs in WORKBALANCE_RESOURCES in CMakeLists.txt.
+namespace Resources {
+inline constexpr std::string_view CLICK_SOUND = "sounds/click.wav";
+inline constexpr std::string_view BELL_SOUND = "sounds/bell.wav";
+inline constexpr std::string_view HYDRATION_SOUND = "sounds/hydration.wav";
+inline constexpr std::string_view WALK_SOUND = "sounds/walk.wav";
+
+inline constexpr std::string_view ROBOTO_MEDIUM_FONT = "fonts/Roboto-Medium.ttf";
+inline constexpr std::string_view FONT_AWESOME_FONT = "fonts/fa-solid-900.ttf";
+inline constexpr std::string_view FORMULA1_BOLD_FONT = "fonts/Formula1-Bold.otf";
+inline constexpr std::string_view FORMULA1_WIDE_FONT = "fonts/Formula1-Wide.otf";
+inline constexpr std::string_view FORMULA1_REGULAR_FONT = "fonts/Formula1-Regular.otf";
+
+inline constexpr std::string_view APP_ICON = "icons/app_icon.icons"; // Core::IconSet
+} // namespace Resources
+
+/// @brief The asset pack linked into the executable
+///
+/// Entries are decompressed on first use and stay resident; the returned pack is safe to
+/// use from any thread.
+[[nodiscard]] Core::ResourcePack& getEmbeddedResources();
+
+} // namespace WorkBalance::System
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "MonitorTopology.h"
 #include "WindowBase.h"
 
 #include <string_view>
@@ -8,7 +9,10 @@ namespace WorkBalance::System {
 
 class MainWindow final : public WindowBase {
   public:
-    MainWindow(int width, int height, std::string_view title);
+    /// @param width Logical width of the normal window; scaled for the monitor's DPI
+    /// @param height Logical height used when no monitor work area is known
+    /// @param monitors Must outlive the window
+    MainWindow(int width, int height, std::string_view title, const MonitorTopology& monitors);
 
     void setOverlayMode(bool overlay_mode);
 
@@ -18,6 +22,10 @@ class MainWindow final : public WindowBase {
     /// @brief Get the saved overlay position
     [[nodiscard]] std::pair<int, int> getSavedOverlayPosition() const noexcept;
 
+    /// @brief Logical-to-screen-coordinate scale for the monitor the window is on
+    /// @see Core::DisplayLayout::uiScale
+    [[nodiscard]] float uiScale() const noexcept;
+
     MainWindow(const MainWindow&) = delete;
     MainWindow& operator=(const MainWindow&) = delete;
 
@@ -26,13 +34,18 @@ class MainWindow final : public WindowBase {
 
   private:
     void setupOpenGLContext() const;
-    void centerOnMonitor(int width, int height) const;
+    [[nodiscard]] const MonitorInfo* currentMonitor() const noexcept;
+    void centerOnMonitor(int width, int height);
     void applyRoundedCorners() const;
     void setWindowIcon() const;
-    void resizeForOverlay() const;
-    void resizeForNormal() const;
+    void resizeForOverlay();
+    void resizeForNormal();
     [[nodiscard]] int getFullHeight() const;
 
+    const MonitorTopology* m_monitors = nullptr;
+    int m_normal_width = 0;
+    int m_fallback_height = 0;
+
     // Saved position for restoring after overlay mode
     int m_saved_normal_x = -1;
     int m_saved_normal_y = -1;
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <GLFW/glfw3.h>
+#include <core/DisplayLayout.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace WorkBalance::System {
+
+/// @brief What the window code needs to know about one monitor
+struct MonitorInfo {
+    GLFWmonitor* handle = nullptr;
+    Core::ScreenRect bounds;    ///< Current video mode at the monitor's position
+    Core::ScreenRect work_area; ///< Bounds less taskbars, docks and panels
+    float content_scale = 1.0f;
+    bool primary = false;
+};
+
+/// @brief Cached list of connected monitors, refreshed when GLFW reports a connect or disconnect
+///
+/// Layout code reads monitors, work areas and content scales from here instead of querying
+/// GLFW on every mode switch. Construct after GLFWManager; only one instance may exist at a
+/// time, since GLFW has a single monitor callback. A monitor callback installed before this
+/// one keeps being called.
+class MonitorTopology {
+  public:
+    MonitorTopology();
+    ~MonitorTopology();
+
+    MonitorTopology(const MonitorTopology&) = delete;
+    MonitorTopology& operator=(const MonitorTopology&) = delete;
+    MonitorTopology(MonitorTopology&&) = delete;
+    MonitorTopology& operator=(MonitorTopology&&) = delete;
+
+    /// @brief Re-reads every monitor from GLFW
+    void refresh();
+
+    [[nodiscard]] std::span<const MonitorInfo> monitors() const noexcept {
+        return m_monitors;
+    }
+
+    /// @brief The primary monitor, or nullptr when none is connected
+    [[nodiscard]] const MonitorInfo* primary() const noexcept;
+
+    /// @brief The monitor containing the centre of @p rect, falling back to the primary
+    [[nodiscard]] const MonitorInfo* monitorFor(const Core::ScreenRect& rect) const noexcept;
+
+    /// @brief Incremented by every refresh(), so callers can tell when their layout is stale
+    [[nodiscard]] std::uint64_t generation() const noexcept {
+        return m_generation;
+    }
+
+  private:
+    static void onMonitorChanged(GLFWmonitor* monitor, int event);
+
+    std::vector<MonitorInfo> m_monitors;
+    std::uint64_t m_generation = 0;
+    GLFWmonitorfun m_previous_callback = nullptr;
+};
+
+} // namespace WorkBalance::System
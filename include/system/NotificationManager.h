@@ -6,6 +6,8 @@
 
 namespace WorkBalance::System {
 
+struct NotificationText;
+
 class NotificationManager final : public INotificationService {
   public:
     NotificationManager();
@@ -29,6 +31,8 @@ class NotificationManager final : public INotificationService {
     void showEyeCareReminder() override;
 
   private:
+    void show(const NotificationText& text);
+
     bool m_initialized = false;
     bool m_supported = false;
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string_view>
+
+namespace WorkBalance::System {
+
+/// @brief Title and body of one notification
+struct NotificationText {
+    std::string_view title;
+    std::string_view message;
+};
+
+/// @brief What every INotificationService backend shows for the timer and wellness events
+namespace NotificationTexts {
+inline constexpr NotificationText POMODORO_COMPLETE{"Pomodoro Complete! \xF0\x9F\x8E\x89",
+                                                    "Great work! Time for a well-deserved break."};
+inline constexpr NotificationText SHORT_BREAK_COMPLETE{"Break's Over! \xF0\x9F\x92\xAA",
+                                                       "Ready to focus? Let's get back to work!"};
+inline constexpr NotificationText LONG_BREAK_COMPLETE{"Long Break Complete! \xE2\x9C\xA8",
+                                                      "Feeling refreshed? Time to start a new cycle!"};
+inline constexpr NotificationText WATER_REMINDER{"Stay Hydrated! \xF0\x9F\x92\xA7",
+                                                 "Time to drink some water. Your body will thank you!"};
+inline constexpr NotificationText STANDUP_REMINDER{"Time to Move! \xF0\x9F\x9A\xB6",
+                                                   "Stand up, stretch, and take a short walk."};
+inline constexpr NotificationText EYE_CARE_REMINDER{"Eye Break! \xF0\x9F\x91\x80",
+                                                    "Look at something 20 feet away for 20 seconds."};
+} // namespace NotificationTexts
+
+} // namespace WorkBalance::System
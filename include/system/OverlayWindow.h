@@ -3,10 +3,14 @@
 #include "WindowBase.h"
 #include <core/Configuration.h>
 
+#include <chrono>
+
 namespace WorkBalance::System {
 class OverlayWindow final : public WindowBase {
   public:
-    OverlayWindow();
+    /// @brief Prepares the overlay without creating it; see create()
+    /// @param shared_context Window whose GL objects (font atlas, shaders, buffers) the overlay reuses
+    explicit OverlayWindow(GLFWwindow* shared_context = nullptr);
     ~OverlayWindow() override = default;
 
     OverlayWindow(const OverlayWindow&) = delete;
@@ -15,16 +19,29 @@ class OverlayWindow final : public WindowBase {
     OverlayWindow& operator=(OverlayWindow&&) = delete;
 
     [[nodiscard]] bool isVisible() const noexcept {
-        return m_visible;
+        return m_window != nullptr && geometry().visible;
+    }
+
+    [[nodiscard]] bool isCreated() const noexcept {
+        return m_window != nullptr;
     }
 
+    /// @brief Creates the hidden window and its GL context if they do not exist yet
+    void create();
+
+    /// @brief Shows the window; does nothing until create() has been called
     void show();
     void hide();
 
+    /// @brief Destroys the window and its GL context once it has been hidden for at least @p delay
+    /// @return true if the window was destroyed by this call
+    bool releaseIfHiddenFor(std::chrono::steady_clock::duration delay);
+
   private:
     static void configureWindowHints();
 
-    bool m_visible = false;
+    GLFWwindow* m_shared_context = nullptr;
+    std::chrono::steady_clock::time_point m_hidden_since;
 };
 
 } // namespace WorkBalance::System
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <core/RemoteProtocol.h>
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace WorkBalance::System {
+
+/// @brief Keeps one WorkBalance process per user and lets later launches remote-control it
+///
+/// The first process takes an exclusive lock on a file in the config directory and listens on a
+/// local (AF_UNIX) socket next to it. Later launches fail to take the lock, forward their command
+/// over the socket and exit without initializing any windowing or audio.
+class SingleInstance {
+  public:
+    using CommandHandler = std::function<Core::RemoteReply(const Core::RemoteCommand&)>;
+
+    static constexpr std::string_view LOCK_FILENAME = "workbalance.lock";
+    static constexpr std::string_view SOCKET_FILENAME = "workbalance.sock";
+    static constexpr std::chrono::milliseconds DEFAULT_SEND_TIMEOUT{2000};
+
+    /// @brief Claims the instance lock in @p directory and, if it was free, starts listening
+    ///
+    /// If the lock file cannot be created at all this process runs as primary without a socket,
+    /// so a read-only or missing config directory never keeps the app from starting.
+    explicit SingleInstance(const std::filesystem::path& directory);
+    ~SingleInstance();
+
+    SingleInstance(const SingleInstance&) = delete;
+    SingleInstance& operator=(const SingleInstance&) = delete;
+    SingleInstance(SingleInstance&&) noexcept;
+    SingleInstance& operator=(SingleInstance&&) noexcept;
+
+    /// @brief True if this process owns the instance; false means another one is running
+    [[nodiscard]] bool isPrimary() const noexcept;
+
+    /// @brief Answers the commands queued by other launches without blocking
+    /// Should be called in the main loop of the primary instance
+    void processCommands(const CommandHandler& handler);
+
+    /// @brief Forwards @p command to the primary instance and waits for its reply
+    /// @return nullopt if no instance answered within @p timeout
+    [[nodiscard]] std::optional<Core::RemoteReply>
+    send(const Core::RemoteCommand& command, std::chrono::milliseconds timeout = DEFAULT_SEND_TIMEOUT) const;
+
+  private:
+    class Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+} // namespace WorkBalance::System
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "WindowGeometry.h"
+
 #include <GLFW/glfw3.h>
 #include <utility>
 
@@ -18,25 +20,82 @@ class GLFWManager {
 };
 
 // Base window class - common functionality
+//
+// Geometry reads are served from a cache that GLFW callbacks keep current, because on X11 and
+// Wayland each direct query is a round trip to the display server. setPosition() and setSize()
+// update the cache straight away, since X11 applies them asynchronously; the callbacks then
+// correct it if the window manager placed or sized the window differently.
 class WindowBase {
   public:
+    WindowBase() = default;
     virtual ~WindowBase();
 
+    WindowBase(const WindowBase&) = delete;
+    WindowBase& operator=(const WindowBase&) = delete;
+    WindowBase(WindowBase&&) = delete;
+    WindowBase& operator=(WindowBase&&) = delete;
+
     [[nodiscard]] GLFWwindow* get() const noexcept;
     [[nodiscard]] bool shouldClose() const noexcept;
 
     void swapBuffers() const noexcept;
 
+    [[nodiscard]] const WindowGeometry& geometry() const noexcept {
+        return m_geometry;
+    }
+
     [[nodiscard]] std::pair<int, int> getFramebufferSize() const noexcept;
 
     [[nodiscard]] std::pair<int, int> getPosition() const noexcept;
 
+    [[nodiscard]] std::pair<int, int> getSize() const noexcept;
+
+    /// @brief Cursor position in screen coordinates
+    [[nodiscard]] std::pair<double, double> getCursorScreenPosition() const noexcept;
+
     void setPosition(int x, int y) noexcept;
 
     void setSize(int width, int height) noexcept;
 
+    void show() noexcept;
+    void hide() noexcept;
+
   protected:
+    /// @brief Installs the geometry callbacks on m_window and seeds the cache with one query
+    /// @details Call after creating or adopting a window. Callbacks already set on the window,
+    /// such as ImGui's, keep being called.
+    void trackGeometry();
+
+    /// @brief Moves @p other's window, cached geometry and callbacks into this object
+    void takeWindow(WindowBase& other);
+
     GLFWwindow* m_window = nullptr;
+
+  private:
+    struct PreviousCallbacks {
+        GLFWwindowposfun position = nullptr;
+        GLFWwindowsizefun size = nullptr;
+        GLFWframebuffersizefun framebuffer = nullptr;
+        GLFWcursorposfun cursor = nullptr;
+        GLFWcursorenterfun cursor_enter = nullptr;
+        GLFWwindowfocusfun focus = nullptr;
+        GLFWwindowiconifyfun iconify = nullptr;
+        GLFWwindowcontentscalefun content_scale = nullptr;
+    };
+
+    [[nodiscard]] static WindowBase* find(GLFWwindow* window) noexcept;
+
+    static void onPosition(GLFWwindow* window, int x, int y);
+    static void onSize(GLFWwindow* window, int width, int height);
+    static void onFramebufferSize(GLFWwindow* window, int width, int height);
+    static void onCursorPosition(GLFWwindow* window, double x, double y);
+    static void onCursorEnter(GLFWwindow* window, int entered);
+    static void onFocus(GLFWwindow* window, int focused);
+    static void onIconify(GLFWwindow* window, int iconified);
+    static void onContentScale(GLFWwindow* window, float scale_x, float scale_y);
+
+    WindowGeometry m_geometry;
+    PreviousCallbacks m_previous;
 };
 
 } // namespace WorkBalance::System
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <utility>
+
+namespace WorkBalance::System {
+
+/// @brief Last window geometry reported by the window system
+/// @details Positions and sizes are in screen coordinates except the framebuffer, which is in pixels.
+/// Kept free of GLFW so the cache arithmetic can be tested.
+struct WindowGeometry {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    int framebuffer_width = 0;
+    int framebuffer_height = 0;
+    double cursor_x = 0.0; ///< Relative to the content area; only updated while over it or dragging
+    double cursor_y = 0.0;
+    float content_scale = 1.0f; ///< DPI scale of the monitor the window is on; horizontal
+    bool visible = false; ///< Set by WindowBase::show() and hide(), which have no GLFW callback
+    bool focused = false;
+    bool iconified = false;
+    bool hovered = false;
+
+    [[nodiscard]] std::pair<double, double> cursorScreenPosition() const noexcept {
+        return {cursor_x + x, cursor_y + y};
+    }
+
+    /// @brief Moves the window origin while the cursor stays where it is on screen
+    /// @details Moving a window under a still pointer sends no cursor event on X11, so the
+    /// cached cursor is rebased onto the new origin here instead.
+    void moveTo(int new_x, int new_y) noexcept {
+        cursor_x += x - new_x;
+        cursor_y += y - new_y;
+        x = new_x;
+        y = new_y;
+    }
+};
+
+} // namespace WorkBalance::System
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../core/Configuration.h"
+#include "../core/PomodoroCycle.h"
 #include "../core/Timer.h"
 #include "../core/Task.h"
 #include "../core/WellnessTypes.h"
@@ -40,6 +41,11 @@ struct AppState {
     bool show_add_task = false;
     bool show_timer_overlay = false;
     bool main_window_overlay_mode = false;
+    bool show_performance_hud = false; // Frame-time HUD, toggled with F2
+    bool show_metrics_panel = false;   // Debug panel, toggled with F3
+
+    // Set by views that animate with ImGui::GetTime() so the frame cache keeps redrawing
+    bool ui_animating = false;
 
     // ===== Navigation State =====
     NavigationTab active_tab = NavigationTab::Pomodoro;
@@ -73,8 +79,7 @@ struct AppState {
     int long_breaks_in_cycle = Core::Configuration::DEFAULT_LONG_BREAKS_IN_CYCLE;
 
     // ===== Pomodoro Cycle Tracking =====
-    int pomodoros_in_current_cycle = 0;
-    int long_breaks_taken_in_cycle = 0;
+    Core::PomodoroCycle pomodoro_cycle;
 
     // ===== Settings Editing - Water =====
     int temp_water_interval = Core::Configuration::DEFAULT_WATER_INTERVAL_MINUTES;
@@ -121,6 +126,9 @@ struct AppState {
     bool start_with_windows = false;
     bool start_minimized = true;
 
+    // ===== Task Archive Settings =====
+    int archive_after_days = Core::Configuration::DEFAULT_ARCHIVE_AFTER_DAYS;
+
     // ===== Sound Settings =====
     bool pomodoro_sound_enabled = Core::Configuration::DEFAULT_SOUND_ENABLED;
     int pomodoro_sound_volume = Core::Configuration::DEFAULT_SOUND_VOLUME;
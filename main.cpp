@@ -1,25 +1,197 @@
 #include "app/Application.h"
+#include "app/StartupProfiler.h"
+#include "core/Persistence.h"
+#include "core/RemoteProtocol.h"
+#include "core/Trace.h"
+#include "system/SingleInstance.h"
 #include <exception>
+#include <filesystem>
+#include <initializer_list>
 #include <iostream>
+#include <optional>
 #include <string_view>
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <cstdio>
+#endif
+
 namespace {
-bool hasStartupFlag(int argc, char* argv[]) {
+#ifdef _WIN32
+// Release builds use the GUI subsystem, so a launch from a terminal starts without a console.
+// Attach to the terminal's console so replies, usage errors and the --profile-startup report
+// show up there; streams the caller redirected to a file or pipe are left alone.
+void attachParentConsole() {
+    const HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    const HANDLE error = GetStdHandle(STD_ERROR_HANDLE);
+    const bool output_redirected = output != nullptr && output != INVALID_HANDLE_VALUE;
+    const bool error_redirected = error != nullptr && error != INVALID_HANDLE_VALUE;
+    if ((output_redirected && error_redirected) || GetConsoleWindow() != nullptr ||
+        AttachConsole(ATTACH_PARENT_PROCESS) == 0) {
+        return;
+    }
+
+    FILE* stream = nullptr;
+    if (!output_redirected && freopen_s(&stream, "CONOUT$", "w", stdout) == 0) {
+        std::cout.clear();
+    }
+    if (!error_redirected && freopen_s(&stream, "CONOUT$", "w", stderr) == 0) {
+        std::cerr.clear();
+    }
+}
+#endif
+
+bool hasFlag(int argc, char* argv[], std::initializer_list<std::string_view> spellings) {
     for (int i = 1; i < argc; ++i) {
-        std::string_view arg{argv[i]};
-        if (arg == "--startup" || arg == "-startup" || arg == "/startup") {
-            return true;
+        const std::string_view arg{argv[i]};
+        for (const std::string_view spelling : spellings) {
+            if (arg == spelling) {
+                return true;
+            }
         }
     }
     return false;
 }
+
+std::optional<std::string_view> findFlagValue(int argc, char* argv[], std::string_view flag) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string_view{argv[i]} == flag) {
+            return std::string_view{argv[i + 1]};
+        }
+    }
+    return std::nullopt;
+}
+
+bool hasStartupFlag(int argc, char* argv[]) {
+    return hasFlag(argc, argv, {"--startup", "-startup", "/startup"});
+}
+
+bool hasProfileStartupFlag(int argc, char* argv[]) {
+    return hasFlag(argc, argv, {"--profile-startup"});
+}
+
+struct TraceRequest {
+    std::optional<std::filesystem::path> path;
+    bool valid = true;
+};
+
+// --trace <file> records main-loop and subsystem zones from startup and writes them on exit
+TraceRequest parseTraceFlag(int argc, char* argv[]) {
+    if (!hasFlag(argc, argv, {"--trace"})) {
+        return {};
+    }
+    const auto path = findFlagValue(argc, argv, "--trace");
+    if (!path || path->empty() || path->starts_with("--")) {
+        return {std::nullopt, false};
+    }
+    return {std::filesystem::path{*path}};
+}
+
+struct RemoteControlRequest {
+    std::optional<WorkBalance::Core::RemoteCommand> command;
+    bool valid = true;
+};
+
+// --show, --toggle, --start-break <short|long|water|standup|eye>, --status and --quit are meant
+// for an instance that is already running (the GUI or workbalanced)
+RemoteControlRequest parseRemoteControlFlags(int argc, char* argv[]) {
+    using WorkBalance::Core::RemoteAction;
+    using WorkBalance::Core::RemoteCommand;
+
+    if (hasFlag(argc, argv, {"--start-break"})) {
+        const auto name = findFlagValue(argc, argv, "--start-break");
+        const auto kind = name ? WorkBalance::Core::parseBreakKind(*name) : std::nullopt;
+        if (!kind) {
+            return {std::nullopt, false};
+        }
+        return {RemoteCommand{RemoteAction::StartBreak, *kind}};
+    }
+    if (hasFlag(argc, argv, {"--toggle"})) {
+        return {RemoteCommand{RemoteAction::ToggleTimer}};
+    }
+    if (hasFlag(argc, argv, {"--status"})) {
+        return {RemoteCommand{RemoteAction::Status}};
+    }
+    if (hasFlag(argc, argv, {"--quit"})) {
+        return {RemoteCommand{RemoteAction::Quit}};
+    }
+    if (hasFlag(argc, argv, {"--show"})) {
+        return {RemoteCommand{RemoteAction::Show}};
+    }
+    return {};
+}
+
+int forwardToRunningInstance(const WorkBalance::System::SingleInstance& instance,
+                             const WorkBalance::Core::RemoteCommand& command) {
+    const auto reply = instance.send(command);
+    if (!reply) {
+        std::cerr << "WorkBalance is running but did not respond\n";
+        return 1;
+    }
+    if (!reply->message.empty()) {
+        (reply->success ? std::cout : std::cerr) << reply->message << '\n';
+    }
+    return reply->success ? 0 : 1;
+}
 } // namespace
 
 int main(int argc, char* argv[]) {
+#ifdef _WIN32
+    attachParentConsole();
+#endif
     try {
+        // Created first so the profile measures everything after process entry
+        std::optional<WorkBalance::App::StartupProfiler> profiler;
+        if (hasProfileStartupFlag(argc, argv)) {
+            profiler.emplace();
+        }
+
+        const auto remote_control = parseRemoteControlFlags(argc, argv);
+        if (!remote_control.valid) {
+            std::cerr << "Usage: --start-break <short|long|water|standup|eye>\n";
+            return 2;
+        }
+        const auto trace = parseTraceFlag(argc, argv);
+        if (!trace.valid) {
+            std::cerr << "Usage: --trace <file>\n";
+            return 2;
+        }
+
+        // Later launches hand their command to the running instance and exit before touching GLFW
+        const auto config_directory = WorkBalance::Core::PersistenceManager::getDefaultConfigDirectory();
+        WorkBalance::System::SingleInstance instance{config_directory};
+        if (!instance.isPrimary()) {
+            const auto command = remote_control.command.value_or(WorkBalance::Core::RemoteCommand{});
+            return forwardToRunningInstance(instance, command);
+        }
+        if (remote_control.command) {
+            std::cerr << "WorkBalance is not running\n";
+            return 1;
+        }
+        if (profiler) {
+            profiler->lap("single_instance");
+        }
+
+        auto& tracer = WorkBalance::Core::Tracer::instance();
+        if (trace.path) {
+            tracer.setThreadName("main");
+            tracer.setEnabled(true);
+        }
+
         const bool launched_at_startup = hasStartupFlag(argc, argv);
-        WorkBalance::App::Application app{launched_at_startup};
-        app.run();
+        {
+            WorkBalance::App::Application app{launched_at_startup, profiler ? &*profiler : nullptr, &instance};
+            app.run();
+        }
+
+        // Written after the application is destroyed so shutdown is part of the trace
+        if (trace.path) {
+            if (!tracer.writeChromeTrace(*trace.path)) {
+                std::cerr << "Warning: Failed to write trace to " << trace.path->string() << '\n';
+            }
+        }
         return 0;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << '\n';
@@ -0,0 +1,142 @@
+#include <app/AllocationCounter.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace WorkBalance::App {
+namespace {
+constinit std::atomic<std::uint64_t> g_allocations{0};
+
+void* allocate(std::size_t size) noexcept {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t alignment) noexcept {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<std::size_t>(alignment);
+#ifdef _MSC_VER
+    return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+    // aligned_alloc wants the size to be a multiple of the alignment
+    const std::size_t rounded = ((size == 0 ? 1 : size) + align - 1) & ~(align - 1);
+    return std::aligned_alloc(align, rounded);
+#endif
+}
+
+void freeAligned(void* pointer) noexcept {
+#ifdef _MSC_VER
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+// The throwing forms retry through the new-handler like the standard library's
+template <typename Allocate>
+void* allocateOrThrow(Allocate&& allocate_once) {
+    for (;;) {
+        if (void* pointer = allocate_once(); pointer != nullptr) {
+            return pointer;
+        }
+        const std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+} // namespace
+
+std::uint64_t AllocationCounter::allocations() noexcept {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace WorkBalance::App
+
+using WorkBalance::App::allocate;
+using WorkBalance::App::allocateAligned;
+using WorkBalance::App::allocateOrThrow;
+using WorkBalance::App::freeAligned;
+
+void* operator new(std::size_t size) {
+    return allocateOrThrow([size] { return allocate(size); });
+}
+
+void* operator new[](std::size_t size) {
+    return allocateOrThrow([size] { return allocate(size); });
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateOrThrow([size, alignment] { return allocateAligned(size, alignment); });
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateOrThrow([size, alignment] { return allocateAligned(size, alignment); });
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t& /*tag*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t& /*tag*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t /*alignment*/) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/, const std::nothrow_t& /*tag*/) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t /*alignment*/, const std::nothrow_t& /*tag*/) noexcept {
+    freeAligned(pointer);
+}
@@ -3,28 +3,52 @@
 
 #include <GLFW/glfw3.h>
 #include <imgui.h>
+#include <imgui_internal.h>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iostream>
 #include <memory>
 #include <string>
 #include <string_view>
-#include <thread>
+#include <type_traits>
 #include <utility>
-
+#include <vector>
+
+#include <app/AllocationCounter.h>
+#include <app/ApplicationEvents.h>
+#include <app/BackgroundTask.h>
+#include <app/EventBus.h>
+#include <app/FontAtlasCache.h>
+#include <app/FrameCache.h>
+#include <app/FrameProfiler.h>
 #include <app/ImGuiLayer.h>
+#include <app/StartupProfiler.h>
 #include <app/ui/MainWindowView.h>
 #include <app/ui/OverlayView.h>
+#include <app/ui/components/MetricsPanel.h>
 #include <core/Configuration.h>
+#include <core/DisplayLayout.h>
+#include <core/MemoryAccounting.h>
+#include <core/Metrics.h>
 #include <core/Persistence.h>
+#include <core/RemoteProtocol.h>
 #include <core/Task.h>
+#include <core/TaskArchive.h>
 #include <core/Timer.h>
+#include <core/Trace.h>
 #include <core/WellnessTimer.h>
 #include <core/WellnessTypes.h>
 #include <system/AudioManager.h>
 #include <system/MainWindow.h>
+#include <system/MonitorTopology.h>
 #include <system/NotificationManager.h>
 #include <system/OverlayWindow.h>
+#include <system/SingleInstance.h>
 #include <system/SystemTray.h>
 #include <system/WindowBase.h>
 #include <system/WindowsStartup.h>
@@ -36,18 +60,82 @@ namespace {
     return Core::Configuration::DEFAULT_WINDOW_WIDTH;
 }
 
-[[nodiscard]] int getWindowHeight() {
-    GLFWmonitor* primary_monitor = glfwGetPrimaryMonitor();
-    if (primary_monitor != nullptr) {
-        const GLFWvidmode* mode = glfwGetVideoMode(primary_monitor);
-        if (mode != nullptr) {
-            constexpr int taskbar_height = 150;
-            return mode->height - taskbar_height;
+// The main window opens on the primary monitor, so its fonts are baked for that one first
+[[nodiscard]] float initialUiScale(const System::MonitorTopology& monitors) {
+    const System::MonitorInfo* primary = monitors.primary();
+    return Core::DisplayLayout::uiScale(primary != nullptr ? primary->content_scale : 1.0f, 0, 0);
+}
+
+[[nodiscard]] std::filesystem::path fontCachePath(float scale) {
+    return App::FontAtlasCache::pathForScale(Core::PersistenceManager::getDefaultConfigDirectory(), scale);
+}
+
+struct DrawCounts {
+    std::uint32_t draw_calls = 0;
+    std::uint32_t vertices = 0;
+};
+
+[[nodiscard]] DrawCounts countDrawCalls(const ImDrawData& draw_data) {
+    DrawCounts counts{.vertices = static_cast<std::uint32_t>(draw_data.TotalVtxCount)};
+    for (int i = 0; i < draw_data.CmdListsCount; ++i) {
+        counts.draw_calls += static_cast<std::uint32_t>(draw_data.CmdLists[i]->CmdBuffer.Size);
+    }
+    return counts;
+}
+
+// Registered once at startup so recording never looks a name up
+struct AppMetrics {
+    explicit AppMetrics(Core::MetricsRegistry& registry)
+        : loop_events(registry.histogram("workbalance_loop_events_seconds",
+                                         "Main loop: input, tray, remote commands and posted events")),
+          loop_update(registry.histogram("workbalance_loop_update_seconds", "Main loop: timers, reminders and tray")),
+          loop_render(
+              registry.histogram("workbalance_loop_render_seconds", "Main loop: building and presenting frames")),
+          timer_update(registry.histogram("workbalance_timer_update_seconds", "Timer::update and its completion")),
+          timer_completions(registry.counter("workbalance_timer_completions_total", "Pomodoros and breaks finished")),
+          wellness_update(
+              registry.histogram("workbalance_wellness_update_seconds", "WellnessTimer updates and their completions")),
+          wellness_completions(
+              registry.counter("workbalance_wellness_completions_total", "Wellness reminders and breaks finished")),
+          persistence_load(registry.histogram("workbalance_persistence_load_seconds", "Loading settings and tasks")),
+          persistence_save(registry.histogram("workbalance_persistence_save_seconds", "Saving settings and tasks")),
+          persistence_errors(registry.counter("workbalance_persistence_errors_total", "Failed loads and saves")),
+          audio_play(registry.histogram("workbalance_audio_play_seconds", "Starting a sound")),
+          notification(registry.histogram("workbalance_notification_seconds", "Dispatching a desktop notification")),
+          tasks(registry.gauge("workbalance_tasks", "Tasks in the list")) {
+        for (std::size_t i = 0; i < Core::MEMORY_TAG_COUNT; ++i) {
+            const std::string_view tag = Core::getMemoryTagName(static_cast<Core::MemoryTag>(i));
+            memory[i] =
+                &registry.gauge(std::format("workbalance_memory_{}_bytes", tag), "Heap bytes a subsystem holds now");
+            memory_peak[i] = &registry.gauge(std::format("workbalance_memory_{}_peak_bytes", tag),
+                                             "Most heap bytes a subsystem has held");
         }
     }
 
-    return Core::Configuration::DEFAULT_WINDOW_HEIGHT;
-}
+    void updateMemory() const noexcept {
+        for (std::size_t i = 0; i < Core::MEMORY_TAG_COUNT; ++i) {
+            const Core::MemoryAccount& account = Core::MemoryAccounting::account(static_cast<Core::MemoryTag>(i));
+            memory[i]->set(static_cast<double>(account.current()));
+            memory_peak[i]->set(static_cast<double>(account.peak()));
+        }
+    }
+
+    Core::Histogram& loop_events;
+    Core::Histogram& loop_update;
+    Core::Histogram& loop_render;
+    Core::Histogram& timer_update;
+    Core::Counter& timer_completions;
+    Core::Histogram& wellness_update;
+    Core::Counter& wellness_completions;
+    Core::Histogram& persistence_load;
+    Core::Histogram& persistence_save;
+    Core::Counter& persistence_errors;
+    Core::Histogram& audio_play;
+    Core::Histogram& notification;
+    Core::Gauge& tasks;
+    std::array<Core::Gauge*, Core::MEMORY_TAG_COUNT> memory{};
+    std::array<Core::Gauge*, Core::MEMORY_TAG_COUNT> memory_peak{};
+};
 
 class ScopedGLFWContext {
   public:
@@ -71,18 +159,24 @@ class ScopedGLFWContext {
 
 class Application::Impl {
   public:
-    explicit Impl(bool launched_at_startup);
+    Impl(bool launched_at_startup, StartupProfiler* profiler, System::SingleInstance* instance);
     ~Impl();
     void run();
 
   private:
+    void waitForNextFrame(std::chrono::steady_clock::time_point deadline);
+    void exportMetrics() const;
+    void toggleTraceCapture() const;
     void setupCallbacks();
     void updateTimer();
     void updateWellnessTimers();
     void handleTimerComplete();
     void handleWellnessTimerComplete(Core::WellnessType type);
     void updateOverlayState();
+    void createOverlayWindow();
     void renderOverlayFrame();
+    [[nodiscard]] std::uint64_t computeFrameSignature() const;
+    [[nodiscard]] static bool needsFrameRebuild(const AppState& state);
     [[nodiscard]] bool shouldRenderOverlay() const noexcept;
     [[nodiscard]] bool isValidTaskIndex(size_t index) const noexcept;
     void adjustCurrentTaskIndex() noexcept;
@@ -101,15 +195,27 @@ class Application::Impl {
     void updateTask(size_t index, std::string_view name, int estimated, int completed);
     void toggleTaskCompletion(size_t index);
     void moveTask(size_t from_index, size_t to_index);
-    void renderMainWindowFrame();
+    void undoTaskEdit();
+    void redoTaskEdit();
+    bool archiveStaleTasks();
+    [[nodiscard]] std::vector<Core::ArchivedTask> searchArchive(std::string_view query);
+    void restoreArchivedTask(std::uint64_t id);
+    void buildMainWindowFrame();
+    void renderMainWindowFrame(bool rebuild_draw_data);
+    void profileLap(std::string_view phase);
+    void reportStartupProfile();
     void updateWindowTitle(int remaining_seconds);
     void loadPersistedData();
     void applyPersistedWindowPositions();
     void savePersistedData() const;
     void initializeSystemTray();
     void updateSystemTrayState();
+    void updateUiScale();
     void showWindow();
     void hideWindow();
+    [[nodiscard]] Core::RemoteReply handleRemoteCommand(const Core::RemoteCommand& command);
+    [[nodiscard]] Core::RemoteReply startBreak(Core::BreakKind kind);
+    [[nodiscard]] std::string describeStatus() const;
     void setupWellnessCallbacks();
 
     // Wellness timer controls
@@ -128,29 +234,69 @@ class Application::Impl {
     template <typename Callback>
     void withAudio(Callback&& callback) {
         if (m_audio && m_audio->isInitialized()) {
+            const Core::ScopedLatency latency{&m_app_metrics.audio_play};
+            const Core::TraceZone zone{"AudioManager"};
             std::forward<Callback>(callback)(*m_audio);
         }
     }
 
+    template <typename Callback>
+    void withNotifications(bool enabled, Callback&& callback) {
+        if (enabled && m_notifications && m_notifications->isSupported()) {
+            const Core::ScopedLatency latency{&m_app_metrics.notification};
+            const Core::TraceZone zone{"NotificationManager"};
+            std::forward<Callback>(callback)(*m_notifications);
+        }
+    }
+
     [[nodiscard]] static constexpr int minutesToSeconds(int minutes) noexcept {
         constexpr int seconds_per_minute = 60;
         return minutes * seconds_per_minute;
     }
 
   private:
+    // Startup phase timing, null unless --profile-startup was given. The checkpoints
+    // between the members below time each subsystem's construction.
+    StartupProfiler* m_profiler;
+    // Startup work that needs neither the main thread nor a GL context runs on workers while
+    // GLFW and the windows come up; the member that needs each result joins it
+    BackgroundTask<std::expected<Core::PersistentData, Core::PersistenceError>> m_persisted_data_task;
+    BackgroundTask<std::unique_ptr<System::IAudioService>> m_audio_task;
     System::GLFWManager m_glfw_manager{};
+    System::MonitorTopology m_monitors;
+    StartupProfiler::Checkpoint m_glfw_ready{m_profiler, "glfw_init"};
+    // Starts once the monitors are known so it can bake at their DPI; still overlaps window creation
+    BackgroundTask<std::unique_ptr<App::ImGuiLayer::Fonts>> m_fonts_task;
     System::MainWindow m_window;
+    StartupProfiler::Checkpoint m_window_ready{m_profiler, "main_window"};
     App::ImGuiLayer m_imgui_layer;
+    StartupProfiler::Checkpoint m_fonts_ready{m_profiler, "imgui_fonts"};
+    // Created on first show, so users who never enable the overlay don't pay for a second context
     System::OverlayWindow m_overlay_window;
     std::unique_ptr<System::IAudioService> m_audio;
+    StartupProfiler::Checkpoint m_audio_ready{m_profiler, "audio_service"};
     std::unique_ptr<System::INotificationService> m_notifications;
+    StartupProfiler::Checkpoint m_notifications_ready{m_profiler, "notification_service"};
     Core::Timer m_timer;
     Core::TaskManager m_task_manager;
     Core::PersistenceManager m_persistence;
+    Core::TaskArchive m_task_archive;
     System::SystemTray m_system_tray;
+    ApplicationEvents m_events;
+    // Events posted by worker threads, emitted on m_events at the top of each frame
+    EventBus m_event_bus;
+    Core::MetricsRegistry m_metrics;
+    AppMetrics m_app_metrics{m_metrics};
+    std::chrono::steady_clock::time_point m_last_metrics_export{std::chrono::steady_clock::now()};
+    // Commands from later launches (--show, --toggle, ...); null when running unguarded
+    System::SingleInstance* m_instance;
     AppState m_state;
+    FrameCache m_frame_cache;
+    FrameCache m_overlay_frame_cache;
+    FrameProfiler m_frame_profiler;
     UI::MainWindowView m_main_view;
     UI::OverlayView m_overlay_view;
+    UI::Components::MetricsPanel m_metrics_panel{m_metrics, m_state};
 
     // Wellness timers
     std::unique_ptr<Core::WellnessTimer> m_water_timer;
@@ -160,13 +306,24 @@ class Application::Impl {
     bool m_launched_at_startup{false};
 };
 
-Application::Impl::Impl(bool launched_at_startup)
-    : m_window(getWindowWidth(), getWindowHeight(), Core::Configuration::WINDOW_TITLE), m_imgui_layer(m_window.get()),
-      m_overlay_window(), m_audio(System::createAudioService()), m_notifications(System::createNotificationService()),
+Application::Impl::Impl(bool launched_at_startup, StartupProfiler* profiler, System::SingleInstance* instance)
+    : m_profiler(profiler), m_persisted_data_task([] {
+          const Core::TraceZone zone{"PersistenceManager::load"};
+          return Core::PersistenceManager{}.load();
+      }),
+      m_audio_task([] { return System::createAudioService(); }),
+      m_fonts_task([scale = initialUiScale(m_monitors)] {
+          return App::ImGuiLayer::loadFonts(fontCachePath(scale), scale);
+      }),
+      m_window(getWindowWidth(), Core::Configuration::DEFAULT_WINDOW_HEIGHT, Core::Configuration::WINDOW_TITLE,
+               m_monitors),
+      m_imgui_layer(m_window.get(), m_fonts_task.get()), m_overlay_window(m_window.get()), m_audio(m_audio_task.get()),
+      m_notifications(System::createNotificationService()),
       m_timer(Core::Configuration::DEFAULT_POMODORO_DURATION, Core::Configuration::DEFAULT_SHORT_BREAK_DURATION,
               Core::Configuration::DEFAULT_LONG_BREAK_DURATION),
       m_persistence(),
-      m_main_view(
+      m_task_archive(m_persistence.getConfigPath().parent_path() / Core::TaskArchive::DEFAULT_FILENAME),
+      m_instance(instance), m_main_view(
           m_window, m_imgui_layer, m_timer, m_task_manager, m_state,
           UI::MainWindowCallbacks{
               .onToggleTimer = [this]() { toggleTimer(); },
@@ -188,6 +345,8 @@ Application::Impl::Impl(bool launched_at_startup)
                                       int completed) { updateTask(index, name, estimated, completed); },
               .onTaskCompletionToggled = [this](size_t index) { toggleTaskCompletion(index); },
               .onTaskMoved = [this](size_t from_index, size_t to_index) { moveTask(from_index, to_index); },
+              .onArchiveSearch = [this](std::string_view query) { return searchArchive(query); },
+              .onArchivedTaskRestored = [this](std::uint64_t id) { restoreArchivedTask(id); },
               .onTabChanged = [this](WorkBalance::NavigationTab /*tab*/) { /* Background color handled in view */ }}),
       m_overlay_view(m_imgui_layer, m_timer, m_state),
       m_water_timer(std::make_unique<Core::WellnessTimer>(Core::WellnessType::Water,
@@ -199,19 +358,40 @@ Application::Impl::Impl(bool launched_at_startup)
                                                              Core::WellnessDefaults::DEFAULT_EYE_INTERVAL,
                                                              Core::WellnessDefaults::DEFAULT_EYE_BREAK_DURATION)),
       m_launched_at_startup(launched_at_startup) {
+    profileLap("app_state");
+    if (m_profiler != nullptr) {
+        const auto& font_stats = m_imgui_layer.fontLoadStats();
+        m_profiler->addValue("font_atlas_ms", font_stats.milliseconds);
+        m_profiler->addValue("font_atlas_from_cache", font_stats.from_cache ? 1.0 : 0.0);
+        m_profiler->addValue("font_atlas_texture_bytes", static_cast<double>(font_stats.texture_bytes));
+    }
 
     // Set up wellness timers in the views
     m_main_view.setWellnessTimers(m_water_timer.get(), m_standup_timer.get(), m_eye_care_timer.get());
     m_overlay_view.setWellnessTimers(m_water_timer.get(), m_standup_timer.get(), m_eye_care_timer.get());
+    m_main_view.setFrameProfiler(&m_frame_profiler);
     setupWellnessCallbacks();
 
     loadPersistedData();
     applyPersistedWindowPositions();
 
+    // Move long-finished tasks to cold storage before anything iterates the list, and save at
+    // once so a crash before shutdown cannot archive them a second time on the next launch
+    if (archiveStaleTasks()) {
+        savePersistedData();
+    }
+    profileLap("load_persisted_data");
+    if (m_profiler != nullptr) {
+        // Time each job spent on its worker, to compare against the phases it overlapped
+        m_profiler->addValue("persisted_data_worker_ms", m_persisted_data_task.durationMs().value_or(0.0));
+        m_profiler->addValue("fonts_worker_ms", m_fonts_task.durationMs().value_or(0.0));
+        m_profiler->addValue("audio_worker_ms", m_audio_task.durationMs().value_or(0.0));
+    }
+
     // Start minimized only when launched via Windows startup (--startup flag)
     // AND the user has the "start minimized" setting enabled
     if (m_launched_at_startup && m_state.start_minimized) {
-        glfwHideWindow(m_window.get());
+        m_window.hide();
     }
 
     m_state.background_color = WorkBalance::ThemeManager::getBackgroundColor(m_timer.getCurrentMode());
@@ -219,11 +399,14 @@ Application::Impl::Impl(bool launched_at_startup)
     updateWellnessCounters();
     updateWindowTitle(m_timer.getRemainingTime());
     setupCallbacks();
+    profileLap("ui_setup");
     initializeSystemTray();
+    profileLap("system_tray");
 }
 
 Application::Impl::~Impl() {
     savePersistedData();
+    exportMetrics();
 }
 
 void Application::Impl::run() {
@@ -236,48 +419,172 @@ void Application::Impl::run() {
         const std::chrono::duration<double> elapsed = current_time - last_frame_time;
 
         if (elapsed < frame_duration) {
-            std::this_thread::sleep_for(frame_duration - elapsed);
+            waitForNextFrame(current_time + std::chrono::duration_cast<clock::duration>(frame_duration - elapsed));
         }
 
         last_frame_time = current_time;
+        const Core::TraceZone frame_zone{"frame"};
+        m_frame_profiler.beginFrame(clock::now(), AllocationCounter::allocations());
+
+        {
+            const Core::ScopedLatency latency{&m_app_metrics.loop_events};
+            const FrameProfiler::ScopedStage stage{m_frame_profiler, FrameProfiler::Stage::Poll};
+            {
+                const Core::TraceZone zone{"glfwPollEvents"};
+                glfwPollEvents();
+            }
+            m_event_bus.dispatch(m_events);
+            {
+                const Core::TraceZone zone{"SystemTray::processMessages"};
+                m_system_tray.processMessages();
+            }
+            if (m_instance != nullptr) {
+                m_instance->processCommands(
+                    [this](const Core::RemoteCommand& command) { return handleRemoteCommand(command); });
+            }
+        }
+        {
+            const Core::ScopedLatency latency{&m_app_metrics.loop_update};
+            const FrameProfiler::ScopedStage stage{m_frame_profiler, FrameProfiler::Stage::Update};
+            updateTimer();
+            updateWellnessTimers();
+            updateSystemTrayState();
+            updateUiScale();
+            m_app_metrics.updateMemory();
+        }
 
-        glfwPollEvents();
-        m_system_tray.processMessages();
-        updateTimer();
-        updateWellnessTimers();
-        updateSystemTrayState();
+        {
+            const Core::ScopedLatency latency{&m_app_metrics.loop_render};
+            const auto action = m_frame_cache.beginFrame(computeFrameSignature(), needsFrameRebuild(m_state));
+            m_frame_profiler.setAction(action);
+            switch (action) {
+                case FrameCache::Action::Build:
+                    buildMainWindowFrame();
+                    renderMainWindowFrame(true);
+                    break;
+                case FrameCache::Action::Reuse:
+                    renderMainWindowFrame(false);
+                    break;
+                case FrameCache::Action::Skip:
+                    break;
+            }
 
-        m_imgui_layer.newFrame();
-        m_main_view.render();
-        renderMainWindowFrame();
-        updateOverlayState();
-        renderOverlayFrame();
+            const FrameProfiler::ScopedStage stage{m_frame_profiler, FrameProfiler::Stage::Overlay};
+            updateOverlayState();
+            renderOverlayFrame();
+        }
+
+        constexpr std::chrono::seconds export_interval{Core::Configuration::METRICS_EXPORT_INTERVAL_SECONDS};
+        if (current_time - m_last_metrics_export >= export_interval) {
+            m_last_metrics_export = current_time;
+            exportMetrics();
+        }
+        m_frame_profiler.endFrame(clock::now(), AllocationCounter::allocations());
+    }
+}
+
+void Application::Impl::exportMetrics() const {
+    const auto path = m_persistence.getConfigPath().parent_path() / Core::MetricsRegistry::DEFAULT_FILENAME;
+    if (const auto result = m_metrics.writePrometheusFile(path); !result) {
+        std::cerr << "Warning: metrics not written: " << Core::getPersistenceErrorMessage(result.error()) << '\n';
+    }
+}
+
+void Application::Impl::toggleTraceCapture() const {
+    auto& tracer = Core::Tracer::instance();
+    if (!tracer.isEnabled()) {
+        // The main thread's ring is only allocated once tracing is first used
+        tracer.setThreadName("main");
+        tracer.clear();
+        tracer.setEnabled(true);
+        std::cout << "Tracing started; press F4 again to save the trace\n";
+        return;
+    }
+
+    tracer.setEnabled(false);
+    const auto path = m_persistence.getConfigPath().parent_path() / Core::Tracer::DEFAULT_FILENAME;
+    if (const auto result = tracer.writeChromeTrace(path); !result) {
+        std::cerr << "Warning: trace not written: " << Core::getPersistenceErrorMessage(result.error()) << '\n';
+        return;
+    }
+    std::cout << "Trace written to " << path.string() << '\n';
+}
+
+void Application::Impl::waitForNextFrame(std::chrono::steady_clock::time_point deadline) {
+    // Input wakes the wait too; keep waiting so it does not raise the frame rate, but start
+    // the frame early when a worker thread has posted an event
+    while (!m_event_bus.hasPending()) {
+        const std::chrono::duration<double> remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining.count() <= 0.0) {
+            break;
+        }
+        glfwWaitEventsTimeout(remaining.count());
     }
 }
 
 void Application::Impl::updateOverlayState() {
     if (m_state.show_timer_overlay == m_overlay_window.isVisible()) {
+        constexpr std::chrono::seconds release_delay{Core::Configuration::OVERLAY_RELEASE_DELAY_SECONDS};
+        if (!m_state.show_timer_overlay && m_overlay_window.releaseIfHiddenFor(release_delay)) {
+            m_overlay_view.releaseCachedFrame();
+        }
         return;
     }
 
     if (m_state.show_timer_overlay) {
+        if (!m_overlay_window.isCreated()) {
+            createOverlayWindow();
+        }
         m_overlay_window.show();
+        // Whatever the hidden window last presented is gone
+        m_overlay_frame_cache.invalidate();
     } else {
         m_overlay_window.hide();
     }
 }
 
+void Application::Impl::createOverlayWindow() {
+    m_overlay_window.create();
+    m_overlay_window.setPosition(static_cast<int>(m_state.overlay_position.x),
+                                 static_cast<int>(m_state.overlay_position.y));
+
+    glfwSetWindowUserPointer(m_overlay_window.get(), this);
+    glfwSetWindowRefreshCallback(m_overlay_window.get(), [](GLFWwindow* window) {
+        if (auto* app = static_cast<Application::Impl*>(glfwGetWindowUserPointer(window)); app != nullptr) {
+            app->m_overlay_frame_cache.invalidateFramebuffer();
+        }
+    });
+}
+
 void Application::Impl::renderOverlayFrame() {
     if (!shouldRenderOverlay()) {
         return;
     }
+    const Core::TraceZone zone{"renderOverlayFrame"};
+
+    // The overlay text changes at most once a second, so most ticks present nothing at all.
+    // Hovering and dragging need live ImGui input handling and always rebuild.
+    const bool interacting = m_state.overlay_dragging || m_overlay_window.geometry().hovered;
+    const auto signature = m_overlay_view.computeSignature(m_overlay_window);
+    const auto action = m_overlay_frame_cache.beginFrame(signature, interacting);
+    if (action == FrameCache::Action::Skip) {
+        return;
+    }
 
+    // The overlay context shares the main context's objects, so the ImGui backend's font
+    // texture, shader and buffers are valid here; the backend creates its VAO per draw.
     ScopedGLFWContext overlay_context(m_overlay_window.get());
 
-    m_imgui_layer.newFrame();
+    if (action == FrameCache::Action::Build) {
+        m_imgui_layer.newFrame();
+        // The overlay frame replaces ImGui's draw data, so the main window has to rebuild to redraw
+        m_frame_cache.invalidateDrawData();
 
-    m_overlay_view.renderContent(m_overlay_window);
-    m_overlay_view.renderFrame(m_overlay_window);
+        m_overlay_view.renderContent(m_overlay_window);
+        m_overlay_view.renderFrame(m_overlay_window);
+    } else {
+        m_overlay_view.presentCachedFrame(m_overlay_window);
+    }
     m_overlay_window.swapBuffers();
 }
 
@@ -286,9 +593,17 @@ bool Application::Impl::shouldRenderOverlay() const noexcept {
 }
 
 void Application::Impl::setupCallbacks() {
+    m_event_bus.setWakeCallback(glfwPostEmptyEvent);
+    [[maybe_unused]] const auto close_handler = m_events.onCloseRequested.subscribe([this]() { requestClose(); });
+
     glfwSetWindowUserPointer(m_window.get(), this);
-    glfwSetKeyCallback(m_window.get(), [](GLFWwindow* window, int key, int /*scancode*/, int action, int /*mods*/) {
-        if (action != GLFW_PRESS) {
+    glfwSetWindowRefreshCallback(m_window.get(), [](GLFWwindow* window) {
+        if (auto* app = static_cast<Application::Impl*>(glfwGetWindowUserPointer(window)); app != nullptr) {
+            app->m_frame_cache.invalidateFramebuffer();
+        }
+    });
+    glfwSetKeyCallback(m_window.get(), [](GLFWwindow* window, int key, int /*scancode*/, int action, int mods) {
+        if (action != GLFW_PRESS && action != GLFW_REPEAT) {
             return;
         }
 
@@ -297,7 +612,31 @@ void Application::Impl::setupCallbacks() {
             return;
         }
 
-        if (key == GLFW_KEY_UP) {
+        // Undo/redo auto-repeat while held; text fields keep their own undo
+        const bool ctrl = (mods & GLFW_MOD_CONTROL) != 0;
+        if (ctrl && !ImGui::GetIO().WantTextInput) {
+            const bool shift = (mods & GLFW_MOD_SHIFT) != 0;
+            if (key == GLFW_KEY_Z && !shift) {
+                app->undoTaskEdit();
+                return;
+            }
+            if (key == GLFW_KEY_Y || (key == GLFW_KEY_Z && shift)) {
+                app->redoTaskEdit();
+                return;
+            }
+        }
+
+        if (action != GLFW_PRESS) {
+            return;
+        }
+
+        if (key == GLFW_KEY_F2) {
+            app->m_state.show_performance_hud = !app->m_state.show_performance_hud;
+        } else if (key == GLFW_KEY_F3) {
+            app->m_state.show_metrics_panel = !app->m_state.show_metrics_panel;
+        } else if (key == GLFW_KEY_F4) {
+            app->toggleTraceCapture();
+        } else if (key == GLFW_KEY_UP) {
             app->toggleOverlayMode();
         } else if (key == GLFW_KEY_SPACE && !ImGui::GetIO().WantTextInput) {
             app->toggleTimer();
@@ -308,6 +647,8 @@ void Application::Impl::setupCallbacks() {
 }
 
 void Application::Impl::updateTimer() {
+    const Core::ScopedLatency latency{&m_app_metrics.timer_update};
+    const Core::TraceZone zone{"updateTimer"};
     const int previous_remaining = m_timer.getRemainingTime();
     const bool timer_completed = m_timer.update();
 
@@ -322,6 +663,7 @@ void Application::Impl::updateTimer() {
 }
 
 void Application::Impl::handleTimerComplete() {
+    m_app_metrics.timer_completions.increment();
     m_timer.stop();
 
     if (m_state.pomodoro_sound_enabled) {
@@ -334,62 +676,31 @@ void Application::Impl::handleTimerComplete() {
     const Core::TimerMode current_mode = m_timer.getCurrentMode();
 
     // Show notification based on completed mode
-    if (m_state.pomodoro_notification_enabled && m_notifications && m_notifications->isSupported()) {
-        if (current_mode == Core::TimerMode::Pomodoro) {
-            m_notifications->showPomodoroComplete();
-        } else if (current_mode == Core::TimerMode::ShortBreak) {
-            m_notifications->showShortBreakComplete();
-        } else if (current_mode == Core::TimerMode::LongBreak) {
-            m_notifications->showLongBreakComplete();
-        }
-    }
+    withNotifications(m_state.pomodoro_notification_enabled,
+                      [current_mode](System::INotificationService& notifications) {
+                          if (current_mode == Core::TimerMode::Pomodoro) {
+                              notifications.showPomodoroComplete();
+                          } else if (current_mode == Core::TimerMode::ShortBreak) {
+                              notifications.showShortBreakComplete();
+                          } else if (current_mode == Core::TimerMode::LongBreak) {
+                              notifications.showLongBreakComplete();
+                          }
+                      });
 
     if (current_mode == Core::TimerMode::Pomodoro) {
         // Increment task pomodoros
         if (m_state.current_task_index >= 0 && isValidTaskIndex(static_cast<size_t>(m_state.current_task_index))) {
-            m_task_manager.incrementTaskPomodoros(m_state.current_task_index);
+            m_task_manager.incrementTaskPomodoros(m_state.current_task_index, false);
         }
         updatePomodoroCounters();
+    }
 
-        // Track pomodoros in current cycle
-        m_state.pomodoros_in_current_cycle++;
-
-        // Determine next break type based on cycle
-        if (m_state.pomodoros_in_current_cycle >= m_state.pomodoros_before_long_break) {
-            // Time for a long break
-            setTimerMode(Core::TimerMode::LongBreak);
-            if (m_state.auto_start_breaks) {
-                m_timer.start();
-            }
-        } else {
-            // Time for a short break
-            setTimerMode(Core::TimerMode::ShortBreak);
-            if (m_state.auto_start_breaks) {
-                m_timer.start();
-            }
-        }
-    } else if (current_mode == Core::TimerMode::LongBreak) {
-        // Long break completed
-        m_state.long_breaks_taken_in_cycle++;
-
-        // Check if we've completed all long breaks in the cycle
-        if (m_state.long_breaks_taken_in_cycle >= m_state.long_breaks_in_cycle) {
-            // Reset cycle counters
-            m_state.pomodoros_in_current_cycle = 0;
-            m_state.long_breaks_taken_in_cycle = 0;
-        }
-
-        // Start next pomodoro
-        setTimerMode(Core::TimerMode::Pomodoro);
-        if (m_state.auto_start_pomodoros) {
-            m_timer.start();
-        }
-    } else if (current_mode == Core::TimerMode::ShortBreak) {
-        // Short break completed, start next pomodoro
-        setTimerMode(Core::TimerMode::Pomodoro);
-        if (m_state.auto_start_pomodoros) {
-            m_timer.start();
-        }
+    // Short or long break after a pomodoro depending on the cycle, a pomodoro after any break
+    const Core::TimerMode next_mode = m_state.pomodoro_cycle.advance(current_mode, m_state.pomodoros_before_long_break,
+                                                                     m_state.long_breaks_in_cycle);
+    setTimerMode(next_mode);
+    if (next_mode == Core::TimerMode::Pomodoro ? m_state.auto_start_pomodoros : m_state.auto_start_breaks) {
+        m_timer.start();
     }
 }
 
@@ -410,6 +721,7 @@ void Application::Impl::adjustCurrentTaskIndex() noexcept {
 void Application::Impl::updatePomodoroCounters() {
     m_state.target_pomodoros = m_task_manager.getTargetPomodoros();
     m_state.completed_pomodoros = m_task_manager.getCompletedPomodoros();
+    m_app_metrics.tasks.set(static_cast<double>(m_task_manager.getTasks().size()));
 }
 
 void Application::Impl::resetTimer() {
@@ -505,6 +817,71 @@ void Application::Impl::toggleTaskCompletion(size_t index) {
     updatePomodoroCounters();
 }
 
+void Application::Impl::undoTaskEdit() {
+    if (m_task_manager.undo()) {
+        adjustCurrentTaskIndex();
+        updatePomodoroCounters();
+    }
+}
+
+void Application::Impl::redoTaskEdit() {
+    if (m_task_manager.redo()) {
+        adjustCurrentTaskIndex();
+        updatePomodoroCounters();
+    }
+}
+
+bool Application::Impl::archiveStaleTasks() {
+    if (m_state.archive_after_days <= 0) {
+        return false;
+    }
+
+    const auto cutoff = std::chrono::system_clock::now() - std::chrono::days{m_state.archive_after_days};
+    const std::int64_t cutoff_seconds =
+        std::chrono::duration_cast<std::chrono::seconds>(cutoff.time_since_epoch()).count();
+
+    const auto stale = m_task_manager.getCompletedBefore(cutoff_seconds);
+    if (stale.empty()) {
+        return false;
+    }
+
+    // Never drop tasks: they leave the live list only once the archive holds them
+    if (auto result = m_task_archive.append(stale); !result) {
+        std::cerr << "Failed to archive tasks: " << Core::getPersistenceErrorMessage(result.error()) << '\n';
+        return false;
+    }
+
+    [[maybe_unused]] const auto archived = m_task_manager.takeCompletedBefore(cutoff_seconds);
+    adjustCurrentTaskIndex();
+    updatePomodoroCounters();
+    return true;
+}
+
+std::vector<Core::ArchivedTask> Application::Impl::searchArchive(std::string_view query) {
+    auto results = m_task_archive.search(query);
+    if (!results) {
+        std::cerr << "Failed to read task archive: " << Core::getPersistenceErrorMessage(results.error()) << '\n';
+        return {};
+    }
+    return std::move(*results);
+}
+
+void Application::Impl::restoreArchivedTask(std::uint64_t id) {
+    auto archived = m_task_archive.restore(id);
+    if (!archived) {
+        std::cerr << "Failed to restore task: " << Core::getPersistenceErrorMessage(archived.error()) << '\n';
+        return;
+    }
+
+    // Restored tasks come back as open work so they are not re-archived on the next start
+    m_task_manager.restoreTask(Core::Task{archived->name, false, archived->estimated_pomodoros,
+                                          archived->completed_pomodoros, 0});
+    updatePomodoroCounters();
+
+    // The archive record is already tombstoned; the config is now the only copy of the task
+    savePersistedData();
+}
+
 void Application::Impl::moveTask(size_t from_index, size_t to_index) {
     if (!isValidTaskIndex(from_index) || !isValidTaskIndex(to_index)) {
         return;
@@ -523,7 +900,57 @@ void Application::Impl::moveTask(size_t from_index, size_t to_index) {
     }
 }
 
-void Application::Impl::renderMainWindowFrame() {
+std::uint64_t Application::Impl::computeFrameSignature() const {
+    FrameSignature signature;
+
+    // AppState is plain data; hashing its bytes covers every flag and buffer the views read.
+    // Padding can only cause a spurious rebuild, never a missed one.
+    static_assert(std::is_trivially_copyable_v<AppState>);
+    signature.add(m_state);
+
+    signature.add(m_timer.getRemainingTime()).add(m_timer.getCurrentMode()).add(m_timer.getState());
+    // Names, order and completion flags can change without touching the counts (undo of a rename)
+    signature.add(m_task_manager.getRevision())
+        .add(m_task_manager.getTaskCount())
+        .add(m_task_manager.getCompletedPomodoros())
+        .add(m_task_manager.getTargetPomodoros());
+
+    for (const auto* timer : {m_water_timer.get(), m_standup_timer.get(), m_eye_care_timer.get()}) {
+        if (timer != nullptr) {
+            signature.add(timer->getRemainingTime())
+                .add(timer->isRunning())
+                .add(timer->isInBreak())
+                .add(timer->isReminderActive())
+                .add(timer->getCompletedCount());
+        }
+    }
+
+    const auto [framebuffer_width, framebuffer_height] = m_window.getFramebufferSize();
+    signature.add(framebuffer_width).add(framebuffer_height);
+    const System::WindowGeometry& geometry = m_window.geometry();
+    signature.add(geometry.visible).add(geometry.iconified).add(geometry.focused);
+    return signature.value();
+}
+
+bool Application::Impl::needsFrameRebuild(const AppState& state) {
+    // Pending mouse/key/text events were queued by the GLFW backend during glfwPollEvents()
+    const ImGuiContext* context = ImGui::GetCurrentContext();
+    const bool input_pending = context != nullptr && !context->InputEventsQueue.empty();
+
+    // A focused text field blinks its cursor; the debug panels show live values
+    return input_pending || ImGui::GetIO().WantTextInput || state.ui_animating || state.show_metrics_panel ||
+           state.show_performance_hud;
+}
+
+void Application::Impl::buildMainWindowFrame() {
+    const FrameProfiler::ScopedStage stage{m_frame_profiler, FrameProfiler::Stage::BuildUi};
+    m_state.ui_animating = false;
+    m_imgui_layer.newFrame();
+    m_main_view.render();
+    m_metrics_panel.render();
+}
+
+void Application::Impl::renderMainWindowFrame(bool rebuild_draw_data) {
     const auto [width, height] = m_window.getFramebufferSize();
     glViewport(0, 0, width, height);
 
@@ -536,14 +963,45 @@ void Application::Impl::renderMainWindowFrame() {
         glClearColor(color.x, color.y, color.z, color.w);
     }
 
-    glClear(GL_COLOR_BUFFER_BIT);
-    m_imgui_layer.render();
+    {
+        const FrameProfiler::ScopedStage stage{m_frame_profiler, FrameProfiler::Stage::Render};
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (rebuild_draw_data) {
+            m_imgui_layer.render();
+        } else {
+            ImGuiLayer::renderCachedDrawData();
+        }
 
-    if (m_state.main_window_overlay_mode) {
-        glDisable(GL_BLEND);
+        if (m_state.main_window_overlay_mode) {
+            glDisable(GL_BLEND);
+        }
+    }
+    if (const ImDrawData* draw_data = ImGui::GetDrawData(); draw_data != nullptr) {
+        const auto [draw_calls, vertices] = countDrawCalls(*draw_data);
+        m_frame_profiler.setDrawStats(draw_calls, vertices);
+    }
+
+    {
+        const FrameProfiler::ScopedStage stage{m_frame_profiler, FrameProfiler::Stage::Swap};
+        m_window.swapBuffers();
     }
 
-    m_window.swapBuffers();
+    if (m_profiler != nullptr) {
+        reportStartupProfile();
+    }
+}
+
+void Application::Impl::profileLap(std::string_view phase) {
+    if (m_profiler != nullptr) {
+        m_profiler->lap(phase);
+    }
+}
+
+void Application::Impl::reportStartupProfile() {
+    m_profiler->lap("first_frame");
+    m_profiler->markFirstFrame();
+    std::cout << m_profiler->toJson() << std::endl;
+    m_profiler = nullptr;
 }
 
 void Application::Impl::updateWindowTitle(int remaining_seconds) {
@@ -556,12 +1014,16 @@ void Application::Impl::updateWindowTitle(int remaining_seconds) {
 }
 
 void Application::Impl::loadPersistedData() {
-    auto loaded_data = m_persistence.load();
+    // Read on a worker during startup; this joins it
+    auto loaded_data = m_persisted_data_task.get();
+    const std::chrono::duration<double, std::milli> load_time{m_persisted_data_task.durationMs().value_or(0.0)};
+    m_app_metrics.persistence_load.record(std::chrono::duration_cast<std::chrono::nanoseconds>(load_time));
     if (!loaded_data.has_value()) {
+        m_app_metrics.persistence_errors.increment();
         return;
     }
 
-    const auto& data = loaded_data.value();
+    auto& data = loaded_data.value();
 
     // Apply saved timer durations
     m_timer.setPomodoroDuration(minutesToSeconds(data.settings.pomodoro_duration_minutes));
@@ -623,6 +1085,9 @@ void Application::Impl::loadPersistedData() {
     m_state.start_with_windows = data.settings.start_with_windows;
     m_state.start_minimized = data.settings.start_minimized;
 
+    // Restore task archive settings
+    m_state.archive_after_days = data.settings.archive_after_days;
+
     // Restore sound settings
     m_state.pomodoro_sound_enabled = data.settings.pomodoro_sound_enabled;
     m_state.pomodoro_sound_volume = data.settings.pomodoro_sound_volume;
@@ -642,15 +1107,8 @@ void Application::Impl::loadPersistedData() {
     // Sync Windows startup registry with saved setting
     System::WindowsStartup::setStartupEnabled(m_state.start_with_windows);
 
-    // Restore tasks
-    for (const auto& task : data.tasks) {
-        m_task_manager.addTask(task.name, task.estimated_pomodoros);
-        auto* added_task = m_task_manager.getTask(m_task_manager.getTaskCount() - 1);
-        if (added_task != nullptr) {
-            added_task->completed = task.completed;
-            added_task->completed_pomodoros = task.completed_pomodoros;
-        }
-    }
+    // Restore tasks - the name arena moves over wholesale, no per-task string copies
+    m_task_manager.adoptTasks(std::move(data.tasks), std::move(data.task_names));
 
     // Restore current task index
     m_state.current_task_index = data.current_task_index;
@@ -663,10 +1121,9 @@ void Application::Impl::applyPersistedWindowPositions() {
         m_window.setPosition(m_state.main_window_x, m_state.main_window_y);
     }
 
-    // Apply overlay window position and keep state in sync
+    // The overlay window itself is placed from the state when it is created
     const int overlay_x = static_cast<int>(m_state.overlay_position.x);
     const int overlay_y = static_cast<int>(m_state.overlay_position.y);
-    m_overlay_window.setPosition(overlay_x, overlay_y);
 
     // Also set the saved overlay position for main window's overlay mode
     // This ensures first switch to overlay mode uses the persisted position
@@ -721,6 +1178,9 @@ void Application::Impl::savePersistedData() const {
     data.settings.start_with_windows = m_state.start_with_windows;
     data.settings.start_minimized = m_state.start_minimized;
 
+    // Save task archive settings
+    data.settings.archive_after_days = m_state.archive_after_days;
+
     // Save sound settings
     data.settings.pomodoro_sound_enabled = m_state.pomodoro_sound_enabled;
     data.settings.pomodoro_sound_volume = m_state.pomodoro_sound_volume;
@@ -737,17 +1197,18 @@ void Application::Impl::savePersistedData() const {
     data.settings.standup_notification_enabled = m_state.standup_notification_enabled;
     data.settings.eye_care_notification_enabled = m_state.eye_care_notification_enabled;
 
-    // Save tasks
+    // Save tasks - names stay views into the task manager's arena for the duration of the save
     const auto tasks = m_task_manager.getTasks();
-    data.tasks.reserve(tasks.size());
-    for (const auto& task : tasks) {
-        data.tasks.push_back(task);
-    }
+    data.tasks.assign(tasks.begin(), tasks.end());
 
     // Save current task index
     data.current_task_index = m_state.current_task_index;
 
-    [[maybe_unused]] const auto save_result = m_persistence.save(data);
+    const Core::ScopedLatency latency{&m_app_metrics.persistence_save};
+    const Core::TraceZone zone{"PersistenceManager::save"};
+    if (!m_persistence.save(data)) {
+        m_app_metrics.persistence_errors.increment();
+    }
 }
 
 void Application::Impl::initializeSystemTray() {
@@ -768,13 +1229,85 @@ void Application::Impl::updateSystemTrayState() {
     m_system_tray.updateWindowMode(m_state.main_window_overlay_mode);
 }
 
+void Application::Impl::updateUiScale() {
+    // Minimized windows report an empty framebuffer, which would read as a different scale
+    const System::WindowGeometry& geometry = m_window.geometry();
+    if (geometry.iconified || geometry.framebuffer_width <= 0) {
+        return;
+    }
+
+    const float scale = m_window.uiScale();
+    if (scale == m_imgui_layer.fontScale()) {
+        return;
+    }
+
+    // Only a real DPI change gets here, so moving between monitors of the same scale costs nothing
+    const Core::TraceZone zone{"ImGuiLayer::setFonts"};
+    m_monitors.refresh();
+    m_imgui_layer.setFonts(ImGuiLayer::loadFonts(fontCachePath(scale), scale));
+    m_overlay_view.invalidateTextLayout();
+    m_frame_cache.invalidate();
+    m_overlay_frame_cache.invalidate();
+}
+
 void Application::Impl::showWindow() {
-    glfwShowWindow(m_window.get());
+    m_window.show();
     glfwFocusWindow(m_window.get());
 }
 
 void Application::Impl::hideWindow() {
-    glfwHideWindow(m_window.get());
+    m_window.hide();
+}
+
+Core::RemoteReply Application::Impl::handleRemoteCommand(const Core::RemoteCommand& command) {
+    switch (command.action) {
+        case Core::RemoteAction::Show:
+            showWindow();
+            return {};
+        case Core::RemoteAction::ToggleTimer:
+            toggleTimer();
+            return {true, describeStatus()};
+        case Core::RemoteAction::StartBreak:
+            return startBreak(command.break_kind);
+        case Core::RemoteAction::Status:
+            return {true, describeStatus()};
+        case Core::RemoteAction::Quit:
+            requestClose();
+            return {};
+    }
+    return {false, "Unsupported command"};
+}
+
+Core::RemoteReply Application::Impl::startBreak(Core::BreakKind kind) {
+    switch (kind) {
+        case Core::BreakKind::ShortBreak:
+        case Core::BreakKind::LongBreak:
+            setTimerMode(kind == Core::BreakKind::ShortBreak ? Core::TimerMode::ShortBreak
+                                                             : Core::TimerMode::LongBreak);
+            m_timer.start();
+            break;
+        case Core::BreakKind::Water:
+            // Water has no timed break; taking one means logging a glass
+            acknowledgeWater();
+            break;
+        case Core::BreakKind::Standup:
+            startStandupBreak();
+            break;
+        case Core::BreakKind::EyeCare:
+            startEyeCareBreak();
+            break;
+    }
+    return {true, describeStatus()};
+}
+
+std::string Application::Impl::describeStatus() const {
+    return Core::formatSessionStatus({.mode = m_timer.getCurrentMode(),
+                                      .state = m_timer.getState(),
+                                      .remaining_seconds = m_timer.getRemainingTime(),
+                                      .water_glasses = m_state.water_glasses_consumed,
+                                      .water_goal = m_state.water_daily_goal,
+                                      .standups = m_state.standups_completed,
+                                      .eye_breaks = m_state.eye_breaks_completed});
 }
 
 // ============================================================================
@@ -798,6 +1331,8 @@ void Application::Impl::setupWellnessCallbacks() {
 }
 
 void Application::Impl::updateWellnessTimers() {
+    const Core::ScopedLatency latency{&m_app_metrics.wellness_update};
+    const Core::TraceZone zone{"updateWellnessTimers"};
     if (m_water_timer && m_water_timer->update()) {
         handleWellnessTimerComplete(Core::WellnessType::Water);
     }
@@ -812,6 +1347,7 @@ void Application::Impl::updateWellnessTimers() {
 }
 
 void Application::Impl::handleWellnessTimerComplete(Core::WellnessType type) {
+    m_app_metrics.wellness_completions.increment();
     // Play type-specific completion sound
     switch (type) {
         case Core::WellnessType::Water:
@@ -821,9 +1357,8 @@ void Application::Impl::handleWellnessTimerComplete(Core::WellnessType type) {
                     audio.playHydrationSound();
                 });
             }
-            if (m_state.water_notification_enabled && m_notifications && m_notifications->isSupported()) {
-                m_notifications->showWaterReminder();
-            }
+            withNotifications(m_state.water_notification_enabled,
+                              [](System::INotificationService& notifications) { notifications.showWaterReminder(); });
             // Auto-restart if loop is enabled
             if (m_state.water_auto_loop && m_water_timer) {
                 m_water_timer->acknowledgeReminder();
@@ -841,9 +1376,10 @@ void Application::Impl::handleWellnessTimerComplete(Core::WellnessType type) {
                         audio.playWalkSound();
                     });
                 }
-                if (m_state.standup_notification_enabled && m_notifications && m_notifications->isSupported()) {
-                    m_notifications->showStandupReminder();
-                }
+                withNotifications(m_state.standup_notification_enabled,
+                                  [](System::INotificationService& notifications) {
+                                      notifications.showStandupReminder();
+                                  });
             } else {
                 // Break completed - restart interval timer
                 if (m_standup_timer) {
@@ -862,9 +1398,10 @@ void Application::Impl::handleWellnessTimerComplete(Core::WellnessType type) {
                         audio.playBellSound();
                     });
                 }
-                if (m_state.eye_care_notification_enabled && m_notifications && m_notifications->isSupported()) {
-                    m_notifications->showEyeCareReminder();
-                }
+                withNotifications(m_state.eye_care_notification_enabled,
+                                  [](System::INotificationService& notifications) {
+                                      notifications.showEyeCareReminder();
+                                  });
             } else {
                 // Break completed - restart interval timer
                 if (m_eye_care_timer) {
@@ -976,7 +1513,8 @@ void Application::Impl::endEyeCareBreak() {
     }
 }
 
-Application::Application(bool launched_at_startup) : m_impl(std::make_unique<Application::Impl>(launched_at_startup)) {
+Application::Application(bool launched_at_startup, StartupProfiler* profiler, System::SingleInstance* instance)
+    : m_impl(std::make_unique<Application::Impl>(launched_at_startup, profiler, instance)) {
 }
 
 Application::~Application() = default;
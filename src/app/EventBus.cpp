@@ -0,0 +1,44 @@
+#include <app/EventBus.h>
+
+#include <type_traits>
+
+namespace WorkBalance::App {
+
+bool EventBus::post(const EventBusMessage& message) noexcept {
+    if (!m_queue.tryPush(message)) {
+        return false;
+    }
+    if (const WakeCallback wake = m_wake.load(std::memory_order_acquire); wake != nullptr) {
+        wake();
+    }
+    return true;
+}
+
+std::size_t EventBus::dispatch(ApplicationEvents& events) {
+    std::size_t dispatched = 0;
+    // At most one queue's worth per call, so handlers that post again cannot keep the UI thread here
+    while (dispatched < CAPACITY) {
+        auto message = m_queue.tryPop();
+        if (!message) {
+            break;
+        }
+        std::visit(
+            [&events](const auto& payload) {
+                using Payload = std::decay_t<decltype(payload)>;
+                if constexpr (std::is_same_v<Payload, TimerCompletedMessage>) {
+                    events.onTimerComplete.emit(payload.mode);
+                } else if constexpr (std::is_same_v<Payload, WellnessTimerCompletedMessage>) {
+                    events.onWellnessTimerComplete.emit(payload.type);
+                } else if constexpr (std::is_same_v<Payload, TasksChangedMessage>) {
+                    events.onTasksChanged.emit();
+                } else {
+                    events.onCloseRequested.emit();
+                }
+            },
+            *message);
+        ++dispatched;
+    }
+    return dispatched;
+}
+
+} // namespace WorkBalance::App
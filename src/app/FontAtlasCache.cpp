@@ -0,0 +1,181 @@
+#include <app/FontAtlasCache.h>
+
+#include <core/ByteStream.h>
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace WorkBalance::App {
+
+namespace {
+using Core::ByteReader;
+using Core::ByteWriter;
+
+// Layout: header, then payload = atlas metrics, line UVs, per-font glyph tables, Alpha8 pixels.
+// Values are stored in native byte order; the cache never leaves the machine that wrote it.
+constexpr std::uint32_t CACHE_MAGIC = 0x41464257; // "WBFA"
+constexpr std::uint32_t CACHE_VERSION = 2;
+
+struct CacheHeader {
+    std::uint32_t magic = CACHE_MAGIC;
+    std::uint32_t version = CACHE_VERSION;
+    std::uint64_t key = 0;
+    std::uint64_t payload_size = 0;
+    std::uint64_t checksum = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<CacheHeader>);
+static_assert(std::is_trivially_copyable_v<CachedGlyph>);
+static_assert(sizeof(CachedGlyph) == 11 * sizeof(float), "CachedGlyph is written without padding");
+
+// FNV-1a over 64-bit words: only guards against torn or corrupted files, and hashing
+// the pixels a byte at a time would cost more than reading them
+std::uint64_t checksumOf(std::string_view payload) noexcept {
+    constexpr std::uint64_t offset_basis = 14695981039346656037ULL;
+    constexpr std::uint64_t prime = 1099511628211ULL;
+
+    std::uint64_t hash = offset_basis;
+    std::size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= payload.size(); i += sizeof(std::uint64_t)) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, payload.data() + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < payload.size(); ++i) {
+        hash = (hash ^ static_cast<unsigned char>(payload[i])) * prime;
+    }
+    return hash;
+}
+
+std::string serializePayload(const CachedFontAtlas& atlas) {
+    ByteWriter writer;
+    writer.write(atlas.width);
+    writer.write(atlas.height);
+    writer.write(atlas.white_pixel_uv);
+    writer.write(static_cast<std::uint32_t>(atlas.line_uvs.size()));
+    writer.write(static_cast<std::uint32_t>(atlas.fonts.size()));
+    writer.writeSpan(std::span{atlas.line_uvs});
+
+    for (const CachedFont& font : atlas.fonts) {
+        writer.write(font.size);
+        writer.write(font.ascent);
+        writer.write(font.descent);
+        writer.write(font.ellipsis_char);
+        writer.write(font.fallback_char);
+        writer.write(static_cast<std::uint32_t>(font.glyphs.size()));
+        writer.writeSpan(std::span{font.glyphs});
+    }
+
+    writer.writeSpan(std::span{atlas.pixels});
+    return writer.bytes();
+}
+
+std::optional<CachedFontAtlas> deserializePayload(std::span<const char> payload) {
+    ByteReader reader(payload);
+    CachedFontAtlas atlas;
+    std::uint32_t line_uv_count = 0;
+    std::uint32_t font_count = 0;
+    if (!reader.read(atlas.width) || !reader.read(atlas.height) || !reader.read(atlas.white_pixel_uv) ||
+        !reader.read(line_uv_count) || !reader.read(font_count) || !reader.readVector(atlas.line_uvs, line_uv_count)) {
+        return std::nullopt;
+    }
+    if (atlas.width <= 0 || atlas.height <= 0) {
+        return std::nullopt;
+    }
+
+    atlas.fonts.resize(font_count);
+    for (CachedFont& font : atlas.fonts) {
+        std::uint32_t glyph_count = 0;
+        if (!reader.read(font.size) || !reader.read(font.ascent) || !reader.read(font.descent) ||
+            !reader.read(font.ellipsis_char) || !reader.read(font.fallback_char) || !reader.read(glyph_count) ||
+            !reader.readVector(font.glyphs, glyph_count)) {
+            return std::nullopt;
+        }
+    }
+
+    const auto pixel_count = static_cast<std::size_t>(atlas.width) * static_cast<std::size_t>(atlas.height);
+    if (reader.remaining() != pixel_count || !reader.readVector(atlas.pixels, pixel_count)) {
+        return std::nullopt;
+    }
+    return atlas;
+}
+} // namespace
+
+FontAtlasCache::FontAtlasCache(std::filesystem::path path) : m_path(std::move(path)) {
+}
+
+std::filesystem::path FontAtlasCache::pathForScale(const std::filesystem::path& directory, float scale) {
+    const long percent = std::lround(scale * 100.0f);
+    if (percent == 100) {
+        return directory / DEFAULT_FILENAME;
+    }
+    return directory / ("workbalance_fonts_" + std::to_string(percent) + ".cache");
+}
+
+std::expected<CachedFontAtlas, Core::PersistenceError> FontAtlasCache::load(std::uint64_t key) const {
+    using Core::PersistenceError;
+
+    if (!std::filesystem::exists(m_path)) {
+        return std::unexpected(PersistenceError::FileNotFound);
+    }
+
+    std::ifstream file(m_path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return std::unexpected(PersistenceError::FileOpenError);
+    }
+
+    // One sequential read of the whole file; the pixels dominate and are copied into ImGui anyway
+    std::string contents(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!file.read(contents.data(), static_cast<std::streamsize>(contents.size()))) {
+        return std::unexpected(PersistenceError::ParseError);
+    }
+    ByteReader reader(contents);
+    CacheHeader header;
+    if (!reader.read(header) || header.magic != CACHE_MAGIC) {
+        return std::unexpected(PersistenceError::ParseError);
+    }
+    if (header.version != CACHE_VERSION || header.key != key) {
+        return std::unexpected(PersistenceError::CacheMismatch);
+    }
+
+    const std::string_view payload = std::string_view{contents}.substr(sizeof(CacheHeader));
+    if (payload.size() != header.payload_size || checksumOf(payload) != header.checksum) {
+        return std::unexpected(PersistenceError::ParseError);
+    }
+
+    auto atlas = deserializePayload(payload);
+    if (!atlas) {
+        return std::unexpected(PersistenceError::ParseError);
+    }
+    return std::move(*atlas);
+}
+
+std::expected<void, Core::PersistenceError> FontAtlasCache::save(std::uint64_t key,
+                                                                 const CachedFontAtlas& atlas) const {
+    using Core::PersistenceError;
+
+    try {
+        const std::string payload = serializePayload(atlas);
+        CacheHeader header;
+        header.key = key;
+        header.payload_size = payload.size();
+        header.checksum = checksumOf(payload);
+
+        std::string contents(reinterpret_cast<const char*>(&header), sizeof(header));
+        contents += payload;
+        // A crash mid-write must never leave a half-written cache in place
+        return Core::writeFileAtomically(m_path, contents);
+    } catch (const std::exception& e) {
+        std::cerr << "Error writing font cache: " << e.what() << '\n';
+        return std::unexpected(PersistenceError::WriteError);
+    }
+}
+
+} // namespace WorkBalance::App
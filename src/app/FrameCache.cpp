@@ -0,0 +1,35 @@
+#include <app/FrameCache.h>
+
+namespace WorkBalance::App {
+
+FrameCache::Action FrameCache::beginFrame(std::uint64_t signature, bool force_build) noexcept {
+    const bool changed = force_build || !m_has_frame || signature != m_last_signature;
+    m_last_signature = signature;
+
+    if (changed) {
+        m_settle_frames = SETTLE_FRAMES;
+    }
+
+    const bool settling = !changed && m_settle_frames > 0;
+    if (changed || settling || (m_framebuffer_damaged && !m_draw_data_valid)) {
+        if (settling) {
+            --m_settle_frames;
+        }
+        m_has_frame = true;
+        m_draw_data_valid = true;
+        m_framebuffer_damaged = false;
+        ++m_stats.frames_built;
+        return Action::Build;
+    }
+
+    if (m_framebuffer_damaged) {
+        m_framebuffer_damaged = false;
+        ++m_stats.frames_reused;
+        return Action::Reuse;
+    }
+
+    ++m_stats.frames_skipped;
+    return Action::Skip;
+}
+
+} // namespace WorkBalance::App
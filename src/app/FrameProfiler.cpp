@@ -0,0 +1,65 @@
+#include <app/FrameProfiler.h>
+
+#include <algorithm>
+
+namespace WorkBalance::App {
+namespace {
+[[nodiscard]] float toMilliseconds(FrameProfiler::Clock::duration duration) noexcept {
+    return std::chrono::duration<float, std::milli>(duration).count();
+}
+} // namespace
+
+void FrameProfiler::beginFrame(Clock::time_point now, std::uint64_t allocations) noexcept {
+    m_current = Sample{};
+    if (m_has_previous) {
+        m_current.interval_ms = toMilliseconds(now - m_previous_start);
+        m_current.idle_ms = toMilliseconds(now - m_previous_end);
+    }
+    m_frame_start = now;
+    m_allocations_at_start = allocations;
+}
+
+void FrameProfiler::endFrame(Clock::time_point now, std::uint64_t allocations) noexcept {
+    m_current.cpu_ms = toMilliseconds(now - m_frame_start);
+    m_current.allocations = allocations - m_allocations_at_start;
+
+    m_samples[m_next] = m_current;
+    m_intervals_ms[m_next] = m_current.interval_ms;
+    m_next = (m_next + 1) % HISTORY;
+    m_count = std::min(m_count + 1, HISTORY);
+
+    m_previous_start = m_frame_start;
+    m_previous_end = now;
+    m_has_previous = true;
+}
+
+void FrameProfiler::addStageTime(Stage stage, Clock::duration duration) noexcept {
+    m_current.stage_ms[static_cast<std::size_t>(stage)] += toMilliseconds(duration);
+}
+
+FrameProfiler::Summary FrameProfiler::summarize() const noexcept {
+    Summary summary;
+    if (m_count == 0) {
+        return summary;
+    }
+
+    for (std::size_t i = 0; i < m_count; ++i) {
+        const Sample& sample = m_samples[i];
+        summary.average_interval_ms += sample.interval_ms;
+        summary.max_interval_ms = std::max(summary.max_interval_ms, sample.interval_ms);
+        summary.average_cpu_ms += sample.cpu_ms;
+        for (std::size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+            summary.average_stage_ms[stage] += sample.stage_ms[stage];
+        }
+    }
+
+    const auto count = static_cast<float>(m_count);
+    summary.average_interval_ms /= count;
+    summary.average_cpu_ms /= count;
+    for (float& stage_ms : summary.average_stage_ms) {
+        stage_ms /= count;
+    }
+    return summary;
+}
+
+} // namespace WorkBalance::App
@@ -4,17 +4,197 @@
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 
+#include <array>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <mutex>
+#include <span>
 #include <string_view>
 
-#include "assets/embedded_resources.h"
 #include "assets/fonts/IconsFontAwesome5Pro.h"
+#include <app/FontAtlasCache.h>
+#include <app/FrameCache.h>
 #include <core/Configuration.h>
+#include <core/MemoryAccounting.h>
+#include <core/Trace.h>
+#include <system/EmbeddedResources.h>
 
 namespace WorkBalance::App {
-ImGuiLayer::ImGuiLayer(GLFWwindow* window) {
+namespace {
+// Characters each display face can be asked to draw. Anything outside a set renders as the
+// '?' fallback, so extend the set together with any new text drawn in that font.
+constexpr std::array TIMER_FONT_GLYPHS = {"0123456789:?"};                   // TimeFormatter::formatTime
+constexpr std::array BUTTON_FONT_GLYPHS = {"ABCDEFGHIJKLMNOPQRSTUVWXYZ ?"}; // Upper-case button labels
+constexpr std::array OVERLAY_FONT_GLYPHS = {"0123456789: |?"};              // Overlay timers and separators
+
+// Icons drawn with the regular UI font
+constexpr std::array UI_ICONS = {
+    ICON_FA_ARCHIVE, ICON_FA_ARROW_UP, ICON_FA_CLOCK, ICON_FA_COFFEE, ICON_FA_COG, ICON_FA_DESKTOP, ICON_FA_EYE,
+    ICON_FA_EYE_SLASH, ICON_FA_GRIP_VERTICAL, ICON_FA_HEART, ICON_FA_KEYBOARD, ICON_FA_LIGHTBULB, ICON_FA_MINUS,
+    ICON_FA_PEN, ICON_FA_PLUS, ICON_FA_POWER_OFF, ICON_FA_QUESTION_CIRCLE, ICON_FA_REDO, ICON_FA_SAVE, ICON_FA_SEARCH,
+    ICON_FA_STOPWATCH, ICON_FA_SYNC, ICON_FA_TASKS, ICON_FA_TIMES, ICON_FA_TINT, ICON_FA_TINT_SLASH, ICON_FA_TRASH,
+    ICON_FA_UNDO, ICON_FA_VOLUME_UP, ICON_FA_WALKING, ICON_FA_WINDOW_MAXIMIZE, ICON_FA_WINDOW_MINIMIZE};
+
+// Icons TimeFormatter puts into the overlay strings
+constexpr std::array OVERLAY_ICONS = {ICON_FA_CLOCK, ICON_FA_COFFEE, ICON_FA_TINT, ICON_FA_WALKING, ICON_FA_EYE};
+
+void* allocateTracked(size_t size, void* /*user_data*/) {
+    return Core::MemoryAccounting::allocate(Core::MemoryTag::ImGui, size);
+}
+
+void freeTracked(void* pointer, void* /*user_data*/) {
+    Core::MemoryAccounting::deallocate(Core::MemoryTag::ImGui, pointer);
+}
+
+// Must run before ImGui allocates anything: a block malloc'd earlier would later reach freeTracked
+void installAllocatorHooks() {
+    static std::once_flag installed;
+    std::call_once(installed, [] { ImGui::SetAllocatorFunctions(allocateTracked, freeTracked); });
+}
+
+ImVector<ImWchar> buildGlyphRanges(std::span<const char* const> texts) {
+    ImFontGlyphRangesBuilder builder;
+    for (const char* text : texts) {
+        builder.AddText(text);
+    }
+
+    ImVector<ImWchar> ranges;
+    builder.BuildRanges(&ranges);
+    return ranges;
+}
+
+// Hash every input that influences the baked atlas, so any change to fonts, sizes,
+// ranges or the ImGui version invalidates the cache
+std::uint64_t computeFontAtlasKey(const ImFontAtlas& atlas) {
+    FrameSignature key;
+    key.add(IMGUI_VERSION_NUM).add(atlas.Flags).add(atlas.TexGlyphPadding).add(atlas.TexDesiredWidth);
+    for (const ImFontConfig& config : atlas.ConfigData) {
+        key.add(std::string_view{static_cast<const char*>(config.FontData), static_cast<size_t>(config.FontDataSize)});
+        key.add(config.FontNo)
+            .add(config.SizePixels)
+            .add(config.OversampleH)
+            .add(config.OversampleV)
+            .add(config.PixelSnapH)
+            .add(config.GlyphOffset)
+            .add(config.GlyphMinAdvanceX)
+            .add(config.GlyphMaxAdvanceX)
+            .add(config.MergeMode);
+        for (const ImWchar* range = config.GlyphRanges; range != nullptr && *range != 0; ++range) {
+            key.add(*range);
+        }
+        key.add(ImWchar{0});
+    }
+    return key.value();
+}
+
+CachedFontAtlas captureFontAtlas(ImFontAtlas& atlas) {
+    unsigned char* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+
+    CachedFontAtlas cached;
+    cached.width = width;
+    cached.height = height;
+    cached.pixels.assign(pixels, pixels + static_cast<size_t>(width) * static_cast<size_t>(height));
+    cached.white_pixel_uv = {atlas.TexUvWhitePixel.x, atlas.TexUvWhitePixel.y};
+    for (const ImVec4& uv : atlas.TexUvLines) {
+        cached.line_uvs.push_back({uv.x, uv.y, uv.z, uv.w});
+    }
+
+    for (const ImFont* font : atlas.Fonts) {
+        CachedFont& cached_font = cached.fonts.emplace_back();
+        cached_font.size = font->FontSize;
+        cached_font.ascent = font->Ascent;
+        cached_font.descent = font->Descent;
+        cached_font.ellipsis_char = font->EllipsisChar;
+        cached_font.fallback_char = font->FallbackChar;
+        for (const ImFontGlyph& glyph : font->Glyphs) {
+            const std::uint32_t flags = (glyph.Colored != 0 ? CachedGlyph::FLAG_COLORED : 0U) |
+                                        (glyph.Visible != 0 ? CachedGlyph::FLAG_VISIBLE : 0U);
+            cached_font.glyphs.push_back(CachedGlyph{glyph.Codepoint, flags, glyph.AdvanceX, glyph.X0, glyph.Y0,
+                                                     glyph.X1, glyph.Y1, glyph.U0, glyph.V0, glyph.U1, glyph.V1});
+        }
+    }
+    return cached;
+}
+
+// Install previously baked output into an atlas whose fonts were added but not built
+bool restoreFontAtlas(ImFontAtlas& atlas, const CachedFontAtlas& cached) {
+    if (cached.fonts.size() != static_cast<size_t>(atlas.Fonts.Size) ||
+        cached.line_uvs.size() != std::size(atlas.TexUvLines)) {
+        return false;
+    }
+
+    atlas.ClearTexData();
+    atlas.TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(cached.pixels.size()));
+    std::memcpy(atlas.TexPixelsAlpha8, cached.pixels.data(), cached.pixels.size());
+    atlas.TexWidth = cached.width;
+    atlas.TexHeight = cached.height;
+    atlas.TexUvScale = ImVec2(1.0f / static_cast<float>(cached.width), 1.0f / static_cast<float>(cached.height));
+    atlas.TexUvWhitePixel = ImVec2(cached.white_pixel_uv[0], cached.white_pixel_uv[1]);
+    for (size_t i = 0; i < cached.line_uvs.size(); ++i) {
+        const auto& uv = cached.line_uvs[i];
+        atlas.TexUvLines[i] = ImVec4(uv[0], uv[1], uv[2], uv[3]);
+    }
+
+    for (int i = 0; i < atlas.Fonts.Size; ++i) {
+        ImFont* font = atlas.Fonts[i];
+        const CachedFont& cached_font = cached.fonts[static_cast<size_t>(i)];
+        font->ClearOutputData();
+        font->ContainerAtlas = &atlas;
+        font->FontSize = cached_font.size;
+        font->Ascent = cached_font.ascent;
+        font->Descent = cached_font.descent;
+        // Set before BuildLookupTable() so it keeps the characters Build() picked
+        font->EllipsisChar = static_cast<ImWchar>(cached_font.ellipsis_char);
+        font->FallbackChar = static_cast<ImWchar>(cached_font.fallback_char);
+        for (const CachedGlyph& cached_glyph : cached_font.glyphs) {
+            ImFontGlyph glyph{};
+            glyph.Colored = (cached_glyph.flags & CachedGlyph::FLAG_COLORED) != 0 ? 1U : 0U;
+            glyph.Visible = (cached_glyph.flags & CachedGlyph::FLAG_VISIBLE) != 0 ? 1U : 0U;
+            glyph.Codepoint = cached_glyph.codepoint;
+            glyph.AdvanceX = cached_glyph.advance_x;
+            glyph.X0 = cached_glyph.x0;
+            glyph.Y0 = cached_glyph.y0;
+            glyph.X1 = cached_glyph.x1;
+            glyph.Y1 = cached_glyph.y1;
+            glyph.U0 = cached_glyph.u0;
+            glyph.V0 = cached_glyph.v0;
+            glyph.U1 = cached_glyph.u1;
+            glyph.V1 = cached_glyph.v1;
+            font->Glyphs.push_back(glyph);
+        }
+    }
+
+    // Link each font to the configs it was built from, as Build() does; lookup tables and
+    // text rendering read them
+    for (ImFontConfig& config : atlas.ConfigData) {
+        ImFont* font = config.DstFont;
+        if (!config.MergeMode) {
+            font->ConfigData = &config;
+            font->ConfigDataCount = 0;
+        }
+        ++font->ConfigDataCount;
+    }
+    for (ImFont* font : atlas.Fonts) {
+        font->BuildLookupTable();
+    }
+
+    atlas.TexReady = true;
+    return true;
+}
+} // namespace
+
+ImGuiLayer::ImGuiLayer(GLFWwindow* window, const std::filesystem::path& font_cache_path)
+    : ImGuiLayer(window, loadFonts(font_cache_path)) {
+}
+
+ImGuiLayer::ImGuiLayer(GLFWwindow* window, std::unique_ptr<Fonts> fonts) : m_fonts(std::move(fonts)) {
     IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
+    ImGui::CreateContext(&m_fonts->atlas);
 
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
@@ -23,8 +203,7 @@ ImGuiLayer::ImGuiLayer(GLFWwindow* window) {
     // Disable automatic imgui.ini file creation - we handle persistence ourselves
     io.IniFilename = nullptr;
 
-    loadFonts(io);
-    applyStyle();
+    applyStyle(m_fonts->scale);
 
     if (window != nullptr) {
         ImGui_ImplGlfw_InitForOpenGL(window, true);
@@ -48,6 +227,23 @@ ImGuiLayer::~ImGuiLayer() {
     ImGui::DestroyContext();
 }
 
+void ImGuiLayer::setFonts(std::unique_ptr<Fonts> fonts) {
+    if (m_owns_backends) {
+        ImGui_ImplOpenGL3_DestroyFontsTexture();
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.Fonts = &fonts->atlas;
+    io.FontDefault = nullptr;
+    // The previous fonts are released at the end of this scope, once the context no longer uses them
+    std::swap(m_fonts, fonts);
+    applyStyle(m_fonts->scale);
+
+    if (m_owns_backends) {
+        ImGui_ImplOpenGL3_CreateFontsTexture();
+    }
+}
+
 void ImGuiLayer::newFrame() {
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
@@ -55,20 +251,74 @@ void ImGuiLayer::newFrame() {
 }
 
 void ImGuiLayer::render() {
+    const Core::TraceZone zone{"ImGuiLayer::render"};
     ImGui::Render();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
 
-void ImGuiLayer::loadFonts(ImGuiIO& io) {
-    ImGui::StyleColorsDark();
+void ImGuiLayer::renderCachedDrawData() {
+    if (ImDrawData* draw_data = ImGui::GetDrawData(); draw_data != nullptr) {
+        ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+    }
+}
+
+DrawDataSnapshot::~DrawDataSnapshot() {
+    clear();
+}
+
+void DrawDataSnapshot::capture(const ImDrawData* draw_data) {
+    clear();
+    if (draw_data == nullptr || !draw_data->Valid) {
+        return;
+    }
+
+    for (ImDrawList* list : draw_data->CmdLists) {
+        m_lists.push_back(list->CloneOutput());
+    }
+
+    m_draw_data.Valid = true;
+    m_draw_data.DisplayPos = draw_data->DisplayPos;
+    m_draw_data.DisplaySize = draw_data->DisplaySize;
+    m_draw_data.FramebufferScale = draw_data->FramebufferScale;
+    for (ImDrawList* list : m_lists) {
+        m_draw_data.AddDrawList(list);
+    }
+}
+
+void DrawDataSnapshot::render() {
+    if (!m_draw_data.Valid) {
+        return;
+    }
+    ImGui_ImplOpenGL3_RenderDrawData(&m_draw_data);
+}
+
+void DrawDataSnapshot::clear() noexcept {
+    m_draw_data.Clear();
+    for (ImDrawList* list : m_lists) {
+        IM_DELETE(list);
+    }
+    m_lists.clear();
+}
+
+std::unique_ptr<ImGuiLayer::Fonts> ImGuiLayer::loadFonts(const std::filesystem::path& font_cache_path, float scale) {
+    // Every ImGui allocation, from this atlas to the context built on it, is accounted under MemoryTag::ImGui
+    installAllocatorHooks();
+    auto fonts = std::make_unique<Fonts>();
+    fonts->scale = scale;
+    ImFontAtlas& atlas = fonts->atlas;
 
+    // The font files stay resident in the resource pack, so the atlas only borrows them
     ImFontConfig base_config{};
     base_config.FontDataOwnedByAtlas = false;
 
-    const auto addFont = [&](ImFontConfig config, const unsigned char* data, size_t data_size, float font_size,
+    namespace Resources = System::Resources;
+    const auto addFont = [&](ImFontConfig config, std::string_view resource, float font_size,
                              std::string_view warning, const ImWchar* ranges = nullptr) -> ImFont* {
-        ImFont* font = io.Fonts->AddFontFromMemoryTTF(static_cast<void*>(const_cast<unsigned char*>(data)),
-                                                      static_cast<int>(data_size), font_size, &config, ranges);
+        const auto data = System::getEmbeddedResources().get(resource);
+        ImFont* font = data.empty() ? nullptr
+                                    : atlas.AddFontFromMemoryTTF(const_cast<std::uint8_t*>(data.data()),
+                                                                 static_cast<int>(data.size()), font_size * scale,
+                                                                 &config, ranges);
 
         if (font == nullptr && !warning.empty()) {
             std::cerr << "Warning: " << warning << '\n';
@@ -77,44 +327,95 @@ void ImGuiLayer::loadFonts(ImGuiIO& io) {
     };
 
     ImFontConfig roboto_config = base_config;
-    m_large_font =
-        addFont(roboto_config, roboto_medium_data, roboto_medium_data_size, Core::Configuration::REGULAR_FONT_SIZE,
+    fonts->large =
+        addFont(roboto_config, Resources::ROBOTO_MEDIUM_FONT, Core::Configuration::REGULAR_FONT_SIZE,
                 "Failed to load embedded Roboto font. Using default font.");
-    if (m_large_font == nullptr) {
-        m_large_font = io.Fonts->AddFontDefault();
+    if (fonts->large == nullptr) {
+        fonts->large = atlas.AddFontDefault();
     }
 
-    constexpr ImWchar icons_ranges[] = {0xf000, 0xf8ff, 0};
+    // The regular font keeps ImGui's default ranges for user-entered text; the icon and display
+    // faces only bake what they draw, which keeps the large timer sizes from dominating the atlas
+    fonts->icon_glyphs = buildGlyphRanges(UI_ICONS);
+    fonts->timer_glyphs = buildGlyphRanges(TIMER_FONT_GLYPHS);
+    fonts->button_glyphs = buildGlyphRanges(BUTTON_FONT_GLYPHS);
+    fonts->overlay_glyphs = buildGlyphRanges(OVERLAY_FONT_GLYPHS);
+    fonts->overlay_icon_glyphs = buildGlyphRanges(OVERLAY_ICONS);
+
     ImFontConfig icons_config = base_config;
     icons_config.MergeMode = true;
     icons_config.PixelSnapH = true;
-    icons_config.GlyphMinAdvanceX = Core::Configuration::REGULAR_FONT_SIZE;
-    addFont(icons_config, fontawesome_data, fontawesome_data_size, Core::Configuration::REGULAR_FONT_SIZE,
-            "Failed to load embedded FontAwesome", icons_ranges);
+    icons_config.GlyphMinAdvanceX = Core::Configuration::REGULAR_FONT_SIZE * scale;
+    addFont(icons_config, Resources::FONT_AWESOME_FONT, Core::Configuration::REGULAR_FONT_SIZE,
+            "Failed to load embedded FontAwesome", fonts->icon_glyphs.Data);
 
     ImFontConfig formula_config = base_config;
-    m_timer_font = addFont(formula_config, formula1_bold_data, formula1_bold_data_size,
-                           Core::Configuration::TIMER_FONT_SIZE, "Failed to load embedded Formula1-Bold font");
-    m_button_font = addFont(formula_config, formula1_wide_data, formula1_wide_data_size,
-                            Core::Configuration::BUTTON_FONT_SIZE, "Failed to load embedded Formula1-Wide font");
-    m_overlay_font = addFont(formula_config, formula1_regular_data, formula1_regular_data_size,
-                             Core::Configuration::OVERLAY_FONT_SIZE, "Failed to load embedded Formula1-Regular font");
+    // Horizontal oversampling buys nothing visible at display sizes but doubles their atlas area
+    ImFontConfig display_config = base_config;
+    display_config.OversampleH = 1;
+    fonts->timer = addFont(display_config, Resources::FORMULA1_BOLD_FONT, Core::Configuration::TIMER_FONT_SIZE,
+                           "Failed to load embedded Formula1-Bold font", fonts->timer_glyphs.Data);
+    fonts->button = addFont(formula_config, Resources::FORMULA1_WIDE_FONT, Core::Configuration::BUTTON_FONT_SIZE,
+                            "Failed to load embedded Formula1-Wide font", fonts->button_glyphs.Data);
+    fonts->overlay = addFont(display_config, Resources::FORMULA1_REGULAR_FONT, Core::Configuration::OVERLAY_FONT_SIZE,
+                             "Failed to load embedded Formula1-Regular font", fonts->overlay_glyphs.Data);
 
     // Add icons to overlay font
     ImFontConfig overlay_icons_config = base_config;
     overlay_icons_config.MergeMode = true;
     overlay_icons_config.PixelSnapH = true;
-    overlay_icons_config.GlyphMinAdvanceX = Core::Configuration::OVERLAY_FONT_SIZE;
-    addFont(overlay_icons_config, fontawesome_data, fontawesome_data_size, Core::Configuration::OVERLAY_FONT_SIZE,
-            "Failed to load embedded FontAwesome for overlay", icons_ranges);
+    overlay_icons_config.GlyphMinAdvanceX = Core::Configuration::OVERLAY_FONT_SIZE * scale;
+    addFont(overlay_icons_config, Resources::FONT_AWESOME_FONT, Core::Configuration::OVERLAY_FONT_SIZE,
+            "Failed to load embedded FontAwesome for overlay", fonts->overlay_icon_glyphs.Data);
 
-    if (!io.Fonts->Build()) {
+    buildFontAtlas(*fonts, font_cache_path);
+    return fonts;
+}
+
+void ImGuiLayer::buildFontAtlas(Fonts& fonts, const std::filesystem::path& font_cache_path) {
+    ImFontAtlas& atlas = fonts.atlas;
+    const auto start = std::chrono::steady_clock::now();
+    const auto finish = [&](bool from_cache) {
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        // The OpenGL backend uploads the atlas as RGBA32
+        const auto texture_bytes = static_cast<size_t>(atlas.TexWidth) * static_cast<size_t>(atlas.TexHeight) * 4;
+        fonts.stats = FontLoadStats{elapsed.count(), from_cache, texture_bytes};
+    };
+
+    if (font_cache_path.empty()) {
+        if (!atlas.Build()) {
+            std::cerr << "Error: Failed to build ImGui font atlas\n";
+        }
+        finish(false);
+        return;
+    }
+
+    const FontAtlasCache cache(font_cache_path);
+    const std::uint64_t key = computeFontAtlasKey(atlas);
+    if (auto cached = cache.load(key); cached && restoreFontAtlas(atlas, *cached)) {
+        finish(true);
+        return;
+    }
+
+    if (!atlas.Build()) {
         std::cerr << "Error: Failed to build ImGui font atlas\n";
+        finish(false);
+        return;
+    }
+
+    if (auto saved = cache.save(key, captureFontAtlas(atlas)); !saved) {
+        std::cerr << "Warning: Failed to cache font atlas: " << Core::getPersistenceErrorMessage(saved.error())
+                  << '\n';
     }
+    finish(false);
 }
 
-void ImGuiLayer::applyStyle() {
+void ImGuiLayer::applyStyle(float scale) {
+    // Start from the defaults so a second call scales the base sizes, not the scaled ones
     ImGuiStyle& style = ImGui::GetStyle();
+    style = ImGuiStyle();
+    ImGui::StyleColorsDark(&style);
+
     style.WindowRounding = Core::Configuration::WINDOW_ROUNDING;
     style.FrameRounding = Core::Configuration::FRAME_ROUNDING;
     style.PopupRounding = Core::Configuration::FRAME_ROUNDING;
@@ -131,6 +432,9 @@ void ImGuiLayer::applyStyle() {
     colors[ImGuiCol_ButtonHovered] = ImVec4(1.0f, 1.0f, 1.0f, 0.2f);
     colors[ImGuiCol_ButtonActive] = ImVec4(1.0f, 1.0f, 1.0f, 0.3f);
     colors[ImGuiCol_Text] = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    // Padding, spacing and rounding follow the fonts to the monitor's DPI
+    style.ScaleAllSizes(scale);
 }
 
 } // namespace WorkBalance::App
@@ -0,0 +1,59 @@
+#include <app/StartupProfiler.h>
+
+#include <core/Persistence.h>
+
+#include <format>
+
+namespace WorkBalance::App {
+
+StartupProfiler::StartupProfiler(Clock::time_point origin) : m_origin(origin), m_last_lap(origin) {
+}
+
+void StartupProfiler::lap(std::string_view name) {
+    lap(name, Clock::now());
+}
+
+void StartupProfiler::lap(std::string_view name, Clock::time_point now) {
+    const double start_ms = millisecondsSinceOrigin(m_last_lap);
+    m_phases.push_back(Phase{std::string(name), start_ms, millisecondsSinceOrigin(now) - start_ms});
+    m_last_lap = now;
+}
+
+void StartupProfiler::addValue(std::string_view name, double value) {
+    m_values.push_back(Value{std::string(name), value});
+}
+
+void StartupProfiler::markFirstFrame() {
+    markFirstFrame(Clock::now());
+}
+
+void StartupProfiler::markFirstFrame(Clock::time_point now) {
+    if (!m_first_frame_ms) {
+        m_first_frame_ms = millisecondsSinceOrigin(now);
+    }
+}
+
+std::string StartupProfiler::toJson() const {
+    std::string json = "{\"phases\":[";
+    for (size_t i = 0; i < m_phases.size(); ++i) {
+        const Phase& phase = m_phases[i];
+        json += std::format("{}{{\"name\":\"{}\",\"start_ms\":{:.3f},\"duration_ms\":{:.3f}}}", i == 0 ? "" : ",",
+                            Core::escapeJson(phase.name), phase.start_ms, phase.duration_ms);
+    }
+
+    json += "],\"values\":{";
+    for (size_t i = 0; i < m_values.size(); ++i) {
+        json += std::format("{}\"{}\":{}", i == 0 ? "" : ",", Core::escapeJson(m_values[i].name), m_values[i].value);
+    }
+
+    json += "},\"time_to_first_frame_ms\":";
+    json += m_first_frame_ms ? std::format("{:.3f}", *m_first_frame_ms) : "null";
+    json += '}';
+    return json;
+}
+
+double StartupProfiler::millisecondsSinceOrigin(Clock::time_point time) const {
+    return std::chrono::duration<double, std::milli>(time - m_origin).count();
+}
+
+} // namespace WorkBalance::App
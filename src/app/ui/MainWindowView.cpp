@@ -15,31 +15,12 @@
 
 #include "assets/fonts/IconsFontAwesome5Pro.h"
 #include <core/Configuration.h>
+#include <core/Trace.h>
 #include <core/WellnessTypes.h>
 #include <ui/AppState.h>
 
 namespace WorkBalance::App::UI {
 namespace {
-struct WindowCoordinates {
-    int window_x = 0;
-    int window_y = 0;
-    double cursor_x = 0.0;
-    double cursor_y = 0.0;
-};
-
-[[nodiscard]] WindowCoordinates queryWindowCoordinates(GLFWwindow* handle) {
-    WindowCoordinates coordinates{};
-    if (handle == nullptr) {
-        return coordinates;
-    }
-
-    glfwGetWindowPos(handle, &coordinates.window_x, &coordinates.window_y);
-    glfwGetCursorPos(handle, &coordinates.cursor_x, &coordinates.cursor_y);
-    coordinates.cursor_x += static_cast<double>(coordinates.window_x);
-    coordinates.cursor_y += static_cast<double>(coordinates.window_y);
-    return coordinates;
-}
-
 class ScopedFont {
   public:
     explicit ScopedFont(ImFont* font) : m_font(font) {
@@ -75,17 +56,17 @@ class ScopedFont {
     return ImGui::CalcTextSize(start, end);
 }
 
-void updateWindowDragging(GLFWwindow* handle, bool hovered, bool& dragging, ImVec2& offset,
+// Reads the cached geometry, so dragging costs no display server round trips per mouse move
+void updateWindowDragging(System::WindowBase& window, bool hovered, bool& dragging, ImVec2& offset,
                           float drag_threshold = 0.0f) {
-    if (handle == nullptr) {
+    if (window.get() == nullptr) {
         dragging = false;
         return;
     }
 
     if (hovered && ImGui::IsMouseClicked(0)) {
-        const WindowCoordinates coordinates = queryWindowCoordinates(handle);
-        offset = ImVec2(static_cast<float>(coordinates.cursor_x - coordinates.window_x),
-                        static_cast<float>(coordinates.cursor_y - coordinates.window_y));
+        const System::WindowGeometry& geometry = window.geometry();
+        offset = ImVec2(static_cast<float>(geometry.cursor_x), static_cast<float>(geometry.cursor_y));
         dragging = true;
     }
 
@@ -94,10 +75,10 @@ void updateWindowDragging(GLFWwindow* handle, bool hovered, bool& dragging, ImVe
     }
 
     if (ImGui::IsMouseDragging(0, drag_threshold)) {
-        const WindowCoordinates coordinates = queryWindowCoordinates(handle);
-        const int new_x = static_cast<int>(coordinates.cursor_x - offset.x);
-        const int new_y = static_cast<int>(coordinates.cursor_y - offset.y);
-        glfwSetWindowPos(handle, new_x, new_y);
+        const auto [cursor_x, cursor_y] = window.getCursorScreenPosition();
+        const int new_x = static_cast<int>(cursor_x - offset.x);
+        const int new_y = static_cast<int>(cursor_y - offset.y);
+        window.setPosition(new_x, new_y);
     }
 
     if (ImGui::IsMouseReleased(0)) {
@@ -138,7 +119,9 @@ MainWindowView::MainWindowView(System::MainWindow& window, App::ImGuiLayer& imgu
                                              .onTaskRemoved = m_callbacks.onTaskRemoved,
                                              .onTaskUpdated = m_callbacks.onTaskUpdated,
                                              .onTaskToggled = m_callbacks.onTaskCompletionToggled,
-                                             .onTaskMoved = m_callbacks.onTaskMoved});
+                                             .onTaskMoved = m_callbacks.onTaskMoved,
+                                             .onArchiveSearch = m_callbacks.onArchiveSearch,
+                                             .onArchivedTaskRestored = m_callbacks.onArchivedTaskRestored});
 }
 
 void MainWindowView::setWellnessTimers(Core::WellnessTimer* water, Core::WellnessTimer* standup,
@@ -148,6 +131,11 @@ void MainWindowView::setWellnessTimers(Core::WellnessTimer* water, Core::Wellnes
     m_eye_care_timer = eyeCare;
 }
 
+void MainWindowView::setFrameProfiler(const App::FrameProfiler* profiler) {
+    m_performance_hud =
+        profiler != nullptr ? std::make_unique<Components::PerformanceHud>(*profiler, m_state) : nullptr;
+}
+
 void MainWindowView::setWellnessCallbacks(WellnessCallbacks callbacks) {
     m_wellness_callbacks = std::move(callbacks);
 }
@@ -170,6 +158,7 @@ void MainWindowView::updateBackgroundColor() {
 }
 
 void MainWindowView::render() {
+    const Core::TraceZone zone{"MainWindowView::render"};
     const ImGuiViewport* viewport = ImGui::GetMainViewport();
 
     // Main window takes full viewport (tabs are now inside the window)
@@ -227,6 +216,10 @@ void MainWindowView::render() {
         }
     }
     ImGui::End();
+
+    if (m_performance_hud) {
+        m_performance_hud->render();
+    }
 }
 
 void MainWindowView::renderNavigationTabs(const ImVec2& window_pos, const ImVec2& window_size, float header_height) {
@@ -378,11 +371,9 @@ void MainWindowView::renderOverlayMode() {
     const int required_width = static_cast<int>(text_size.x + padding_x);
     const int required_height = static_cast<int>(text_size.y + padding_y);
 
-    int current_width = 0;
-    int current_height = 0;
-    glfwGetWindowSize(m_window.get(), &current_width, &current_height);
+    const auto [current_width, current_height] = m_window.getSize();
     if (current_width != required_width || current_height != required_height) {
-        glfwSetWindowSize(m_window.get(), required_width, required_height);
+        m_window.setSize(required_width, required_height);
     }
 
     const float window_width = ImGui::GetWindowSize().x;
@@ -407,7 +398,7 @@ void MainWindowView::renderOverlayMode() {
         }
     }
 
-    updateWindowDragging(m_window.get(), overlay_hovered, m_state.main_overlay_dragging,
+    updateWindowDragging(m_window, overlay_hovered, m_state.main_overlay_dragging,
                          m_state.main_overlay_drag_offset);
 }
 
@@ -723,6 +714,8 @@ void MainWindowView::renderHelpPopup() {
 
         ImGui::BulletText("SPACE - Start/Pause the timer");
         ImGui::BulletText("UP ARROW - Toggle overlay mode");
+        ImGui::BulletText("CTRL+Z - Undo last task edit");
+        ImGui::BulletText("CTRL+Y / CTRL+SHIFT+Z - Redo task edit");
         ImGui::Spacing();
         ImGui::Spacing();
 
@@ -841,7 +834,7 @@ void MainWindowView::renderCurrentTask() {
     }
 
     const auto& task = tasks[m_state.current_task_index];
-    const std::string current_task = "#" + std::to_string(m_state.current_task_index + 1) + " " + task.name + " (" +
+    const std::string current_task = "#" + std::to_string(m_state.current_task_index + 1) + " " + std::string(task.name) + " (" +
                                      std::to_string(task.completed_pomodoros) + "/" +
                                      std::to_string(task.estimated_pomodoros) + ")";
 
@@ -874,7 +867,7 @@ void MainWindowView::renderPomodoroCounter() const {
 
 void MainWindowView::handleWindowDragging() {
     const bool can_drag = ImGui::IsWindowHovered() && !ImGui::IsAnyItemHovered() && !ImGui::IsAnyItemActive();
-    updateWindowDragging(m_window.get(), can_drag, m_state.main_window_dragging, m_state.main_window_drag_offset, 5.0f);
+    updateWindowDragging(m_window, can_drag, m_state.main_window_dragging, m_state.main_window_drag_offset, 5.0f);
 }
 
 } // namespace WorkBalance::App::UI
@@ -3,15 +3,24 @@
 #include <GLFW/glfw3.h>
 
 #include <string>
+#include <string_view>
 
 #include "core/Configuration.h"
+#include <app/FrameCache.h>
 
 namespace WorkBalance::App::UI {
-void OverlayView::renderContent(System::OverlayWindow& overlay_window) {
-    const ImGuiWindowFlags overlay_flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoResize |
-                                           ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings |
-                                           ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
+std::uint64_t OverlayView::computeSignature(const System::OverlayWindow& overlay_window) {
+    updateDisplayText();
+
+    FrameSignature signature;
+    signature.add(std::string_view{m_display_text}).add(m_font_scale).add(m_state.background_color);
 
+    const auto [width, height] = overlay_window.getFramebufferSize();
+    signature.add(width).add(height);
+    return signature.value();
+}
+
+void OverlayView::updateDisplayText() {
     // Count active wellness timers that are visible in overlay to decide format
     int active_wellness_count = 0;
     if (m_water_timer != nullptr && m_water_timer->isRunning() && m_state.show_water_in_overlay) {
@@ -26,7 +35,8 @@ void OverlayView::renderContent(System::OverlayWindow& overlay_window) {
 
     // Build horizontal compact display: 🕐 25:00 | 💧 45m | 🚶 30m | 👁 20m
     // Use compact format for all timers when multiple are active
-    std::string display_str;
+    std::pmr::string& display_str = m_display_text;
+    display_str.clear();
     if (m_state.show_pomodoro_in_overlay) {
         if (active_wellness_count > 0) {
             // Multiple timers - use compact format for all (no seconds)
@@ -65,15 +75,30 @@ void OverlayView::renderContent(System::OverlayWindow& overlay_window) {
         display_str += WorkBalance::TimeFormatter::formatTimeCompact(m_eye_care_timer->getRemainingTime());
     }
 
+    m_font_scale = (active_wellness_count > 0) ? 0.7f : 1.0f;
+}
+
+void OverlayView::renderContent(System::OverlayWindow& overlay_window) {
+    const ImGuiWindowFlags overlay_flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoResize |
+                                           ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings |
+                                           ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
+
     // Calculate required window size based on text
     ImFont* overlay_font = m_imgui.overlayFont();
-    const float font_scale = (active_wellness_count > 0) ? 0.7f : 1.0f;
+    const std::pmr::string& display_str = m_display_text;
+    const float font_scale = m_font_scale;
 
-    ImGui::PushFont(overlay_font);
-    ImGui::SetWindowFontScale(font_scale);
-    ImVec2 text_size = ImGui::CalcTextSize(display_str.c_str());
-    ImGui::SetWindowFontScale(1.0f);
-    ImGui::PopFont();
+    // Text only needs measuring when it changes
+    if (display_str != m_measured_text || font_scale != m_measured_scale) {
+        ImGui::PushFont(overlay_font);
+        ImGui::SetWindowFontScale(font_scale);
+        m_text_size = ImGui::CalcTextSize(display_str.c_str());
+        ImGui::SetWindowFontScale(1.0f);
+        ImGui::PopFont();
+        m_measured_text = display_str;
+        m_measured_scale = font_scale;
+    }
+    const ImVec2 text_size = m_text_size;
 
     constexpr float padding_x = 40.0f; // Horizontal padding
     constexpr float padding_y = 20.0f; // Vertical padding
@@ -81,12 +106,13 @@ void OverlayView::renderContent(System::OverlayWindow& overlay_window) {
     const int required_height = static_cast<int>(text_size.y + padding_y);
 
     // Resize window if needed
-    const auto [current_width, current_height] = overlay_window.getFramebufferSize();
-    if (current_width != required_width || current_height != required_height) {
+    auto [overlay_width, overlay_height] = overlay_window.getFramebufferSize();
+    if (overlay_width != required_width || overlay_height != required_height) {
         overlay_window.setSize(required_width, required_height);
+        overlay_width = required_width;
+        overlay_height = required_height;
     }
 
-    const auto [overlay_width, overlay_height] = overlay_window.getFramebufferSize();
     // ImGui window fills the entire GLFW overlay window - actual position is handled by GLFW
     ImGui::SetNextWindowPos(ImVec2(0, 0));
     ImGui::SetNextWindowSize(ImVec2(static_cast<float>(overlay_width), static_cast<float>(overlay_height)));
@@ -115,42 +141,22 @@ void OverlayView::renderContent(System::OverlayWindow& overlay_window) {
         ImGui::SetWindowFontScale(1.0f);
         ImGui::PopFont();
 
-        GLFWwindow* handle = overlay_window.get();
-        if (handle != nullptr) {
+        if (overlay_window.get() != nullptr) {
             if (ImGui::IsWindowHovered() && ImGui::IsMouseClicked(0)) {
                 m_state.overlay_dragging = true;
 
-                int win_x = 0;
-                int win_y = 0;
-                glfwGetWindowPos(handle, &win_x, &win_y);
-
-                double mouse_x = 0.0;
-                double mouse_y = 0.0;
-                glfwGetCursorPos(handle, &mouse_x, &mouse_y);
-
-                mouse_x += win_x;
-                mouse_y += win_y;
-
+                // Where the window was grabbed, relative to its top-left corner
+                const System::WindowGeometry& geometry = overlay_window.geometry();
                 m_state.overlay_drag_offset =
-                    ImVec2(static_cast<float>(mouse_x - win_x), static_cast<float>(mouse_y - win_y));
+                    ImVec2(static_cast<float>(geometry.cursor_x), static_cast<float>(geometry.cursor_y));
             }
 
             if (m_state.overlay_dragging) {
                 if (ImGui::IsMouseDragging(0)) {
-                    int win_x = 0;
-                    int win_y = 0;
-                    glfwGetWindowPos(handle, &win_x, &win_y);
-
-                    double mouse_x = 0.0;
-                    double mouse_y = 0.0;
-                    glfwGetCursorPos(handle, &mouse_x, &mouse_y);
-
-                    mouse_x += win_x;
-                    mouse_y += win_y;
-
+                    const auto [mouse_x, mouse_y] = overlay_window.getCursorScreenPosition();
                     const int new_x = static_cast<int>(mouse_x - m_state.overlay_drag_offset.x);
                     const int new_y = static_cast<int>(mouse_y - m_state.overlay_drag_offset.y);
-                    glfwSetWindowPos(handle, new_x, new_y);
+                    overlay_window.setPosition(new_x, new_y);
                     m_state.overlay_position = ImVec2(static_cast<float>(new_x), static_cast<float>(new_y));
                 } else if (ImGui::IsMouseReleased(0)) {
                     m_state.overlay_dragging = false;
@@ -166,6 +172,24 @@ void OverlayView::renderContent(System::OverlayWindow& overlay_window) {
 
 void OverlayView::renderFrame(System::OverlayWindow& overlay_window) {
     const auto [width, height] = overlay_window.getFramebufferSize();
+    prepareFramebuffer(width, height);
+
+    ImGuiLayer::render();
+    m_cached_frame.capture(ImGui::GetDrawData());
+
+    glDisable(GL_BLEND);
+}
+
+void OverlayView::presentCachedFrame(System::OverlayWindow& overlay_window) {
+    const auto [width, height] = overlay_window.getFramebufferSize();
+    prepareFramebuffer(width, height);
+
+    m_cached_frame.render();
+
+    glDisable(GL_BLEND);
+}
+
+void OverlayView::prepareFramebuffer(int width, int height) {
     glViewport(0, 0, width, height);
 
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
@@ -173,10 +197,6 @@ void OverlayView::renderFrame(System::OverlayWindow& overlay_window) {
 
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    ImGuiLayer::render();
-
-    glDisable(GL_BLEND);
 }
 
 } // namespace WorkBalance::App::UI
@@ -227,6 +227,7 @@ void WaterReminderView::renderTimer() {
 
     if (m_timer.isReminderActive()) {
         // Pulsing effect when reminder is active
+        m_state.ui_animating = true;
         const float pulse = (std::sin(static_cast<float>(ImGui::GetTime()) * 4.0f) + 1.0f) * 0.5f;
         ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f - pulse * 0.3f, 1.0f - pulse * 0.3f, 1.0f));
     }
@@ -358,6 +359,7 @@ void StandupReminderView::renderTimer() {
     ImGui::SetCursorPosX((window_width - time_width) * 0.5f);
 
     if (m_timer.isReminderActive()) {
+        m_state.ui_animating = true;
         const float pulse = (std::sin(static_cast<float>(ImGui::GetTime()) * 4.0f) + 1.0f) * 0.5f;
         ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.8f - pulse * 0.3f, 1.0f - pulse * 0.5f, 1.0f));
     }
@@ -377,6 +379,7 @@ void StandupReminderView::renderBreakMode() {
     const std::string time_str = formatTime(m_timer.getRemainingTime());
 
     // Animated standing icon
+    m_state.ui_animating = true;
     ImGui::Spacing();
     const float bounce = std::abs(std::sin(static_cast<float>(ImGui::GetTime()) * 2.0f)) * 5.0f;
     ImGui::SetCursorPosY(ImGui::GetCursorPosY() - bounce);
@@ -506,6 +509,7 @@ void EyeCareReminderView::renderTimer() {
     ImGui::SetCursorPosX((window_width - time_width) * 0.5f);
 
     if (m_timer.isReminderActive()) {
+        m_state.ui_animating = true;
         const float pulse = (std::sin(static_cast<float>(ImGui::GetTime()) * 4.0f) + 1.0f) * 0.5f;
         ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f + pulse * 0.5f, 1.0f, 0.8f + pulse * 0.2f, 1.0f));
     }
@@ -525,6 +529,7 @@ void EyeCareReminderView::renderBreakMode() {
     const std::string time_str = formatTime(m_timer.getRemainingTime());
 
     // Animated eye icon (blinking effect)
+    m_state.ui_animating = true;
     ImGui::Spacing();
     const float blink_cycle = std::fmod(static_cast<float>(ImGui::GetTime()), 3.0f);
     const bool is_blinking = (blink_cycle > 2.8f);
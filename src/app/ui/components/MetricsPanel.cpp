@@ -0,0 +1,75 @@
+#include "app/ui/components/MetricsPanel.h"
+#include <cstdint>
+#include <format>
+#include <imgui.h>
+#include <string>
+
+namespace WorkBalance::App::UI::Components {
+namespace {
+// Histograms hold nanoseconds; pick a unit that keeps a few significant digits
+[[nodiscard]] std::string formatDuration(std::uint64_t nanoseconds) {
+    if (nanoseconds < 1'000) {
+        return std::format("{} ns", nanoseconds);
+    }
+    if (nanoseconds < 1'000'000) {
+        return std::format("{:.1f} us", static_cast<double>(nanoseconds) / 1e3);
+    }
+    if (nanoseconds < 1'000'000'000) {
+        return std::format("{:.2f} ms", static_cast<double>(nanoseconds) / 1e6);
+    }
+    return std::format("{:.2f} s", static_cast<double>(nanoseconds) / 1e9);
+}
+} // namespace
+
+MetricsPanel::MetricsPanel(const Core::MetricsRegistry& metrics, AppState& state) : m_metrics(metrics), m_state(state) {
+}
+
+void MetricsPanel::render() {
+    if (!m_state.show_metrics_panel) {
+        return;
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(460.0f, 420.0f), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Metrics", &m_state.show_metrics_panel)) {
+        for (const auto& [name, help, counter] : m_metrics.counters()) {
+            ImGui::Text("%s: %llu", name.c_str(), static_cast<unsigned long long>(counter.value()));
+        }
+        for (const auto& [name, help, gauge] : m_metrics.gauges()) {
+            ImGui::Text("%s: %g", name.c_str(), gauge.value());
+        }
+        ImGui::Separator();
+        renderHistograms();
+    }
+    ImGui::End();
+}
+
+void MetricsPanel::renderHistograms() {
+    constexpr int column_count = 5;
+    if (!ImGui::BeginTable("Histograms", column_count, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        return;
+    }
+    ImGui::TableSetupColumn("Histogram");
+    ImGui::TableSetupColumn("Count");
+    ImGui::TableSetupColumn("p50");
+    ImGui::TableSetupColumn("p99");
+    ImGui::TableSetupColumn("Max");
+    ImGui::TableHeadersRow();
+
+    for (const auto& [name, help, histogram] : m_metrics.histograms()) {
+        const auto snapshot = histogram.snapshot();
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name.c_str());
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(snapshot.count));
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(formatDuration(snapshot.quantile(0.5)).c_str());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(formatDuration(snapshot.quantile(0.99)).c_str());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(formatDuration(snapshot.quantile(1.0)).c_str());
+    }
+    ImGui::EndTable();
+}
+
+} // namespace WorkBalance::App::UI::Components
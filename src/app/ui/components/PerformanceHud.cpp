@@ -0,0 +1,122 @@
+#include "app/ui/components/PerformanceHud.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <imgui.h>
+
+#include <core/Configuration.h>
+#include <core/MemoryAccounting.h>
+
+namespace WorkBalance::App::UI::Components {
+namespace {
+[[nodiscard]] const char* actionName(FrameCache::Action action) {
+    switch (action) {
+        case FrameCache::Action::Build:
+            return "building";
+        case FrameCache::Action::Reuse:
+            return "re-presenting";
+        case FrameCache::Action::Skip:
+            return "skipping";
+    }
+    return "unknown";
+}
+
+[[nodiscard]] std::array<char, 32> formatBytes(std::uint64_t bytes) {
+    std::array<char, 32> text{};
+    constexpr double kib = 1024.0;
+    const auto value = static_cast<double>(bytes);
+    if (value < kib) {
+        std::snprintf(text.data(), text.size(), "%llu B", static_cast<unsigned long long>(bytes));
+    } else if (value < kib * kib) {
+        std::snprintf(text.data(), text.size(), "%.1f KiB", value / kib);
+    } else {
+        std::snprintf(text.data(), text.size(), "%.2f MiB", value / (kib * kib));
+    }
+    return text;
+}
+} // namespace
+
+PerformanceHud::PerformanceHud(const FrameProfiler& profiler, AppState& state) : m_profiler(profiler), m_state(state) {
+}
+
+void PerformanceHud::render() {
+    if (!m_state.show_performance_hud || m_profiler.size() == 0) {
+        return;
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(380.0f, 360.0f), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Performance", &m_state.show_performance_hud)) {
+        const FrameProfiler::Sample& latest = m_profiler.latest();
+        const FrameProfiler::Summary summary = m_profiler.summarize();
+
+        // Keep the target frame time around mid-height so spikes stand out
+        constexpr auto target_ms = static_cast<float>(Core::Configuration::FRAME_TIME * 1000.0);
+        const float scale_max = std::max(summary.max_interval_ms, 2.0f * target_ms);
+        std::array<char, 64> overlay{};
+        std::snprintf(overlay.data(), overlay.size(), "avg %.2f ms  max %.2f ms", summary.average_interval_ms,
+                      summary.max_interval_ms);
+        ImGui::PlotLines("##frame_times", m_profiler.intervalHistory().data(), static_cast<int>(m_profiler.size()),
+                         static_cast<int>(m_profiler.historyOffset()), overlay.data(), 0.0f, scale_max,
+                         ImVec2(-1.0f, 80.0f));
+
+        ImGui::Text("Frame %.2f ms: %.2f ms busy, %.2f ms waiting", latest.interval_ms, latest.cpu_ms, latest.idle_ms);
+        ImGui::Text("Governor: %s at up to %.0f fps", actionName(latest.action), Core::Configuration::TARGET_FPS);
+        ImGui::Text("Draw calls: %u, vertices: %u", latest.draw_calls, latest.vertices);
+        ImGui::Text("Heap allocations: %llu this frame", static_cast<unsigned long long>(latest.allocations));
+        ImGui::Separator();
+        renderStages(latest, summary);
+        ImGui::Separator();
+        renderMemory();
+    }
+    ImGui::End();
+}
+
+void PerformanceHud::renderStages(const FrameProfiler::Sample& latest, const FrameProfiler::Summary& summary) {
+    constexpr int column_count = 3;
+    if (!ImGui::BeginTable("Stages", column_count, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        return;
+    }
+    ImGui::TableSetupColumn("Stage");
+    ImGui::TableSetupColumn("Last (ms)");
+    ImGui::TableSetupColumn("Average (ms)");
+    ImGui::TableHeadersRow();
+
+    for (std::size_t i = 0; i < FrameProfiler::STAGE_COUNT; ++i) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(FrameProfiler::STAGE_NAMES[i]);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", latest.stage_ms[i]);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", summary.average_stage_ms[i]);
+    }
+    ImGui::EndTable();
+}
+
+void PerformanceHud::renderMemory() {
+    constexpr int column_count = 3;
+    if (!ImGui::BeginTable("Memory", column_count, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        return;
+    }
+    ImGui::TableSetupColumn("Memory");
+    ImGui::TableSetupColumn("Current");
+    ImGui::TableSetupColumn("Peak");
+    ImGui::TableHeadersRow();
+
+    for (std::size_t i = 0; i < Core::MEMORY_TAG_COUNT; ++i) {
+        const auto tag = static_cast<Core::MemoryTag>(i);
+        const Core::MemoryAccount& account = Core::MemoryAccounting::account(tag);
+        const std::string_view name = Core::getMemoryTagName(tag);
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%.*s", static_cast<int>(name.size()), name.data());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(formatBytes(account.current()).data());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(formatBytes(account.peak()).data());
+    }
+    ImGui::EndTable();
+}
+
+} // namespace WorkBalance::App::UI::Components
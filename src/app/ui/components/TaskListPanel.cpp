@@ -3,6 +3,7 @@
 #include <cstring>
 #include <imgui.h>
 #include <string>
+#include <vector>
 
 #include "assets/fonts/IconsFontAwesome5Pro.h"
 
@@ -24,10 +25,15 @@ void TaskListPanel::render() {
     constexpr float add_task_height = 60.0f;
     constexpr float padding = 40.0f;
     constexpr float extra_bottom_spacing = 30.0f;
+    constexpr float archive_header_height = 40.0f;
+    constexpr float archive_row_height = 28.0f;
 
+    const float archive_height =
+        archive_header_height +
+        (m_archive_open ? archive_row_height * static_cast<float>(m_archive_results.size() + 1) : 0.0f);
     const float total_height = padding + header_height +
                                (static_cast<float>(task_count) * (task_item_height + task_spacing)) + add_task_height +
-                               extra_bottom_spacing;
+                               archive_height + extra_bottom_spacing;
     const float panel_height = std::max(400.0f, total_height);
 
     ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4(1.0f, 1.0f, 1.0f, 0.05f));
@@ -47,6 +53,7 @@ void TaskListPanel::render() {
 
         ImGui::Spacing();
         renderAddTaskButton();
+        renderArchiveSection();
     }
 
     ImGui::EndChild();
@@ -157,10 +164,12 @@ void TaskListPanel::renderTaskItem(size_t index, const Core::Task& task) {
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, task.completed ? 0.6f : 0.9f));
 
     const ImVec2 text_pos = ImGui::GetCursorScreenPos();
-    ImGui::Text("%s", task.name.c_str());
+    const char* const name_begin = task.name.data();
+    const char* const name_end = name_begin + task.name.size();
+    ImGui::TextUnformatted(name_begin, name_end);
 
     if (task.completed) {
-        const ImVec2 text_size = ImGui::CalcTextSize(task.name.c_str());
+        const ImVec2 text_size = ImGui::CalcTextSize(name_begin, name_end);
         ImDrawList* text_draw_list = ImGui::GetWindowDrawList();
         const ImU32 strikethrough_color = ImGui::ColorConvertFloat4ToU32(ImVec4(1.0f, 1.0f, 1.0f, 0.8f));
         const float line_y = text_pos.y + (text_size.y * 0.5f);
@@ -199,7 +208,7 @@ void TaskListPanel::renderTaskItem(size_t index, const Core::Task& task) {
     // Drag source - only from the drag handle
     if (ImGui::BeginDragDropSource(ImGuiDragDropFlags_None)) {
         ImGui::SetDragDropPayload("TASK_REORDER", &index, sizeof(size_t));
-        ImGui::Text("Reorder: %s", task.name.c_str());
+        ImGui::Text("Reorder: %.*s", static_cast<int>(task.name.size()), task.name.data());
         ImGui::EndDragDropSource();
     }
 
@@ -217,7 +226,9 @@ void TaskListPanel::renderTaskItem(size_t index, const Core::Task& task) {
     if (ImGui::Button(ICON_FA_PEN, ImVec2(20.0f, 20.0f))) {
         m_state.show_edit_task = true;
         m_state.edit_task_index = static_cast<int>(index);
-        strncpy_s(m_state.edit_task_name.data(), m_state.edit_task_name.size(), task.name.c_str(), _TRUNCATE);
+        const size_t name_length = std::min(task.name.size(), m_state.edit_task_name.size() - 1);
+        std::memcpy(m_state.edit_task_name.data(), task.name.data(), name_length);
+        m_state.edit_task_name[name_length] = '\0';
         m_state.edit_task_estimated_pomodoros = task.estimated_pomodoros;
         m_state.edit_task_completed_pomodoros = task.completed_pomodoros;
     }
@@ -432,4 +443,53 @@ void TaskListPanel::renderAddTaskPopup() {
     ImGui::PopStyleVar(2);
 }
 
+void TaskListPanel::renderArchiveSection() {
+    if (!m_callbacks.onArchiveSearch) {
+        return;
+    }
+
+    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 1.0f, 0.6f));
+    m_archive_open = ImGui::CollapsingHeader(ICON_FA_ARCHIVE "  Archived Tasks");
+    ImGui::PopStyleColor();
+    if (!m_archive_open) {
+        // Pick up tasks archived since the section was last shown
+        m_archive_results_stale = true;
+        return;
+    }
+
+    ImGui::SetNextItemWidth(-1.0f);
+    if (ImGui::InputTextWithHint("##ArchiveSearch", ICON_FA_SEARCH "  Search archived tasks", m_archive_query,
+                                 sizeof(m_archive_query))) {
+        m_archive_results_stale = true;
+    }
+
+    if (m_archive_results_stale) {
+        m_archive_results = m_callbacks.onArchiveSearch(m_archive_query);
+        m_archive_results_stale = false;
+    }
+
+    if (m_archive_results.empty()) {
+        ImGui::TextDisabled("No archived tasks");
+        return;
+    }
+
+    const float restore_width = ImGui::CalcTextSize(ICON_FA_UNDO " Restore").x + 16.0f;
+    for (const auto& task : m_archive_results) {
+        ImGui::PushID(&task);
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text("%s  (%d/%d)", task.name.c_str(), task.completed_pomodoros, task.estimated_pomodoros);
+        ImGui::SameLine(ImGui::GetContentRegionMax().x - restore_width);
+        const bool restore = ImGui::SmallButton(ICON_FA_UNDO " Restore");
+        ImGui::PopID();
+
+        if (restore) {
+            if (m_callbacks.onArchivedTaskRestored) {
+                m_callbacks.onArchivedTaskRestored(task.id);
+            }
+            m_archive_results_stale = true;
+            break;
+        }
+    }
+}
+
 } // namespace WorkBalance::App::UI::Components
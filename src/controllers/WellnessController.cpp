@@ -36,15 +36,15 @@ void WellnessController::handleTimerComplete(Core::WellnessType type) {
         case Core::WellnessType::Standup:
             // Standup reminder - play special walk sound
             playWalkSound();
-            // If break completed, restart interval timer
-            if (m_standup_timer && !m_standup_timer->isInBreak()) {
+            // If break completed, restart interval timer; a finished interval waits for the user
+            if (m_standup_timer && !m_standup_timer->isReminderActive()) {
                 m_standup_timer->start();
             }
             break;
         case Core::WellnessType::EyeStrain:
             playBellSound();
-            // If break completed, restart interval timer
-            if (m_eye_care_timer && !m_eye_care_timer->isInBreak()) {
+            // If break completed, restart interval timer; a finished interval waits for the user
+            if (m_eye_care_timer && !m_eye_care_timer->isReminderActive()) {
                 m_eye_care_timer->start();
             }
             break;
@@ -0,0 +1,45 @@
+#include <core/DisplayLayout.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace WorkBalance::Core {
+
+float DisplayLayout::quantizeScale(float scale) noexcept {
+    if (!std::isfinite(scale) || scale <= 0.0f) {
+        return 1.0f;
+    }
+    const float steps = std::round(scale / UI_SCALE_STEP);
+    return std::clamp(steps * UI_SCALE_STEP, MIN_UI_SCALE, MAX_UI_SCALE);
+}
+
+float DisplayLayout::uiScale(float content_scale, int window_width, int framebuffer_width) noexcept {
+    if (window_width <= 0 || framebuffer_width <= 0) {
+        return quantizeScale(content_scale);
+    }
+    // Pixels the platform already puts behind each screen coordinate
+    const float pixel_ratio = static_cast<float>(framebuffer_width) / static_cast<float>(window_width);
+    return quantizeScale(content_scale / pixel_ratio);
+}
+
+int DisplayLayout::scaleLength(int logical, float scale) noexcept {
+    return static_cast<int>(std::lround(static_cast<float>(logical) * scale));
+}
+
+ScreenRect DisplayLayout::centeredIn(const ScreenRect& area, int width, int height) noexcept {
+    return {area.x + ((area.width - width) / 2), area.y + ((area.height - height) / 2), width, height};
+}
+
+ScreenRect DisplayLayout::topCenteredIn(const ScreenRect& area, int width, int height, int top) noexcept {
+    return {area.x + ((area.width - width) / 2), area.y + top, width, height};
+}
+
+int DisplayLayout::normalWindowHeight(const ScreenRect& work_area, float scale, int fallback) noexcept {
+    if (work_area.empty()) {
+        return fallback;
+    }
+    const int margins = 2 * scaleLength(WORK_AREA_MARGIN, scale);
+    return std::max(work_area.height - margins, work_area.height / 2);
+}
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,136 @@
+#include <core/IconSet.h>
+
+#include <core/ByteStream.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+namespace WorkBalance::Core {
+
+namespace {
+// Layout: header, then per image (smallest first) its size and width * height * 4 RGBA bytes
+constexpr std::uint32_t ICON_MAGIC = 0x43494257; // "WBIC"
+constexpr int CHANNELS = 4;
+
+struct IconHeader {
+    std::uint32_t magic = ICON_MAGIC;
+    std::uint32_t image_count = 0;
+};
+
+struct ImageHeader {
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<IconHeader>);
+static_assert(std::is_trivially_copyable_v<ImageHeader>);
+
+size_t pixelIndex(int x, int y, int width) {
+    return (static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)) * CHANNELS;
+}
+
+// Box filter: each target pixel averages the source pixels whose centres fall inside it.
+// Colours are weighted by alpha so transparent pixels don't bleed dark fringes.
+std::vector<std::uint8_t> downscale(std::span<const std::uint8_t> rgba, int width, int height, int target) {
+    std::vector<std::uint8_t> output(pixelIndex(0, target, target));
+    const double scale_x = static_cast<double>(width) / target;
+    const double scale_y = static_cast<double>(height) / target;
+
+    for (int ty = 0; ty < target; ++ty) {
+        const int y0 = static_cast<int>(std::ceil(ty * scale_y - 0.5));
+        const int y1 = std::max(y0 + 1, static_cast<int>(std::ceil((ty + 1) * scale_y - 0.5)));
+        for (int tx = 0; tx < target; ++tx) {
+            const int x0 = static_cast<int>(std::ceil(tx * scale_x - 0.5));
+            const int x1 = std::max(x0 + 1, static_cast<int>(std::ceil((tx + 1) * scale_x - 0.5)));
+
+            std::array<double, CHANNELS> sum{};
+            int count = 0;
+            for (int y = std::max(y0, 0); y < std::min(y1, height); ++y) {
+                for (int x = std::max(x0, 0); x < std::min(x1, width); ++x) {
+                    const size_t index = pixelIndex(x, y, width);
+                    const double alpha = rgba[index + 3];
+                    for (size_t channel = 0; channel < 3; ++channel) {
+                        sum[channel] += rgba[index + channel] * alpha;
+                    }
+                    sum[3] += alpha;
+                    ++count;
+                }
+            }
+
+            const size_t out = pixelIndex(tx, ty, target);
+            for (size_t channel = 0; channel < 3 && sum[3] > 0.0; ++channel) {
+                output[out + channel] = static_cast<std::uint8_t>(std::lround(sum[channel] / sum[3]));
+            }
+            output[out + 3] = static_cast<std::uint8_t>(std::lround(sum[3] / std::max(count, 1)));
+        }
+    }
+    return output;
+}
+} // namespace
+
+std::vector<std::uint8_t> IconSet::build(std::span<const std::uint8_t> rgba, int width, int height,
+                                         std::span<const int> sizes) {
+    if (width <= 0 || height <= 0 || rgba.size() != pixelIndex(0, height, width)) {
+        return {};
+    }
+
+    std::vector<int> targets;
+    for (const int size : sizes) {
+        if (size > 0 && size < width && size < height) {
+            targets.push_back(size);
+        }
+    }
+    std::ranges::sort(targets);
+    const auto [first, last] = std::ranges::unique(targets);
+    targets.erase(first, last);
+
+    ByteWriter writer;
+    writer.write(IconHeader{ICON_MAGIC, static_cast<std::uint32_t>(targets.size() + 1)});
+    for (const int target : targets) {
+        const auto pixels = downscale(rgba, width, height, target);
+        writer.write(ImageHeader{static_cast<std::uint32_t>(target), static_cast<std::uint32_t>(target)});
+        writer.writeSpan(std::span{pixels});
+    }
+    writer.write(ImageHeader{static_cast<std::uint32_t>(width), static_cast<std::uint32_t>(height)});
+    writer.writeSpan(rgba);
+
+    const std::string& bytes = writer.bytes();
+    return {bytes.begin(), bytes.end()};
+}
+
+IconSet::IconSet(std::span<const std::uint8_t> data) {
+    ByteReader reader({reinterpret_cast<const char*>(data.data()), data.size()});
+    IconHeader header;
+    if (!reader.read(header) || header.magic != ICON_MAGIC) {
+        return;
+    }
+
+    for (std::uint32_t i = 0; i < header.image_count; ++i) {
+        ImageHeader image;
+        if (!reader.read(image) || image.width == 0 || image.height == 0) {
+            m_images.clear();
+            return;
+        }
+
+        const size_t offset = data.size() - reader.remaining();
+        const size_t size = static_cast<size_t>(image.width) * image.height * CHANNELS;
+        if (!reader.skip(size)) {
+            m_images.clear();
+            return;
+        }
+        m_images.push_back(IconImage{static_cast<int>(image.width), static_cast<int>(image.height),
+                                     data.subspan(offset, size)});
+    }
+}
+
+const IconImage* IconSet::select(int size) const noexcept {
+    if (m_images.empty()) {
+        return nullptr;
+    }
+    const auto it = std::ranges::find_if(m_images, [size](const IconImage& image) { return image.width >= size; });
+    return it != m_images.end() ? &*it : &m_images.back();
+}
+
+} // namespace WorkBalance::Core
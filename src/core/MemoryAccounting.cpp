@@ -0,0 +1,121 @@
+#include <core/MemoryAccounting.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace WorkBalance::Core {
+namespace {
+// Keeps the block after it aligned like malloc's own result
+constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+static_assert(HEADER_SIZE >= sizeof(std::size_t));
+
+struct TaggedMemory {
+    MemoryAccount account;
+    TaggedMemoryResource resource{account};
+};
+
+std::array<TaggedMemory, MEMORY_TAG_COUNT>& taggedMemory() noexcept {
+    // Never destroyed: C libraries and other statics may still free into it during shutdown
+    static auto* const tagged = new std::array<TaggedMemory, MEMORY_TAG_COUNT>();
+    return *tagged;
+}
+
+[[nodiscard]] std::byte* headerOf(void* pointer) noexcept {
+    return static_cast<std::byte*>(pointer) - HEADER_SIZE;
+}
+
+[[nodiscard]] std::size_t storedSize(const std::byte* header) noexcept {
+    std::size_t size = 0;
+    std::memcpy(&size, header, sizeof(size));
+    return size;
+}
+
+[[nodiscard]] void* finishAllocation(std::byte* header, std::size_t size) noexcept {
+    std::memcpy(header, &size, sizeof(size));
+    return header + HEADER_SIZE;
+}
+} // namespace
+
+std::string_view getMemoryTagName(MemoryTag tag) noexcept {
+    switch (tag) {
+        case MemoryTag::Tasks:
+            return "tasks";
+        case MemoryTag::Persistence:
+            return "persistence";
+        case MemoryTag::UiStrings:
+            return "ui_strings";
+        case MemoryTag::Audio:
+            return "audio";
+        case MemoryTag::ImGui:
+            return "imgui";
+    }
+    return "unknown";
+}
+
+void MemoryAccount::add(std::size_t bytes) noexcept {
+    const std::uint64_t current = m_current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::uint64_t peak = m_peak.load(std::memory_order_relaxed);
+    while (current > peak && !m_peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+        // peak now holds the latest value; retry while ours is still higher
+    }
+}
+
+void MemoryAccount::remove(std::size_t bytes) noexcept {
+    m_current.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void* TaggedMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    void* pointer = m_upstream->allocate(bytes, alignment);
+    m_account.add(bytes);
+    return pointer;
+}
+
+void TaggedMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+    m_upstream->deallocate(pointer, bytes, alignment);
+    m_account.remove(bytes);
+}
+
+MemoryAccount& MemoryAccounting::account(MemoryTag tag) noexcept {
+    return taggedMemory()[static_cast<std::size_t>(tag)].account;
+}
+
+std::pmr::memory_resource* MemoryAccounting::resource(MemoryTag tag) noexcept {
+    return &taggedMemory()[static_cast<std::size_t>(tag)].resource;
+}
+
+void* MemoryAccounting::allocate(MemoryTag tag, std::size_t size) noexcept {
+    auto* header = static_cast<std::byte*>(std::malloc(HEADER_SIZE + size));
+    if (header == nullptr) {
+        return nullptr;
+    }
+    account(tag).add(size);
+    return finishAllocation(header, size);
+}
+
+void* MemoryAccounting::reallocate(MemoryTag tag, void* pointer, std::size_t size) noexcept {
+    if (pointer == nullptr) {
+        return allocate(tag, size);
+    }
+
+    std::byte* old_header = headerOf(pointer);
+    const std::size_t old_size = storedSize(old_header);
+    auto* header = static_cast<std::byte*>(std::realloc(old_header, HEADER_SIZE + size));
+    if (header == nullptr) {
+        // The old block is untouched and still accounted
+        return nullptr;
+    }
+    account(tag).remove(old_size);
+    account(tag).add(size);
+    return finishAllocation(header, size);
+}
+
+void MemoryAccounting::deallocate(MemoryTag tag, void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    std::byte* header = headerOf(pointer);
+    account(tag).remove(storedSize(header));
+    std::free(header);
+}
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,102 @@
+#include <core/Metrics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+namespace WorkBalance::Core {
+namespace {
+constexpr double NANOSECONDS_PER_SECOND = 1e9;
+
+template <typename Metric>
+Metric& findOrAdd(std::deque<MetricsRegistry::Named<Metric>>& metrics, std::string_view name, std::string_view help) {
+    const auto existing =
+        std::ranges::find_if(metrics, [name](const MetricsRegistry::Named<Metric>& entry) { return entry.name == name; });
+    if (existing != metrics.end()) {
+        return existing->metric;
+    }
+    return metrics.emplace_back(std::string(name), std::string(help)).metric;
+}
+
+void appendHeader(std::string& text, std::string_view name, std::string_view help, std::string_view type) {
+    text += std::format("# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+}
+
+[[nodiscard]] double toSeconds(std::uint64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / NANOSECONDS_PER_SECOND;
+}
+} // namespace
+
+std::uint64_t Histogram::Snapshot::quantile(double q) const noexcept {
+    if (count == 0) {
+        return 0;
+    }
+    // Rank of the sample that sits at q, counting from 1
+    const auto rank = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count))));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return bucketUpperBound(i);
+        }
+    }
+    return bucketUpperBound(BUCKET_COUNT - 1);
+}
+
+Histogram::Snapshot Histogram::snapshot() const noexcept {
+    Snapshot result;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        result.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        result.count += result.buckets[i];
+    }
+    result.sum = m_sum.load(std::memory_order_relaxed);
+    return result;
+}
+
+Counter& MetricsRegistry::counter(std::string_view name, std::string_view help) {
+    return findOrAdd(m_counters, name, help);
+}
+
+Gauge& MetricsRegistry::gauge(std::string_view name, std::string_view help) {
+    return findOrAdd(m_gauges, name, help);
+}
+
+Histogram& MetricsRegistry::histogram(std::string_view name, std::string_view help) {
+    return findOrAdd(m_histograms, name, help);
+}
+
+std::string MetricsRegistry::toPrometheusText() const {
+    std::string text;
+    for (const auto& [name, help, counter] : m_counters) {
+        appendHeader(text, name, help, "counter");
+        text += std::format("{} {}\n", name, counter.value());
+    }
+    for (const auto& [name, help, gauge] : m_gauges) {
+        appendHeader(text, name, help, "gauge");
+        text += std::format("{} {}\n", name, gauge.value());
+    }
+    for (const auto& [name, help, histogram] : m_histograms) {
+        appendHeader(text, name, help, "histogram");
+        const Histogram::Snapshot snapshot = histogram.snapshot();
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < Histogram::BUCKET_COUNT; ++i) {
+            if (snapshot.buckets[i] == 0) {
+                continue;
+            }
+            cumulative += snapshot.buckets[i];
+            text += std::format("{}_bucket{{le=\"{}\"}} {}\n", name, toSeconds(Histogram::bucketUpperBound(i)),
+                                cumulative);
+        }
+        text += std::format("{}_bucket{{le=\"+Inf\"}} {}\n", name, snapshot.count);
+        text += std::format("{}_sum {}\n{}_count {}\n", name, toSeconds(snapshot.sum), name, snapshot.count);
+    }
+    return text;
+}
+
+std::expected<void, PersistenceError> MetricsRegistry::writePrometheusFile(const std::filesystem::path& path) const {
+    // Scrapers may read at any moment, so never let them see a half-written file
+    return writeFileAtomically(path, toPrometheusText());
+}
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,137 @@
+#include <core/Observable.h>
+
+#include <algorithm>
+
+namespace WorkBalance::Core {
+
+namespace {
+struct TransactionState {
+    int depth = 0;
+    std::vector<ObservableNode*> pending;
+};
+
+thread_local TransactionState t_transaction;
+
+// The ComputedObservable whose compute function is running on this thread
+thread_local const ComputedNode* t_evaluating = nullptr;
+
+template <typename Node>
+void eraseUnordered(std::vector<Node*>& nodes, const void* node) noexcept {
+    const auto it = std::ranges::find(nodes, node);
+    if (it != nodes.end()) {
+        *it = nodes.back();
+        nodes.pop_back();
+    }
+}
+} // namespace
+
+ObservableTransaction::ObservableTransaction() noexcept {
+    ++t_transaction.depth;
+}
+
+ObservableTransaction::~ObservableTransaction() {
+    TransactionState& state = t_transaction;
+    if (state.depth == 1) {
+        // Still open while flushing, so changes made by observers join this commit
+        for (std::size_t i = 0; i < state.pending.size(); ++i) {
+            if (ObservableNode* node = std::exchange(state.pending[i], nullptr)) {
+                node->m_scheduled = false;
+                node->flushNotification();
+            }
+        }
+        state.pending.clear();
+    }
+    --state.depth;
+}
+
+bool ObservableTransaction::isActive() noexcept {
+    return t_transaction.depth > 0;
+}
+
+ObservableNode::~ObservableNode() {
+    for (ComputedNode* dependent : m_dependents) {
+        eraseUnordered(dependent->m_sources, this);
+        dependent->m_tracked_count = std::min(dependent->m_tracked_count, dependent->m_sources.size());
+        dependent->m_stale = true;
+    }
+    if (m_scheduled) {
+        std::ranges::replace(t_transaction.pending, this, nullptr);
+    }
+}
+
+void ObservableNode::recordRead() const {
+    if (t_evaluating != nullptr) {
+        t_evaluating->addSource(this);
+    }
+}
+
+void ObservableNode::invalidateDependents() const {
+    // Indexing, not iterators: a dependent's observers may subscribe new computeds to this node
+    for (std::size_t i = 0; i < m_dependents.size(); ++i) {
+        m_dependents[i]->invalidate();
+    }
+}
+
+void ObservableNode::scheduleNotification() {
+    if (!m_scheduled) {
+        m_scheduled = true;
+        t_transaction.pending.push_back(this);
+    }
+}
+
+ComputedNode::~ComputedNode() {
+    for (const ObservableNode* source : m_sources) {
+        eraseUnordered(source->m_dependents, this);
+    }
+}
+
+void ComputedNode::track(const std::function<void()>& evaluate) const {
+    const ComputedNode* const outer = std::exchange(t_evaluating, this);
+    m_tracked_count = 0;
+    try {
+        evaluate();
+    } catch (...) {
+        t_evaluating = outer;
+        throw;
+    }
+    t_evaluating = outer;
+
+    // Inputs the last evaluation read but this one did not
+    for (std::size_t i = m_tracked_count; i < m_sources.size(); ++i) {
+        eraseUnordered(m_sources[i]->m_dependents, this);
+    }
+    m_sources.resize(m_tracked_count);
+    m_stale = false;
+}
+
+void ComputedNode::addSource(const ObservableNode* source) const {
+    // Evaluations usually read the same inputs in the same order, which makes this O(1)
+    if (m_tracked_count < m_sources.size() && m_sources[m_tracked_count] == source) {
+        ++m_tracked_count;
+        return;
+    }
+    const auto confirmed = m_sources.begin() + static_cast<std::ptrdiff_t>(m_tracked_count);
+    if (std::find(m_sources.begin(), confirmed, source) != confirmed) {
+        return; // Read twice in one evaluation
+    }
+    const auto it = std::find(confirmed, m_sources.end(), source);
+    if (it != m_sources.end()) {
+        std::iter_swap(confirmed, it);
+    } else {
+        source->m_dependents.push_back(const_cast<ComputedNode*>(this));
+        m_sources.push_back(source);
+        std::iter_swap(m_sources.begin() + static_cast<std::ptrdiff_t>(m_tracked_count), m_sources.end() - 1);
+    }
+    ++m_tracked_count;
+}
+
+void ComputedNode::invalidate() {
+    if (m_stale) {
+        return;
+    }
+    m_stale = true;
+    onInvalidated();
+    invalidateDependents();
+}
+
+} // namespace WorkBalance::Core
@@ -3,11 +3,14 @@
 #include <core/Configuration.h>
 
 #include <algorithm>
+#include <charconv>
+#include <cstdint>
 #include <cstdlib>
 #include <format>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <iterator>
+#include <memory_resource>
 
 #ifdef _WIN32
 #include <ShlObj.h>
@@ -21,34 +24,6 @@ constexpr std::string_view CONFIG_FILENAME = "workbalance_config.json";
 constexpr std::string_view APP_FOLDER_NAME = "WorkBalance";
 
 // Simple JSON helper functions (avoiding external dependency)
-std::string escapeJsonString(const std::string& input) {
-    std::string output;
-    output.reserve(input.size() + 10);
-    for (char ch : input) {
-        switch (ch) {
-            case '"':
-                output += "\\\"";
-                break;
-            case '\\':
-                output += "\\\\";
-                break;
-            case '\n':
-                output += "\\n";
-                break;
-            case '\r':
-                output += "\\r";
-                break;
-            case '\t':
-                output += "\\t";
-                break;
-            default:
-                output += ch;
-                break;
-        }
-    }
-    return output;
-}
-
 std::string unescapeJsonString(const std::string& input) {
     std::string output;
     output.reserve(input.size());
@@ -75,6 +50,19 @@ std::string unescapeJsonString(const std::string& input) {
                     output += '\t';
                     ++i;
                     break;
+                case 'u': {
+                    // escapeJson writes the remaining control characters as \u00XX
+                    unsigned code = 0;
+                    const char* digits = input.data() + i + 2;
+                    if (i + 5 < input.size() && std::from_chars(digits, digits + 4, code, 16).ptr == digits + 4 &&
+                        code < 0x80) {
+                        output += static_cast<char>(code);
+                        i += 5;
+                    } else {
+                        output += input[i];
+                    }
+                    break;
+                }
                 default:
                     output += input[i];
                     break;
@@ -95,8 +83,8 @@ std::string trim(const std::string& str) {
     return str.substr(start, end - start + 1);
 }
 
-std::string extractJsonValue(const std::string& json, const std::string& key) {
-    const std::string search_key = "\"" + key + "\"";
+std::string extractJsonValue(std::string_view json, std::string_view key) {
+    const std::string search_key = std::format("\"{}\"", key);
     auto pos = json.find(search_key);
     if (pos == std::string::npos) {
         return "";
@@ -121,7 +109,7 @@ std::string extractJsonValue(const std::string& json, const std::string& key) {
             }
             ++end_pos;
         }
-        return unescapeJsonString(json.substr(pos + 1, end_pos - pos - 1));
+        return unescapeJsonString(std::string(json.substr(pos + 1, end_pos - pos - 1)));
     }
     if (json[pos] == '{') {
         // Object value - find matching brace
@@ -135,7 +123,7 @@ std::string extractJsonValue(const std::string& json, const std::string& key) {
             }
             ++end_pos;
         }
-        return json.substr(pos, end_pos - pos);
+        return std::string(json.substr(pos, end_pos - pos));
     }
     if (json[pos] == '[') {
         // Array value - find matching bracket
@@ -149,17 +137,17 @@ std::string extractJsonValue(const std::string& json, const std::string& key) {
             }
             ++end_pos;
         }
-        return json.substr(pos, end_pos - pos);
+        return std::string(json.substr(pos, end_pos - pos));
     }
     // Numeric or boolean value
     auto end_pos = json.find_first_of(",}\n\r", pos);
     if (end_pos == std::string::npos) {
         end_pos = json.size();
     }
-    return trim(json.substr(pos, end_pos - pos));
+    return trim(std::string(json.substr(pos, end_pos - pos)));
 }
 
-int extractJsonInt(const std::string& json, const std::string& key, int default_value) {
+int extractJsonInt(std::string_view json, std::string_view key, int default_value) {
     const std::string value = extractJsonValue(json, key);
     if (value.empty()) {
         return default_value;
@@ -171,7 +159,19 @@ int extractJsonInt(const std::string& json, const std::string& key, int default_
     }
 }
 
-float extractJsonFloat(const std::string& json, const std::string& key, float default_value) {
+std::int64_t extractJsonInt64(std::string_view json, std::string_view key, std::int64_t default_value) {
+    const std::string value = extractJsonValue(json, key);
+    if (value.empty()) {
+        return default_value;
+    }
+    try {
+        return std::stoll(value);
+    } catch (...) {
+        return default_value;
+    }
+}
+
+float extractJsonFloat(std::string_view json, std::string_view key, float default_value) {
     const std::string value = extractJsonValue(json, key);
     if (value.empty()) {
         return default_value;
@@ -183,7 +183,7 @@ float extractJsonFloat(const std::string& json, const std::string& key, float de
     }
 }
 
-bool extractJsonBool(const std::string& json, const std::string& key, bool default_value) {
+bool extractJsonBool(std::string_view json, std::string_view key, bool default_value) {
     const std::string value = extractJsonValue(json, key);
     if (value.empty()) {
         return default_value;
@@ -219,6 +219,85 @@ std::vector<std::string> splitJsonArray(const std::string& array_json) {
 }
 } // namespace
 
+std::string escapeJson(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char ch : text) {
+        switch (ch) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\r':
+                escaped += "\\r";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(ch) < 0x20) {
+                    escaped += std::format("\\u{:04x}", static_cast<unsigned>(ch));
+                } else {
+                    escaped += ch;
+                }
+                break;
+        }
+    }
+    return escaped;
+}
+
+std::expected<void, PersistenceError> writeFileAtomically(const std::filesystem::path& path,
+                                                          std::string_view contents) {
+    try {
+        const auto directory = path.parent_path();
+        if (!directory.empty() && !std::filesystem::exists(directory)) {
+            if (!std::filesystem::create_directories(directory)) {
+                return std::unexpected(PersistenceError::DirectoryCreateError);
+            }
+        }
+
+        auto temp_path = path;
+        temp_path += ".tmp";
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                return std::unexpected(PersistenceError::FileOpenError);
+            }
+            file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+            if (!file.good()) {
+                return std::unexpected(PersistenceError::WriteError);
+            }
+        }
+
+        std::filesystem::rename(temp_path, path);
+        return {};
+    } catch (const std::exception& e) {
+        std::cerr << "Error writing " << path << ": " << e.what() << '\n';
+        return std::unexpected(PersistenceError::WriteError);
+    }
+}
+
+PersistentData::PersistentData(const PersistentData& other)
+    : settings(other.settings), tasks(other.tasks), current_task_index(other.current_task_index) {
+    // Copies get their own arena so they never dangle into the source's storage
+    for (Task& task : tasks) {
+        task.name = task_names.intern(task.name);
+    }
+}
+
+PersistentData& PersistentData::operator=(const PersistentData& other) {
+    if (this != &other) {
+        PersistentData copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
 PersistenceManager::PersistenceManager() : PersistenceManager(getDefaultConfigDirectory()) {
 }
 
@@ -296,9 +375,9 @@ std::expected<PersistentData, PersistenceError> PersistenceManager::load() const
             return std::unexpected(PersistenceError::FileOpenError);
         }
 
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        const std::string json = buffer.str();
+        // The read buffer is the largest allocation a load makes; account it to persistence
+        std::pmr::string json{MemoryAccounting::resource(MemoryTag::Persistence)};
+        json.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
 
         auto result = deserializeFromJson(json);
         if (!result) {
@@ -325,11 +404,12 @@ std::string PersistenceManager::serializeToJson(const PersistentData& data) {
       "name": "{}",
       "completed": {},
       "estimated_pomodoros": {},
-      "completed_pomodoros": {}
+      "completed_pomodoros": {},
+      "completed_at": {}
     }}{}
 )",
-            escapeJsonString(task.name), task.completed ? "true" : "false", task.estimated_pomodoros,
-            task.completed_pomodoros, (i < data.tasks.size() - 1) ? "," : "");
+            escapeJson(task.name), task.completed ? "true" : "false", task.estimated_pomodoros,
+            task.completed_pomodoros, task.completed_at, (i < data.tasks.size() - 1) ? "," : "");
     }
 
     return std::format(
@@ -361,6 +441,7 @@ std::string PersistenceManager::serializeToJson(const PersistentData& data) {
     "eye_care_auto_loop": {},
     "start_with_windows": {},
     "start_minimized": {},
+    "archive_after_days": {},
     "pomodoro_sound_enabled": {},
     "pomodoro_sound_volume": {},
     "water_sound_enabled": {},
@@ -392,7 +473,8 @@ std::string PersistenceManager::serializeToJson(const PersistentData& data) {
         data.settings.eye_care_interval_minutes, data.settings.eye_care_break_seconds,
         data.settings.water_auto_loop ? "true" : "false", data.settings.standup_auto_loop ? "true" : "false",
         data.settings.eye_care_auto_loop ? "true" : "false", data.settings.start_with_windows ? "true" : "false",
-        data.settings.start_minimized ? "true" : "false", data.settings.pomodoro_sound_enabled ? "true" : "false",
+        data.settings.start_minimized ? "true" : "false", data.settings.archive_after_days,
+        data.settings.pomodoro_sound_enabled ? "true" : "false",
         data.settings.pomodoro_sound_volume, data.settings.water_sound_enabled ? "true" : "false",
         data.settings.water_sound_volume, data.settings.standup_sound_enabled ? "true" : "false",
         data.settings.standup_sound_volume, data.settings.eye_care_sound_enabled ? "true" : "false",
@@ -402,7 +484,7 @@ std::string PersistenceManager::serializeToJson(const PersistentData& data) {
         data.settings.eye_care_notification_enabled ? "true" : "false", data.current_task_index, tasks_json);
 }
 
-std::optional<PersistentData> PersistenceManager::deserializeFromJson(const std::string& json) {
+std::optional<PersistentData> PersistenceManager::deserializeFromJson(std::string_view json) {
     PersistentData data;
 
     // Extract settings section
@@ -446,6 +528,9 @@ std::optional<PersistentData> PersistenceManager::deserializeFromJson(const std:
         // Startup settings
         data.settings.start_with_windows = extractJsonBool(settings_json, "start_with_windows", false);
         data.settings.start_minimized = extractJsonBool(settings_json, "start_minimized", true);
+        // Task archive settings
+        data.settings.archive_after_days =
+            extractJsonInt(settings_json, "archive_after_days", Configuration::DEFAULT_ARCHIVE_AFTER_DAYS);
         // Sound settings
         data.settings.pomodoro_sound_enabled =
             extractJsonBool(settings_json, "pomodoro_sound_enabled", Configuration::DEFAULT_SOUND_ENABLED);
@@ -483,12 +568,13 @@ std::optional<PersistentData> PersistenceManager::deserializeFromJson(const std:
         const auto task_items = splitJsonArray(tasks_json);
         for (const auto& task_json : task_items) {
             Task task;
-            task.name = extractJsonValue(task_json, "name");
+            task.name = data.task_names.intern(extractJsonValue(task_json, "name"));
             task.completed = extractJsonBool(task_json, "completed", false);
             task.estimated_pomodoros =
                 extractJsonInt(task_json, "estimated_pomodoros", Configuration::DEFAULT_ESTIMATED_POMODOROS);
             task.completed_pomodoros =
                 extractJsonInt(task_json, "completed_pomodoros", Configuration::DEFAULT_COMPLETED_POMODOROS);
+            task.completed_at = extractJsonInt64(task_json, "completed_at", 0);
             data.tasks.push_back(std::move(task));
         }
     }
@@ -0,0 +1,28 @@
+#include <core/PomodoroCycle.h>
+
+namespace WorkBalance::Core {
+
+TimerMode PomodoroCycle::advance(TimerMode completed, int pomodoros_before_long_break,
+                                 int long_breaks_in_cycle) noexcept {
+    switch (completed) {
+        case TimerMode::Pomodoro:
+            ++m_pomodoros_completed;
+            return m_pomodoros_completed >= pomodoros_before_long_break ? TimerMode::LongBreak : TimerMode::ShortBreak;
+        case TimerMode::LongBreak:
+            ++m_long_breaks_taken;
+            if (m_long_breaks_taken >= long_breaks_in_cycle) {
+                reset();
+            }
+            return TimerMode::Pomodoro;
+        case TimerMode::ShortBreak:
+            return TimerMode::Pomodoro;
+    }
+    return TimerMode::Pomodoro;
+}
+
+void PomodoroCycle::reset() noexcept {
+    m_pomodoros_completed = 0;
+    m_long_breaks_taken = 0;
+}
+
+} // namespace WorkBalance::Core
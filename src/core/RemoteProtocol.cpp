@@ -0,0 +1,132 @@
+#include <core/RemoteProtocol.h>
+
+#include <core/ByteStream.h>
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <utility>
+
+namespace WorkBalance::Core {
+
+namespace {
+constexpr std::array BREAK_KIND_NAMES{
+    std::pair{BreakKind::ShortBreak, std::string_view{"short"}},
+    std::pair{BreakKind::LongBreak, std::string_view{"long"}},
+    std::pair{BreakKind::Water, std::string_view{"water"}},
+    std::pair{BreakKind::Standup, std::string_view{"standup"}},
+    std::pair{BreakKind::EyeCare, std::string_view{"eye"}},
+};
+
+constexpr size_t COMMAND_PAYLOAD_SIZE = 3;
+constexpr size_t REPLY_HEADER_SIZE = 2;
+
+std::vector<std::uint8_t> frame(const ByteWriter& payload) {
+    const std::string& bytes = payload.bytes();
+    ByteWriter writer;
+    writer.write(static_cast<std::uint32_t>(bytes.size()));
+    writer.writeSpan(std::span{bytes});
+
+    const std::string& framed = writer.bytes();
+    return {framed.begin(), framed.end()};
+}
+
+ByteReader readerFor(std::span<const std::uint8_t> bytes) {
+    return ByteReader({reinterpret_cast<const char*>(bytes.data()), bytes.size()});
+}
+
+bool isValidAction(std::uint8_t action) {
+    return action >= std::to_underlying(RemoteAction::Show) && action <= std::to_underlying(RemoteAction::Quit);
+}
+
+std::string_view getModeName(TimerMode mode) {
+    switch (mode) {
+        case TimerMode::Pomodoro:
+            return "Pomodoro";
+        case TimerMode::ShortBreak:
+            return "Short break";
+        case TimerMode::LongBreak:
+            return "Long break";
+    }
+    return "Timer";
+}
+
+std::string_view getStateName(TimerState state) {
+    switch (state) {
+        case TimerState::Running:
+            return "running";
+        case TimerState::Paused:
+            return "paused";
+        case TimerState::Stopped:
+            return "stopped";
+    }
+    return "stopped";
+}
+} // namespace
+
+std::string formatSessionStatus(const SessionStatus& status) {
+    constexpr int seconds_per_minute = 60;
+    return std::format("{} {:02}:{:02} ({})\nWater {}/{}, standups {}, eye breaks {}", getModeName(status.mode),
+                       status.remaining_seconds / seconds_per_minute, status.remaining_seconds % seconds_per_minute,
+                       getStateName(status.state), status.water_glasses, status.water_goal, status.standups,
+                       status.eye_breaks);
+}
+
+std::optional<BreakKind> parseBreakKind(std::string_view name) noexcept {
+    const auto it = std::ranges::find(BREAK_KIND_NAMES, name, &std::pair<BreakKind, std::string_view>::second);
+    return it != BREAK_KIND_NAMES.end() ? std::optional{it->first} : std::nullopt;
+}
+
+std::string_view getBreakKindName(BreakKind kind) noexcept {
+    const auto it = std::ranges::find(BREAK_KIND_NAMES, kind, &std::pair<BreakKind, std::string_view>::first);
+    return it != BREAK_KIND_NAMES.end() ? it->second : std::string_view{};
+}
+
+namespace RemoteProtocol {
+
+std::vector<std::uint8_t> encode(const RemoteCommand& command) {
+    ByteWriter payload;
+    payload.write(VERSION);
+    payload.write(std::to_underlying(command.action));
+    payload.write(std::to_underlying(command.break_kind));
+    return frame(payload);
+}
+
+std::vector<std::uint8_t> encode(const RemoteReply& reply) {
+    const size_t message_size = std::min(reply.message.size(), MAX_PAYLOAD_SIZE - REPLY_HEADER_SIZE);
+
+    ByteWriter payload;
+    payload.write(VERSION);
+    payload.write(static_cast<std::uint8_t>(reply.success ? 1 : 0));
+    payload.writeSpan(std::span{reply.message.data(), message_size});
+    return frame(payload);
+}
+
+std::optional<std::uint32_t> decodeLength(std::span<const std::uint8_t, LENGTH_PREFIX_SIZE> prefix) noexcept {
+    auto reader = readerFor(prefix);
+    std::uint32_t length = 0;
+    if (!reader.read(length) || length > MAX_PAYLOAD_SIZE) {
+        return std::nullopt;
+    }
+    return length;
+}
+
+std::optional<RemoteCommand> decodeCommand(std::span<const std::uint8_t> payload) noexcept {
+    if (payload.size() != COMMAND_PAYLOAD_SIZE || payload[0] != VERSION || !isValidAction(payload[1]) ||
+        payload[2] > std::to_underlying(BreakKind::EyeCare)) {
+        return std::nullopt;
+    }
+    return RemoteCommand{static_cast<RemoteAction>(payload[1]), static_cast<BreakKind>(payload[2])};
+}
+
+std::optional<RemoteReply> decodeReply(std::span<const std::uint8_t> payload) {
+    if (payload.size() < REPLY_HEADER_SIZE || payload[0] != VERSION || payload[1] > 1) {
+        return std::nullopt;
+    }
+    const auto message = payload.subspan(REPLY_HEADER_SIZE);
+    return RemoteReply{payload[1] == 1, std::string(message.begin(), message.end())};
+}
+
+} // namespace RemoteProtocol
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,185 @@
+#include <core/ResourcePack.h>
+
+#include <core/ByteStream.h>
+
+#include <zstd.h>
+
+#include <algorithm>
+#include <iostream>
+#include <type_traits>
+
+namespace WorkBalance::Core {
+
+namespace {
+// Layout: header, index records sorted by name, name bytes, entry data. Offsets are from the
+// start of the pack. An entry is zstd-compressed unless its stored size equals its size.
+// Values are in native byte order; the pack is built for the machine it is linked into.
+constexpr std::uint32_t PACK_MAGIC = 0x50524257; // "WBRP"
+constexpr std::uint32_t PACK_VERSION = 1;
+
+struct PackHeader {
+    std::uint32_t magic = PACK_MAGIC;
+    std::uint32_t version = PACK_VERSION;
+    std::uint32_t entry_count = 0;
+    std::uint32_t names_size = 0;
+};
+
+struct IndexRecord {
+    std::uint64_t offset = 0;
+    std::uint64_t stored_size = 0;
+    std::uint64_t size = 0;
+    std::uint32_t name_offset = 0;
+    std::uint32_t name_length = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<PackHeader>);
+static_assert(std::is_trivially_copyable_v<IndexRecord>);
+static_assert(sizeof(IndexRecord) == 32, "IndexRecord is written without padding");
+
+template <typename Entries>
+auto findEntry(Entries& entries, std::string_view name) noexcept -> decltype(entries.data()) {
+    const auto it = std::ranges::lower_bound(entries, name, {}, [](const auto& entry) { return entry.name; });
+    return it != entries.end() && it->name == name ? &*it : nullptr;
+}
+} // namespace
+
+std::vector<std::uint8_t> ResourcePack::build(std::span<const Source> sources, int compression_level) {
+    std::vector<const Source*> sorted;
+    sorted.reserve(sources.size());
+    for (const Source& source : sources) {
+        sorted.push_back(&source);
+    }
+    std::ranges::sort(sorted, {}, [](const Source* source) { return std::string_view{source->name}; });
+
+    std::string names;
+    std::vector<std::vector<std::uint8_t>> stored(sorted.size());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        const Source& source = *sorted[i];
+        names += source.name;
+
+        std::vector<std::uint8_t>& output = stored[i];
+        output.resize(ZSTD_compressBound(source.data.size()));
+        const size_t compressed_size = ZSTD_compress(output.data(), output.size(), source.data.data(),
+                                                     source.data.size(), compression_level);
+        if (ZSTD_isError(compressed_size) != 0U || compressed_size >= source.data.size()) {
+            output.assign(source.data.begin(), source.data.end());
+        } else {
+            output.resize(compressed_size);
+        }
+    }
+
+    PackHeader header;
+    header.entry_count = static_cast<std::uint32_t>(sorted.size());
+    header.names_size = static_cast<std::uint32_t>(names.size());
+
+    ByteWriter writer;
+    writer.write(header);
+    std::uint64_t offset = sizeof(PackHeader) + sorted.size() * sizeof(IndexRecord) + names.size();
+    std::uint32_t name_offset = 0;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        IndexRecord record;
+        record.offset = offset;
+        record.stored_size = stored[i].size();
+        record.size = sorted[i]->data.size();
+        record.name_offset = name_offset;
+        record.name_length = static_cast<std::uint32_t>(sorted[i]->name.size());
+        writer.write(record);
+
+        offset += record.stored_size;
+        name_offset += record.name_length;
+    }
+    writer.writeSpan(std::span<const char>{names});
+    for (const auto& data : stored) {
+        writer.writeSpan(std::span{data});
+    }
+
+    const std::string& bytes = writer.bytes();
+    return {bytes.begin(), bytes.end()};
+}
+
+ResourcePack::ResourcePack(std::span<const std::uint8_t> blob) {
+    const std::span<const char> bytes{reinterpret_cast<const char*>(blob.data()), blob.size()};
+    ByteReader reader(bytes);
+
+    PackHeader header;
+    std::vector<IndexRecord> records;
+    if (!reader.read(header) || header.magic != PACK_MAGIC || header.version != PACK_VERSION ||
+        !reader.readVector(records, header.entry_count) || header.names_size > reader.remaining()) {
+        std::cerr << "Embedded resource pack is malformed\n";
+        return;
+    }
+
+    const size_t names_start = blob.size() - reader.remaining();
+    const std::string_view names{bytes.data() + names_start, header.names_size};
+    m_entries.reserve(records.size());
+    for (const IndexRecord& record : records) {
+        const bool stored_in_pack = record.offset <= blob.size() && record.stored_size <= blob.size() - record.offset;
+        const bool name_in_pack =
+            record.name_offset <= names.size() && record.name_length <= names.size() - record.name_offset;
+        if (!stored_in_pack || !name_in_pack) {
+            std::cerr << "Embedded resource pack has an invalid index\n";
+            m_entries.clear();
+            return;
+        }
+
+        Entry& entry = m_entries.emplace_back();
+        entry.name = names.substr(record.name_offset, record.name_length);
+        entry.stored = blob.subspan(static_cast<size_t>(record.offset), static_cast<size_t>(record.stored_size));
+        entry.size = record.size;
+    }
+
+    if (!std::ranges::is_sorted(m_entries, {}, &Entry::name)) {
+        std::cerr << "Embedded resource pack index is not sorted\n";
+        m_entries.clear();
+        return;
+    }
+    m_valid = true;
+}
+
+bool ResourcePack::contains(std::string_view name) const noexcept {
+    return findEntry(m_entries, name) != nullptr;
+}
+
+std::span<const std::uint8_t> ResourcePack::get(std::string_view name) {
+    Entry* entry = findEntry(m_entries, name);
+    if (entry == nullptr) {
+        std::cerr << "Missing embedded resource: " << name << '\n';
+        return {};
+    }
+
+    // Uncompressed entries are served straight from the blob
+    if (entry->stored.size() == entry->size) {
+        return entry->stored;
+    }
+
+    std::scoped_lock lock(m_mutex);
+    if (!entry->loaded && !decompress(*entry)) {
+        std::cerr << "Failed to decompress embedded resource: " << name << '\n';
+        return {};
+    }
+    return entry->contents;
+}
+
+std::size_t ResourcePack::getDecompressedBytes() const {
+    std::scoped_lock lock(m_mutex);
+    size_t total = 0;
+    for (const Entry& entry : m_entries) {
+        total += entry.contents.size();
+    }
+    return total;
+}
+
+bool ResourcePack::decompress(Entry& entry) {
+    std::vector<std::uint8_t> contents(static_cast<size_t>(entry.size));
+    const size_t result =
+        ZSTD_decompress(contents.data(), contents.size(), entry.stored.data(), entry.stored.size());
+    if (ZSTD_isError(result) != 0U || result != contents.size()) {
+        return false;
+    }
+
+    entry.contents = std::move(contents);
+    entry.loaded = true;
+    return true;
+}
+
+} // namespace WorkBalance::Core
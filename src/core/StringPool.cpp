@@ -0,0 +1,85 @@
+#include <core/StringPool.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+namespace WorkBalance::Core {
+
+StringPool::StringPool(std::size_t chunk_size, std::pmr::memory_resource* resource) noexcept
+    : m_chunk_size(std::max<std::size_t>(chunk_size, 1)), m_resource(resource) {
+}
+
+std::string_view StringPool::intern(std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+
+    if (text.size() > SMALL_STRING_MAX) {
+        return append(text);
+    }
+
+    if (const auto it = m_small_strings.find(text); it != m_small_strings.end()) {
+        return *it;
+    }
+
+    const std::string_view stored = append(text);
+    m_small_strings.insert(stored);
+    return stored;
+}
+
+bool StringPool::owns(std::string_view text) const noexcept {
+    if (text.data() == nullptr) {
+        return false;
+    }
+
+    // Compare as integers: relational operators on unrelated pointers are unspecified
+    const auto address = reinterpret_cast<std::uintptr_t>(text.data());
+    const auto it = std::ranges::upper_bound(m_chunk_index, address, {},
+                                             [](const auto& entry) { return entry.first; });
+    if (it == m_chunk_index.begin()) {
+        return false;
+    }
+
+    const auto& [begin, chunk_index] = *std::prev(it);
+    return address < begin + m_chunks[chunk_index].used;
+}
+
+void StringPool::reserve(std::size_t bytes) {
+    if (!m_chunks.empty() && m_chunks.back().capacity - m_chunks.back().used >= bytes) {
+        return;
+    }
+
+    const std::size_t capacity = std::max(bytes, m_chunk_size);
+    std::unique_ptr<char[], ChunkDeleter> data{static_cast<char*>(m_resource->allocate(capacity, 1)),
+                                               ChunkDeleter{m_resource, capacity}};
+    m_chunks.push_back(Chunk{std::move(data), capacity, 0});
+    m_bytes_reserved += capacity;
+
+    const auto begin = reinterpret_cast<std::uintptr_t>(m_chunks.back().data.get());
+    const auto position = std::ranges::upper_bound(m_chunk_index, begin, {},
+                                                   [](const auto& entry) { return entry.first; });
+    m_chunk_index.emplace(position, begin, m_chunks.size() - 1);
+}
+
+void StringPool::clear() noexcept {
+    m_small_strings.clear();
+    m_chunks.clear();
+    m_chunk_index.clear();
+    m_bytes_used = 0;
+    m_bytes_reserved = 0;
+}
+
+std::string_view StringPool::append(std::string_view text) {
+    reserve(text.size());
+
+    Chunk& chunk = m_chunks.back();
+    char* destination = chunk.data.get() + chunk.used;
+    std::memcpy(destination, text.data(), text.size());
+    chunk.used += text.size();
+    m_bytes_used += text.size();
+    return {destination, text.size()};
+}
+
+} // namespace WorkBalance::Core
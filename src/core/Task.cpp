@@ -1,11 +1,51 @@
 #include <core/Task.h>
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <numeric>
 #include <ranges>
+#include <utility>
 
 namespace WorkBalance::Core {
 
+namespace {
+// Rebuild the name arena once released names outweigh the live ones
+constexpr size_t MIN_COMPACTION_BYTES = 64 * 1024;
+
+[[nodiscard]] std::int64_t currentUnixTime() noexcept {
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+void markCompleted(Task& task) noexcept {
+    if (!task.completed) {
+        task.completed = true;
+        task.completed_at = currentUnixTime();
+    }
+}
+
+// A zero timestamp means "unknown", which is never old enough to archive
+[[nodiscard]] auto completedBefore(std::int64_t cutoff) noexcept {
+    return [cutoff](const Task& task) {
+        return task.completed && task.completed_at != 0 && task.completed_at < cutoff;
+    };
+}
+
+[[nodiscard]] TaskEdit snapshotEdit(TaskEdit::Kind kind, size_t index, const Task& task, std::uint8_t fields) noexcept {
+    TaskEdit edit;
+    edit.kind = kind;
+    edit.fields = fields;
+    edit.index = static_cast<std::uint32_t>(index);
+    edit.name = task.name;
+    edit.estimated_pomodoros = task.estimated_pomodoros;
+    edit.completed_pomodoros = task.completed_pomodoros;
+    edit.completed = task.completed;
+    edit.completed_at = task.completed_at;
+    return edit;
+}
+} // namespace
+
 bool Task::isComplete() const noexcept {
     return completed || completed_pomodoros >= estimated_pomodoros;
 }
@@ -18,8 +58,18 @@ float Task::getProgress() const noexcept {
     return static_cast<float>(completed_pomodoros) / static_cast<float>(estimated_pomodoros);
 }
 
+TaskManager::TaskManager(std::shared_ptr<ITimeSource> time_source) : m_history(std::move(time_source)) {
+}
+
 void TaskManager::addTask(std::string_view name, int estimated_pomodoros) {
-    m_tasks.emplace_back(Task{std::string(name), false, estimated_pomodoros, 0});
+    m_tasks.emplace_back(Task{m_names.intern(name), false, estimated_pomodoros, 0});
+
+    TaskEdit edit;
+    edit.kind = TaskEdit::Kind::Added;
+    edit.index = static_cast<std::uint32_t>(m_tasks.size() - 1);
+    m_history.record(edit);
+
+    ++m_revision;
     updateCounters();
 }
 
@@ -28,37 +78,77 @@ void TaskManager::removeTask(size_t index) {
         return;
     }
 
+    m_history.record(snapshotEdit(TaskEdit::Kind::Removed, index, m_tasks[index], TaskEdit::AllFields));
+    releaseName(m_tasks[index].name);
     m_tasks.erase(m_tasks.begin() + static_cast<std::vector<Task>::difference_type>(index));
+    ++m_revision;
     updateCounters();
+    compactNamesIfWasteful();
 }
 
 void TaskManager::updateTask(size_t index, std::string_view name, int estimated, int completed) {
     if (Task* task = getTask(index); task != nullptr) {
-        task->name = name;
+        const bool completes = !task->completed && completed >= estimated;
+        const auto changed = static_cast<std::uint8_t>(
+            (task->name != name ? TaskEdit::Name : 0) |
+            (task->estimated_pomodoros != estimated ? TaskEdit::Estimated : 0) |
+            (task->completed_pomodoros != completed ? TaskEdit::CompletedPomodoros : 0) |
+            (completes ? TaskEdit::Completed : 0));
+        if (changed != 0) {
+            m_history.record(snapshotEdit(TaskEdit::Kind::Modified, index, *task, changed));
+            ++m_revision;
+        }
+
+        if (task->name != name) {
+            releaseName(task->name);
+            task->name = m_names.intern(name);
+        }
         task->estimated_pomodoros = estimated;
         task->completed_pomodoros = completed;
         // Auto-mark as complete when pomodoros are achieved
         if (task->completed_pomodoros >= task->estimated_pomodoros) {
-            task->completed = true;
+            markCompleted(*task);
+        }
+        if (changed != 0) {
+            m_history.dropIfUnchanged(snapshotEdit(TaskEdit::Kind::Modified, index, *task, TaskEdit::AllFields));
         }
         updateCounters();
+        compactNamesIfWasteful();
     }
 }
 
 void TaskManager::toggleTaskCompletion(size_t index) {
     if (Task* task = getTask(index); task != nullptr) {
-        task->completed = !task->completed;
+        m_history.record(snapshotEdit(TaskEdit::Kind::Modified, index, *task, TaskEdit::Completed));
+        if (task->completed) {
+            task->completed = false;
+        } else {
+            markCompleted(*task);
+        }
+        m_history.dropIfUnchanged(snapshotEdit(TaskEdit::Kind::Modified, index, *task, TaskEdit::AllFields));
+        ++m_revision;
         updateCounters();
     }
 }
 
-void TaskManager::incrementTaskPomodoros(size_t index) {
+void TaskManager::incrementTaskPomodoros(size_t index, bool record_history) {
     if (Task* task = getTask(index); task != nullptr) {
+        if (record_history) {
+            const bool completes = !task->completed && task->completed_pomodoros + 1 >= task->estimated_pomodoros;
+            const auto changed =
+                static_cast<std::uint8_t>(TaskEdit::CompletedPomodoros | (completes ? TaskEdit::Completed : 0));
+            m_history.record(snapshotEdit(TaskEdit::Kind::Modified, index, *task, changed));
+        } else {
+            // A later user edit must not merge into a step recorded before the timer's change
+            m_history.breakCoalescing();
+        }
+
         task->completed_pomodoros++;
         // Auto-mark as complete when pomodoros are achieved
         if (task->completed_pomodoros >= task->estimated_pomodoros) {
-            task->completed = true;
+            markCompleted(*task);
         }
+        ++m_revision;
         updateCounters();
     }
 }
@@ -75,6 +165,18 @@ void TaskManager::moveTask(size_t from_index, size_t to_index) {
         return;
     }
 
+    TaskEdit edit;
+    edit.kind = TaskEdit::Kind::Moved;
+    edit.index = static_cast<std::uint32_t>(from_index);
+    edit.position = static_cast<std::uint32_t>(to_index);
+    m_history.record(edit);
+
+    rotateTask(from_index, to_index);
+    ++m_revision;
+    // No need to update counters as we're just reordering
+}
+
+void TaskManager::rotateTask(size_t from_index, size_t to_index) noexcept {
     if (from_index < to_index) {
         // Moving forward: rotate [from, to+1) left by 1
         std::rotate(m_tasks.begin() + static_cast<std::vector<Task>::difference_type>(from_index),
@@ -86,7 +188,132 @@ void TaskManager::moveTask(size_t from_index, size_t to_index) {
                     m_tasks.begin() + static_cast<std::vector<Task>::difference_type>(from_index),
                     m_tasks.begin() + static_cast<std::vector<Task>::difference_type>(from_index + 1));
     }
-    // No need to update counters as we're just reordering
+}
+
+void TaskManager::adoptTasks(std::vector<Task> tasks, StringPool names) {
+    const std::int64_t now = currentUnixTime();
+    for (Task& task : tasks) {
+        if (!task.name.empty() && !names.owns(task.name)) {
+            task.name = names.intern(task.name);
+        }
+        // Completed before timestamps were tracked: start the archive clock now
+        if (task.completed && task.completed_at == 0) {
+            task.completed_at = now;
+        }
+    }
+
+    m_tasks = std::move(tasks);
+    m_names = std::move(names);
+    m_released_name_bytes = 0;
+    m_history.clear();
+    ++m_revision;
+    updateCounters();
+}
+
+void TaskManager::restoreTask(const Task& task) {
+    Task restored = task;
+    restored.name = m_names.intern(task.name);
+    m_tasks.push_back(restored);
+
+    // Appending leaves the indices recorded in the history valid
+    ++m_revision;
+    updateCounters();
+}
+
+std::vector<Task> TaskManager::getCompletedBefore(std::int64_t cutoff) const {
+    std::vector<Task> stale;
+    std::ranges::copy_if(m_tasks, std::back_inserter(stale), completedBefore(cutoff));
+    return stale;
+}
+
+std::vector<Task> TaskManager::takeCompletedBefore(std::int64_t cutoff) {
+    const auto is_stale = completedBefore(cutoff);
+
+    std::vector<Task> taken;
+    std::ranges::copy_if(m_tasks, std::back_inserter(taken), is_stale);
+    if (taken.empty()) {
+        return taken;
+    }
+
+    std::erase_if(m_tasks, is_stale);
+    for (const Task& task : taken) {
+        releaseName(task.name);
+    }
+    m_history.clear();
+    ++m_revision;
+    updateCounters();
+    return taken;
+}
+
+bool TaskManager::undo() {
+    if (!m_history.undo([this](TaskEdit& edit) { revert(edit); })) {
+        return false;
+    }
+    ++m_revision;
+    updateCounters();
+    compactNamesIfWasteful();
+    return true;
+}
+
+bool TaskManager::redo() {
+    if (!m_history.redo([this](TaskEdit& edit) { revert(edit); })) {
+        return false;
+    }
+    ++m_revision;
+    updateCounters();
+    compactNamesIfWasteful();
+    return true;
+}
+
+void TaskManager::revert(TaskEdit& edit) {
+    const size_t index = edit.index;
+    const auto position = m_tasks.begin() + static_cast<std::vector<Task>::difference_type>(index);
+
+    switch (edit.kind) {
+    case TaskEdit::Kind::Added:
+        if (index < m_tasks.size()) {
+            const std::uint32_t group = edit.group;
+            edit = snapshotEdit(TaskEdit::Kind::Removed, index, m_tasks[index], TaskEdit::AllFields);
+            edit.group = group;
+            releaseName(m_tasks[index].name);
+            m_tasks.erase(position);
+        }
+        break;
+    case TaskEdit::Kind::Removed:
+        if (index <= m_tasks.size()) {
+            m_tasks.insert(position, Task{m_names.intern(edit.name), edit.completed, edit.estimated_pomodoros,
+                                          edit.completed_pomodoros, edit.completed_at});
+            edit.kind = TaskEdit::Kind::Added;
+            edit.fields = 0;
+        }
+        break;
+    case TaskEdit::Kind::Modified:
+        if (index < m_tasks.size()) {
+            // Swap the carried values with the live ones so the edit becomes its own inverse
+            Task& task = m_tasks[index];
+            if ((edit.fields & TaskEdit::Name) != 0) {
+                releaseName(task.name);
+                edit.name = std::exchange(task.name, m_names.intern(edit.name));
+            }
+            if ((edit.fields & TaskEdit::Estimated) != 0) {
+                edit.estimated_pomodoros = std::exchange(task.estimated_pomodoros, edit.estimated_pomodoros);
+            }
+            if ((edit.fields & TaskEdit::CompletedPomodoros) != 0) {
+                edit.completed_pomodoros = std::exchange(task.completed_pomodoros, edit.completed_pomodoros);
+            }
+            if ((edit.fields & TaskEdit::Completed) != 0) {
+                edit.completed = std::exchange(task.completed, edit.completed);
+                edit.completed_at = std::exchange(task.completed_at, edit.completed_at);
+            }
+        }
+        break;
+    case TaskEdit::Kind::Moved:
+        if (index < m_tasks.size() && edit.position < m_tasks.size()) {
+            rotateTask(edit.position, index);
+            std::swap(edit.index, edit.position);
+        }
+        break;
+    }
 }
 
 std::span<const Task> TaskManager::getTasks() const noexcept {
@@ -117,11 +344,39 @@ int TaskManager::getTargetPomodoros() const noexcept {
     return m_target_pomodoros;
 }
 
-void TaskManager::clear() noexcept {
+void TaskManager::clear() {
+    // Record back to front so undo re-inserts each task at its original position
+    m_history.beginBatch();
+    for (size_t index = m_tasks.size(); index-- > 0;) {
+        m_history.record(snapshotEdit(TaskEdit::Kind::Removed, index, m_tasks[index], TaskEdit::AllFields));
+    }
+    m_history.endBatch();
+
     m_tasks.clear();
+    m_names.clear();
+    m_released_name_bytes = 0;
+    ++m_revision;
     updateCounters();
 }
 
+void TaskManager::releaseName(std::string_view name) noexcept {
+    // Interned short names may still be shared, so this is an upper bound on the garbage
+    m_released_name_bytes += name.size();
+}
+
+void TaskManager::compactNamesIfWasteful() {
+    if (m_released_name_bytes < MIN_COMPACTION_BYTES || m_released_name_bytes * 2 < m_names.bytesUsed()) {
+        return;
+    }
+
+    StringPool compacted{StringPool::DEFAULT_CHUNK_SIZE, m_names.resource()};
+    for (Task& task : m_tasks) {
+        task.name = compacted.intern(task.name);
+    }
+    m_names = std::move(compacted);
+    m_released_name_bytes = 0;
+}
+
 void TaskManager::updateCounters() noexcept {
     struct CounterTotals {
         int target = 0;
@@ -0,0 +1,284 @@
+#include <core/TaskArchive.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <unordered_set>
+
+namespace WorkBalance::Core {
+
+namespace {
+// One record per line:
+//   A <tab> completed_at <tab> estimated <tab> completed_pomodoros <tab> escaped name
+//   R <tab> id of the restored record
+constexpr std::string_view ARCHIVE_HEADER = "# WorkBalance task archive v1\n";
+constexpr char RECORD_ARCHIVED = 'A';
+constexpr char RECORD_RESTORED = 'R';
+
+std::string escapeField(std::string_view input) {
+    std::string output;
+    output.reserve(input.size());
+    for (char ch : input) {
+        switch (ch) {
+            case '\\':
+                output += "\\\\";
+                break;
+            case '\t':
+                output += "\\t";
+                break;
+            case '\n':
+                output += "\\n";
+                break;
+            case '\r':
+                output += "\\r";
+                break;
+            default:
+                output += ch;
+                break;
+        }
+    }
+    return output;
+}
+
+std::string unescapeField(std::string_view input) {
+    std::string output;
+    output.reserve(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        if (input[i] != '\\' || i + 1 == input.size()) {
+            output += input[i];
+            continue;
+        }
+        switch (input[++i]) {
+            case 't':
+                output += '\t';
+                break;
+            case 'n':
+                output += '\n';
+                break;
+            case 'r':
+                output += '\r';
+                break;
+            default:
+                output += input[i];
+                break;
+        }
+    }
+    return output;
+}
+
+// Split off the next tab-separated field, advancing `line` past it
+std::string_view nextField(std::string_view& line) {
+    const auto tab = line.find('\t');
+    const std::string_view field = line.substr(0, tab);
+    line = (tab == std::string_view::npos) ? std::string_view{} : line.substr(tab + 1);
+    return field;
+}
+
+template <typename T>
+bool parseNumber(std::string_view text, T& value) {
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc{} && end == text.data() + text.size();
+}
+
+bool endsWithNewline(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open() || file.tellg() <= 0) {
+        return true;
+    }
+    file.seekg(-1, std::ios::end);
+    return file.get() == '\n';
+}
+
+bool containsIgnoreCase(std::string_view haystack, std::string_view needle) {
+    if (needle.empty()) {
+        return true;
+    }
+    const auto lower = [](char ch) { return static_cast<char>(std::tolower(static_cast<unsigned char>(ch))); };
+    return !std::ranges::search(haystack, needle, {}, lower, lower).empty();
+}
+} // namespace
+
+TaskArchive::TaskArchive(std::filesystem::path path) : m_path(std::move(path)) {
+}
+
+std::expected<void, PersistenceError> TaskArchive::append(std::span<const Task> tasks) {
+    if (tasks.empty()) {
+        return {};
+    }
+
+    std::error_code error;
+    const auto existing_size = std::filesystem::file_size(m_path, error);
+    const std::uint64_t base_offset = error ? 0 : existing_size;
+
+    std::string lines;
+    if (base_offset == 0) {
+        lines += ARCHIVE_HEADER;
+    } else if (!endsWithNewline(m_path)) {
+        // Terminate a torn record so it cannot swallow the first new one
+        lines += '\n';
+    }
+
+    std::vector<IndexEntry> added;
+    for (const Task& task : tasks) {
+        const std::uint64_t offset = base_offset + lines.size();
+        lines += std::format("{}\t{}\t{}\t{}\t{}\n", RECORD_ARCHIVED, task.completed_at, task.estimated_pomodoros,
+                             task.completed_pomodoros, escapeField(task.name));
+        if (m_index_loaded) {
+            added.push_back(IndexEntry{offset, task.completed_at, task.estimated_pomodoros, task.completed_pomodoros,
+                                       m_names.intern(task.name)});
+        }
+    }
+
+    if (auto result = appendRaw(lines); !result) {
+        return result;
+    }
+
+    m_entries.insert(m_entries.end(), added.begin(), added.end());
+    return {};
+}
+
+std::expected<std::vector<ArchivedTask>, PersistenceError> TaskArchive::search(std::string_view query,
+                                                                               std::size_t max_results) {
+    if (auto loaded = loadIndex(); !loaded) {
+        return std::unexpected(loaded.error());
+    }
+
+    std::vector<ArchivedTask> results;
+    for (const IndexEntry& entry : m_entries | std::views::reverse) {
+        if (results.size() >= max_results) {
+            break;
+        }
+        if (containsIgnoreCase(entry.name, query)) {
+            results.push_back(toArchivedTask(entry));
+        }
+    }
+    return results;
+}
+
+std::expected<ArchivedTask, PersistenceError> TaskArchive::restore(std::uint64_t id) {
+    if (auto loaded = loadIndex(); !loaded) {
+        return std::unexpected(loaded.error());
+    }
+
+    const auto it = std::ranges::lower_bound(m_entries, id, {}, &IndexEntry::offset);
+    if (it == m_entries.end() || it->offset != id) {
+        return std::unexpected(PersistenceError::EntryNotFound);
+    }
+
+    if (auto result = appendRaw(std::format("{}\t{}\n", RECORD_RESTORED, id)); !result) {
+        return std::unexpected(result.error());
+    }
+
+    ArchivedTask restored = toArchivedTask(*it);
+    m_entries.erase(it);
+    return restored;
+}
+
+std::expected<std::size_t, PersistenceError> TaskArchive::size() {
+    if (auto loaded = loadIndex(); !loaded) {
+        return std::unexpected(loaded.error());
+    }
+    return m_entries.size();
+}
+
+std::expected<void, PersistenceError> TaskArchive::loadIndex() {
+    if (m_index_loaded) {
+        return {};
+    }
+
+    if (!std::filesystem::exists(m_path)) {
+        m_index_loaded = true;
+        return {};
+    }
+
+    std::ifstream file(m_path, std::ios::binary);
+    if (!file.is_open()) {
+        return std::unexpected(PersistenceError::FileOpenError);
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string contents = buffer.str();
+
+    std::vector<IndexEntry> entries;
+    std::unordered_set<std::uint64_t> restored;
+    std::size_t line_start = 0;
+    while (line_start < contents.size()) {
+        const auto line_end = contents.find('\n', line_start);
+        if (line_end == std::string::npos) {
+            // Torn write at the end of the file - ignore the partial record
+            break;
+        }
+
+        std::string_view line(contents.data() + line_start, line_end - line_start);
+        const std::uint64_t offset = line_start;
+        line_start = line_end + 1;
+
+        const std::string_view kind = nextField(line);
+        if (kind.size() != 1) {
+            continue;
+        }
+
+        if (kind.front() == RECORD_ARCHIVED) {
+            IndexEntry entry;
+            entry.offset = offset;
+            if (!parseNumber(nextField(line), entry.completed_at) ||
+                !parseNumber(nextField(line), entry.estimated_pomodoros) ||
+                !parseNumber(nextField(line), entry.completed_pomodoros)) {
+                continue;
+            }
+            entry.name = m_names.intern(unescapeField(line));
+            entries.push_back(entry);
+        } else if (kind.front() == RECORD_RESTORED) {
+            std::uint64_t id = 0;
+            if (parseNumber(nextField(line), id)) {
+                restored.insert(id);
+            }
+        }
+    }
+
+    std::erase_if(entries, [&restored](const IndexEntry& entry) { return restored.contains(entry.offset); });
+    m_entries = std::move(entries);
+    m_index_loaded = true;
+    return {};
+}
+
+std::expected<void, PersistenceError> TaskArchive::appendRaw(const std::string& lines) {
+    try {
+        const auto directory = m_path.parent_path();
+        if (!directory.empty() && !std::filesystem::exists(directory)) {
+            if (!std::filesystem::create_directories(directory)) {
+                return std::unexpected(PersistenceError::DirectoryCreateError);
+            }
+        }
+
+        // Binary mode keeps the byte offsets used as ids identical on every platform
+        std::ofstream file(m_path, std::ios::binary | std::ios::app);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open task archive for writing: " << m_path << '\n';
+            return std::unexpected(PersistenceError::FileOpenError);
+        }
+
+        file << lines;
+        if (!file.good()) {
+            return std::unexpected(PersistenceError::WriteError);
+        }
+        return {};
+    } catch (const std::exception& e) {
+        std::cerr << "Error writing task archive: " << e.what() << '\n';
+        return std::unexpected(PersistenceError::WriteError);
+    }
+}
+
+ArchivedTask TaskArchive::toArchivedTask(const IndexEntry& entry) {
+    return ArchivedTask{entry.offset, std::string(entry.name), entry.completed_at, entry.estimated_pomodoros,
+                        entry.completed_pomodoros};
+}
+
+} // namespace WorkBalance::Core
@@ -0,0 +1,176 @@
+#include <core/TaskHistory.h>
+
+#include <utility>
+
+namespace WorkBalance::Core {
+
+namespace {
+// Rebuild the name arena once it holds this much more than the live edits reference
+constexpr std::size_t MIN_NAME_COMPACTION_BYTES = 4 * 1024;
+
+[[nodiscard]] bool carriesName(const TaskEdit& edit) noexcept {
+    return (edit.fields & TaskEdit::Name) != 0;
+}
+} // namespace
+
+TaskHistory::TaskHistory(std::shared_ptr<ITimeSource> time_source) : m_time_source(std::move(time_source)) {
+}
+
+void TaskHistory::record(TaskEdit edit) {
+    const auto now = m_time_source->now();
+    const bool within_window = m_coalesce_open && (now - m_last_record_time) <= m_coalesce_window;
+
+    clearRedo();
+    storeName(edit);
+
+    if (m_batch_depth == 0 && within_window && !m_undo.empty()) {
+        TaskEdit& last = m_undo.back();
+        const std::size_t previous_cost = costOf(last);
+        if (tryCoalesce(last, edit)) {
+            m_memory_used -= previous_cost;
+            if (last.kind == TaskEdit::Kind::Moved && last.index == last.position) {
+                // Task ended up where it started - nothing left to undo
+                m_undo.pop_back();
+            } else {
+                m_memory_used += costOf(last);
+            }
+            m_last_record_time = now;
+            return;
+        }
+    }
+
+    edit.group = (m_batch_depth > 0) ? m_batch_group : m_next_group++;
+    m_memory_used += costOf(edit);
+    m_undo.push_back(edit);
+
+    m_last_record_time = now;
+    m_coalesce_open = (m_batch_depth == 0);
+
+    trimToLimit();
+    compactNamesIfWasteful();
+}
+
+void TaskHistory::dropIfUnchanged(const TaskEdit& current) noexcept {
+    if (m_batch_depth > 0 || m_undo.empty()) {
+        return;
+    }
+    const TaskEdit& last = m_undo.back();
+    if (last.kind != TaskEdit::Kind::Modified || last.index != current.index || !carriesSameValues(last, current)) {
+        return;
+    }
+    m_memory_used -= costOf(last);
+    m_undo.pop_back();
+    m_coalesce_open = false;
+}
+
+void TaskHistory::beginBatch() noexcept {
+    if (m_batch_depth++ == 0) {
+        m_batch_group = m_next_group++;
+        m_coalesce_open = false;
+    }
+}
+
+void TaskHistory::endBatch() noexcept {
+    if (m_batch_depth > 0 && --m_batch_depth == 0) {
+        m_batch_group = 0;
+    }
+}
+
+void TaskHistory::setMemoryLimit(std::size_t bytes) {
+    m_memory_limit = bytes;
+    trimToLimit();
+}
+
+void TaskHistory::clear() noexcept {
+    m_undo.clear();
+    m_redo.clear();
+    m_names.clear();
+    m_memory_used = 0;
+    m_coalesce_open = false;
+}
+
+bool TaskHistory::tryCoalesce(TaskEdit& last, const TaskEdit& edit) noexcept {
+    if (last.kind == TaskEdit::Kind::Modified && edit.kind == TaskEdit::Kind::Modified && last.index == edit.index) {
+        // Keep the oldest value of every field; only fields new to this entry are taken over
+        const auto added = static_cast<std::uint8_t>(edit.fields & ~last.fields);
+        if ((added & TaskEdit::Name) != 0) {
+            last.name = edit.name;
+        }
+        if ((added & TaskEdit::Estimated) != 0) {
+            last.estimated_pomodoros = edit.estimated_pomodoros;
+        }
+        if ((added & TaskEdit::CompletedPomodoros) != 0) {
+            last.completed_pomodoros = edit.completed_pomodoros;
+        }
+        if ((added & TaskEdit::Completed) != 0) {
+            last.completed = edit.completed;
+        }
+        last.fields |= added;
+        return true;
+    }
+
+    if (last.kind == TaskEdit::Kind::Moved && edit.kind == TaskEdit::Kind::Moved && last.position == edit.index) {
+        // Dragging the same task again: a -> b followed by b -> c is a -> c
+        last.position = edit.position;
+        return true;
+    }
+
+    return false;
+}
+
+bool TaskHistory::carriesSameValues(const TaskEdit& edit, const TaskEdit& current) noexcept {
+    return (!carriesName(edit) || edit.name == current.name) &&
+           ((edit.fields & TaskEdit::Estimated) == 0 || edit.estimated_pomodoros == current.estimated_pomodoros) &&
+           ((edit.fields & TaskEdit::CompletedPomodoros) == 0 ||
+            edit.completed_pomodoros == current.completed_pomodoros) &&
+           ((edit.fields & TaskEdit::Completed) == 0 || edit.completed == current.completed);
+}
+
+std::size_t TaskHistory::costOf(const TaskEdit& edit) noexcept {
+    return sizeof(TaskEdit) + (carriesName(edit) ? edit.name.size() : 0);
+}
+
+void TaskHistory::storeName(TaskEdit& edit) {
+    if (carriesName(edit)) {
+        edit.name = m_names.intern(edit.name);
+    } else {
+        edit.name = {};
+    }
+}
+
+void TaskHistory::clearRedo() noexcept {
+    for (const TaskEdit& edit : m_redo) {
+        m_memory_used -= costOf(edit);
+    }
+    m_redo.clear();
+}
+
+void TaskHistory::trimToLimit() {
+    // Always keep the newest group, even if it alone exceeds the limit
+    while (m_memory_used > m_memory_limit && !m_undo.empty() && m_undo.front().group != m_undo.back().group) {
+        const std::uint32_t oldest_group = m_undo.front().group;
+        while (!m_undo.empty() && m_undo.front().group == oldest_group) {
+            m_memory_used -= costOf(m_undo.front());
+            m_undo.pop_front();
+        }
+    }
+}
+
+void TaskHistory::compactNamesIfWasteful() {
+    // Memory accounting is entry size plus name bytes, so the remainder is the live name total
+    const std::size_t live_bytes = m_memory_used - ((m_undo.size() + m_redo.size()) * sizeof(TaskEdit));
+    if (m_names.bytesUsed() < MIN_NAME_COMPACTION_BYTES || m_names.bytesUsed() < live_bytes * 2) {
+        return;
+    }
+
+    StringPool compacted{1024, m_names.resource()};
+    for (TaskEdit& edit : m_undo) {
+        edit.name = carriesName(edit) ? compacted.intern(edit.name) : std::string_view{};
+    }
+    for (TaskEdit& edit : m_redo) {
+        edit.name = carriesName(edit) ? compacted.intern(edit.name) : std::string_view{};
+    }
+    m_names = std::move(compacted);
+}
+
+} // namespace WorkBalance::Core
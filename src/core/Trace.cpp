@@ -0,0 +1,147 @@
+#include <core/Trace.h>
+
+#include <algorithm>
+#include <bit>
+#include <exception>
+#include <format>
+
+namespace WorkBalance::Core {
+namespace {
+std::atomic<std::uint64_t> g_next_tracer_id{1};
+
+// The calling thread's ring in the tracer it last recorded into
+struct CachedRing {
+    std::uint64_t tracer_id = 0;
+    TraceRing* ring = nullptr;
+};
+thread_local CachedRing t_cached_ring;
+
+// Trace-event timestamps are microseconds
+[[nodiscard]] double toMicroseconds(std::int64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+} // namespace
+
+TraceRing::TraceRing(std::size_t capacity)
+    : m_slots(std::make_unique<Slot[]>(std::bit_ceil(std::max<std::size_t>(capacity, 2)))),
+      m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1) {
+}
+
+std::vector<TraceRing::Event> TraceRing::snapshot() const {
+    const std::uint64_t head = m_head.load(std::memory_order_acquire);
+    const std::uint64_t size = std::min<std::uint64_t>(head, capacity());
+    const std::uint64_t first = head - size;
+
+    std::vector<Event> events;
+    events.reserve(static_cast<std::size_t>(size));
+    for (std::uint64_t index = first; index < head; ++index) {
+        const Slot& slot = m_slots[index & m_mask];
+        events.push_back(Event{slot.name.load(std::memory_order_acquire), slot.start_ns.load(std::memory_order_acquire),
+                               slot.duration_ns.load(std::memory_order_acquire)});
+    }
+
+    // If a copied slot was already being overwritten, the acquire loads above make the head
+    // read here cover that write, so every slot it may have touched is dropped
+    const std::uint64_t head_after = m_head.load(std::memory_order_relaxed);
+    const std::uint64_t overwritten_before = head_after + 1 > capacity() ? head_after + 1 - capacity() : 0;
+    if (overwritten_before > first) {
+        const auto stale = static_cast<std::ptrdiff_t>(std::min<std::uint64_t>(overwritten_before - first, size));
+        events.erase(events.begin(), events.begin() + stale);
+    }
+    return events;
+}
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::Tracer(std::size_t events_per_thread)
+    : m_id(g_next_tracer_id.fetch_add(1, std::memory_order_relaxed)), m_origin(Clock::now()),
+      m_events_per_thread(events_per_thread) {
+}
+
+Tracer::~Tracer() = default;
+
+void Tracer::record(const char* name, Clock::time_point start, Clock::time_point end) noexcept {
+    TraceRing* ring = ringForCurrentThread();
+    if (ring != nullptr) {
+        ring->push(name, sinceOrigin(start), std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+}
+
+void Tracer::setThreadName(std::string_view name) {
+    ThreadRing& thread = findOrAddThread();
+    const std::lock_guard lock{m_mutex};
+    thread.name = name;
+}
+
+void Tracer::clear() noexcept {
+    m_cleared_at_ns.store(sinceOrigin(Clock::now()), std::memory_order_relaxed);
+}
+
+std::string Tracer::toChromeTraceJson() const {
+    const std::int64_t cleared_at = m_cleared_at_ns.load(std::memory_order_relaxed);
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    const auto append = [&](const std::string& event) {
+        if (!first) {
+            json += ",\n";
+        }
+        json += event;
+        first = false;
+    };
+
+    const std::lock_guard lock{m_mutex};
+    for (const auto& thread : m_threads) {
+        const std::string name = thread->name.empty() ? std::format("thread {}", thread->tid) : thread->name;
+        append(std::format(R"({{"ph":"M","pid":1,"tid":{},"name":"thread_name","args":{{"name":"{}"}}}})",
+                           thread->tid, escapeJson(name)));
+        for (const TraceRing::Event& event : thread->ring.snapshot()) {
+            if (event.start_ns < cleared_at || event.name == nullptr) {
+                continue;
+            }
+            append(std::format(R"({{"ph":"X","pid":1,"tid":{},"name":"{}","ts":{:.3f},"dur":{:.3f}}})", thread->tid,
+                               escapeJson(event.name), toMicroseconds(event.start_ns),
+                               toMicroseconds(event.duration_ns)));
+        }
+    }
+    json += "]}\n";
+    return json;
+}
+
+std::expected<void, PersistenceError> Tracer::writeChromeTrace(const std::filesystem::path& path) const {
+    // A viewer may load the previous trace while this one is written
+    return writeFileAtomically(path, toChromeTraceJson());
+}
+
+TraceRing* Tracer::ringForCurrentThread() {
+    if (t_cached_ring.tracer_id == m_id) {
+        return t_cached_ring.ring;
+    }
+    try {
+        TraceRing* ring = &findOrAddThread().ring;
+        t_cached_ring = CachedRing{m_id, ring};
+        return ring;
+    } catch (const std::exception&) {
+        // Out of memory for a new ring; the event is dropped
+        return nullptr;
+    }
+}
+
+Tracer::ThreadRing& Tracer::findOrAddThread() {
+    const auto id = std::this_thread::get_id();
+    const std::lock_guard lock{m_mutex};
+    const auto existing = std::ranges::find_if(m_threads, [id](const auto& thread) { return thread->thread == id; });
+    if (existing != m_threads.end()) {
+        return **existing;
+    }
+    const auto tid = static_cast<std::uint32_t>(m_threads.size() + 1);
+    return *m_threads.emplace_back(std::make_unique<ThreadRing>(id, tid, m_events_per_thread));
+}
+
+std::int64_t Tracer::sinceOrigin(Clock::time_point time) const noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_origin).count();
+}
+
+} // namespace WorkBalance::Core
@@ -1,12 +1,14 @@
 #include <core/WellnessTimer.h>
 
 #include <algorithm>
+#include <utility>
 
 namespace WorkBalance::Core {
 
-WellnessTimer::WellnessTimer(WellnessType type, int interval_seconds, int break_duration_seconds) noexcept
-    : m_type(type), m_interval_seconds(interval_seconds), m_break_duration_seconds(break_duration_seconds),
-      m_remaining_time(interval_seconds) {
+WellnessTimer::WellnessTimer(WellnessType type, int interval_seconds, int break_duration_seconds,
+                             std::shared_ptr<ITimeSource> time_source) noexcept
+    : m_time_source(std::move(time_source)), m_type(type), m_interval_seconds(interval_seconds),
+      m_break_duration_seconds(break_duration_seconds), m_remaining_time(interval_seconds) {
 }
 
 bool WellnessTimer::update() noexcept {
@@ -14,7 +16,7 @@ bool WellnessTimer::update() noexcept {
         return false;
     }
 
-    const auto now = std::chrono::steady_clock::now();
+    const auto now = m_time_source->now();
     const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - m_last_time);
 
     if (elapsed.count() >= 1) {
@@ -44,7 +46,7 @@ bool WellnessTimer::update() noexcept {
 void WellnessTimer::start() noexcept {
     if (!m_running) {
         m_running = true;
-        m_last_time = std::chrono::steady_clock::now();
+        m_last_time = m_time_source->now();
     }
 }
 
@@ -79,7 +81,7 @@ void WellnessTimer::startBreak() noexcept {
     m_reminder_active = false;
     m_remaining_time = m_break_duration_seconds;
     m_running = true;
-    m_last_time = std::chrono::steady_clock::now();
+    m_last_time = m_time_source->now();
 }
 
 void WellnessTimer::endBreak() noexcept {
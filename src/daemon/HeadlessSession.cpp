@@ -0,0 +1,205 @@
+#include <daemon/HeadlessSession.h>
+
+#include <utility>
+
+namespace WorkBalance::Daemon {
+
+namespace {
+constexpr int SECONDS_PER_MINUTE = 60;
+} // namespace
+
+HeadlessSession::HeadlessSession(Core::PersistentData data, System::IAudioService* audio,
+                                 System::INotificationService* notifications,
+                                 std::shared_ptr<Core::ITimeSource> time_source)
+    : m_settings(data.settings), m_audio(audio), m_notifications(notifications),
+      m_timer(data.settings.pomodoro_duration_minutes * SECONDS_PER_MINUTE,
+              data.settings.short_break_duration_minutes * SECONDS_PER_MINUTE,
+              data.settings.long_break_duration_minutes * SECONDS_PER_MINUTE, std::move(time_source)),
+      // The controllers get no audio: sounds here follow the per-type enable and volume settings
+      m_timer_controller(m_timer),
+      m_wellness(std::make_unique<Core::WellnessTimer>(Core::WellnessType::Water,
+                                                       Core::WellnessDefaults::DEFAULT_WATER_INTERVAL),
+                 std::make_unique<Core::WellnessTimer>(Core::WellnessType::Standup,
+                                                       Core::WellnessDefaults::DEFAULT_STANDUP_INTERVAL,
+                                                       Core::WellnessDefaults::DEFAULT_STANDUP_DURATION),
+                 std::make_unique<Core::WellnessTimer>(Core::WellnessType::EyeStrain,
+                                                       Core::WellnessDefaults::DEFAULT_EYE_INTERVAL,
+                                                       Core::WellnessDefaults::DEFAULT_EYE_BREAK_DURATION)),
+      m_current_task_index(data.current_task_index) {
+    m_wellness.applySettings(m_settings.water_interval_minutes, m_settings.water_daily_goal,
+                             m_settings.standup_interval_minutes, m_settings.standup_duration_minutes,
+                             m_settings.eye_care_interval_minutes, m_settings.eye_care_break_seconds);
+    [[maybe_unused]] const auto subscription = m_wellness.onTimerComplete.subscribe(
+        [this](Core::WellnessType type) { handleWellnessTimerComplete(type); });
+
+    m_tasks.adoptTasks(std::move(data.tasks), std::move(data.task_names));
+
+    // With nobody around to acknowledge a reminder, only the looping ones run unattended
+    if (m_settings.water_auto_loop) {
+        m_wellness.getWaterTimer()->start();
+    }
+    if (m_settings.standup_auto_loop) {
+        m_wellness.getStandupTimer()->start();
+    }
+    if (m_settings.eye_care_auto_loop) {
+        m_wellness.getEyeCareTimer()->start();
+    }
+}
+
+bool HeadlessSession::update() {
+    m_wellness.update();
+    if (!m_timer_controller.update()) {
+        return false;
+    }
+    handleTimerComplete();
+    return true;
+}
+
+void HeadlessSession::handleTimerComplete() {
+    m_timer.stop();
+    playSound(m_settings.pomodoro_sound_enabled, m_settings.pomodoro_sound_volume,
+              &System::IAudioService::playBellSound);
+
+    const Core::TimerMode completed = m_timer.getCurrentMode();
+    if (canNotify(m_settings.pomodoro_notification_enabled)) {
+        switch (completed) {
+            case Core::TimerMode::Pomodoro:
+                m_notifications->showPomodoroComplete();
+                break;
+            case Core::TimerMode::ShortBreak:
+                m_notifications->showShortBreakComplete();
+                break;
+            case Core::TimerMode::LongBreak:
+                m_notifications->showLongBreakComplete();
+                break;
+        }
+    }
+
+    if (completed == Core::TimerMode::Pomodoro && m_current_task_index >= 0 &&
+        static_cast<size_t>(m_current_task_index) < m_tasks.getTaskCount()) {
+        m_tasks.incrementTaskPomodoros(static_cast<size_t>(m_current_task_index), false);
+    }
+
+    const Core::TimerMode next_mode =
+        m_cycle.advance(completed, m_settings.pomodoros_before_long_break, m_settings.long_breaks_in_cycle);
+    m_timer_controller.setMode(next_mode);
+    if (next_mode == Core::TimerMode::Pomodoro ? m_settings.auto_start_pomodoros : m_settings.auto_start_breaks) {
+        m_timer.start();
+    }
+}
+
+void HeadlessSession::handleWellnessTimerComplete(Core::WellnessType type) {
+    switch (type) {
+        case Core::WellnessType::Water:
+            playSound(m_settings.water_sound_enabled, m_settings.water_sound_volume,
+                      &System::IAudioService::playHydrationSound);
+            if (canNotify(m_settings.water_notification_enabled)) {
+                m_notifications->showWaterReminder();
+            }
+            if (m_settings.water_auto_loop) {
+                m_wellness.acknowledgeWater();
+            }
+            break;
+        case Core::WellnessType::Standup:
+            // The controller already restarted the interval if a break just ended
+            if (m_wellness.getStandupTimer()->isReminderActive()) {
+                playSound(m_settings.standup_sound_enabled, m_settings.standup_sound_volume,
+                          &System::IAudioService::playWalkSound);
+                if (canNotify(m_settings.standup_notification_enabled)) {
+                    m_notifications->showStandupReminder();
+                }
+                if (m_settings.standup_auto_loop) {
+                    m_wellness.acknowledgeStandup();
+                }
+            }
+            break;
+        case Core::WellnessType::EyeStrain:
+            if (m_wellness.getEyeCareTimer()->isReminderActive()) {
+                playSound(m_settings.eye_care_sound_enabled, m_settings.eye_care_sound_volume,
+                          &System::IAudioService::playBellSound);
+                if (canNotify(m_settings.eye_care_notification_enabled)) {
+                    m_notifications->showEyeCareReminder();
+                }
+                if (m_settings.eye_care_auto_loop) {
+                    m_wellness.acknowledgeEyeCare();
+                }
+            }
+            break;
+        case Core::WellnessType::Pomodoro:
+            break;
+    }
+}
+
+Core::RemoteReply HeadlessSession::handleCommand(const Core::RemoteCommand& command) {
+    switch (command.action) {
+        case Core::RemoteAction::Show:
+            return {false, "workbalanced is running headless; stop it with --quit to open the window"};
+        case Core::RemoteAction::ToggleTimer:
+            m_timer_controller.toggle();
+            return {true, Core::formatSessionStatus(getStatus())};
+        case Core::RemoteAction::StartBreak:
+            return startBreak(command.break_kind);
+        case Core::RemoteAction::Status:
+            return {true, Core::formatSessionStatus(getStatus())};
+        case Core::RemoteAction::Quit:
+            m_quit_requested = true;
+            return {};
+    }
+    return {false, "Unsupported command"};
+}
+
+Core::RemoteReply HeadlessSession::startBreak(Core::BreakKind kind) {
+    switch (kind) {
+        case Core::BreakKind::ShortBreak:
+            m_timer_controller.setMode(Core::TimerMode::ShortBreak);
+            m_timer.start();
+            break;
+        case Core::BreakKind::LongBreak:
+            m_timer_controller.setMode(Core::TimerMode::LongBreak);
+            m_timer.start();
+            break;
+        case Core::BreakKind::Water:
+            m_wellness.acknowledgeWater();
+            break;
+        case Core::BreakKind::Standup:
+            m_wellness.startStandupBreak();
+            break;
+        case Core::BreakKind::EyeCare:
+            m_wellness.startEyeCareBreak();
+            break;
+    }
+    return {true, Core::formatSessionStatus(getStatus())};
+}
+
+Core::PersistentData HeadlessSession::snapshot() const {
+    Core::PersistentData data;
+    data.settings = m_settings;
+    const auto tasks = m_tasks.getTasks();
+    data.tasks.assign(tasks.begin(), tasks.end());
+    data.current_task_index = m_current_task_index;
+    return data;
+}
+
+Core::SessionStatus HeadlessSession::getStatus() const {
+    const auto counters = m_wellness.getCounters();
+    return {.mode = m_timer.getCurrentMode(),
+            .state = m_timer.getState(),
+            .remaining_seconds = m_timer.getRemainingTime(),
+            .water_glasses = counters.water_glasses,
+            .water_goal = m_settings.water_daily_goal,
+            .standups = counters.standups_completed,
+            .eye_breaks = counters.eye_breaks_completed};
+}
+
+void HeadlessSession::playSound(bool enabled, int volume, void (System::IAudioService::*sound)()) {
+    if (enabled && m_audio != nullptr && m_audio->isInitialized()) {
+        m_audio->setVolume(volume);
+        (m_audio->*sound)();
+    }
+}
+
+bool HeadlessSession::canNotify(bool enabled) const {
+    return enabled && m_notifications != nullptr && m_notifications->isSupported();
+}
+
+} // namespace WorkBalance::Daemon
@@ -0,0 +1,70 @@
+#include "core/Persistence.h"
+#include "daemon/HeadlessSession.h"
+#include "system/IAudioService.h"
+#include "system/INotificationService.h"
+#include "system/SingleInstance.h"
+#include <chrono>
+#include <csignal>
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <utility>
+
+namespace {
+volatile std::sig_atomic_t g_stop_requested = 0;
+
+extern "C" void requestStop(int /*signal*/) {
+    g_stop_requested = 1;
+}
+
+// Reminders only resolve to whole seconds, so a few wakeups per second keep them on time
+constexpr std::chrono::milliseconds POLL_INTERVAL{200};
+} // namespace
+
+int main() {
+    try {
+        // Shares the GUI's instance lock: `WorkBalance --status` and friends talk to whichever one runs
+        const auto config_directory = WorkBalance::Core::PersistenceManager::getDefaultConfigDirectory();
+        WorkBalance::System::SingleInstance instance{config_directory};
+        if (!instance.isPrimary()) {
+            std::cerr << "WorkBalance is already running\n";
+            return 1;
+        }
+
+        const WorkBalance::Core::PersistenceManager persistence{config_directory};
+        auto loaded = persistence.load();
+        if (!loaded) {
+            std::cerr << "Warning: " << WorkBalance::Core::getPersistenceErrorMessage(loaded.error())
+                      << ", using default settings\n";
+        }
+
+        const auto audio = WorkBalance::System::createAudioService();
+        const auto notifications = WorkBalance::System::createNotificationService();
+        WorkBalance::Daemon::HeadlessSession session{loaded ? std::move(*loaded) : WorkBalance::Core::PersistentData{},
+                                                     audio.get(), notifications.get()};
+
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+
+        const auto save = [&] {
+            if (const auto result = persistence.save(session.snapshot()); !result) {
+                std::cerr << "Warning: " << WorkBalance::Core::getPersistenceErrorMessage(result.error()) << '\n';
+            }
+        };
+
+        while (g_stop_requested == 0 && !session.isQuitRequested()) {
+            instance.processCommands(
+                [&](const WorkBalance::Core::RemoteCommand& command) { return session.handleCommand(command); });
+            if (session.update()) {
+                save();
+            }
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        }
+
+        save();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 1;
+    }
+}
@@ -1,6 +1,7 @@
 #include <system/AudioManager.h>
 
-#include "assets/embedded_resources.h"
+#include <core/MemoryAccounting.h>
+#include <system/EmbeddedResources.h>
 
 #include <algorithm>
 #include <filesystem>
@@ -28,10 +29,25 @@ namespace {
 
     return std::filesystem::temp_directory_path() / filename;
 }
+
+void* allocateTracked(size_t size, void* /*user_data*/) {
+    return Core::MemoryAccounting::allocate(Core::MemoryTag::Audio, size);
+}
+
+void* reallocateTracked(void* pointer, size_t size, void* /*user_data*/) {
+    return Core::MemoryAccounting::reallocate(Core::MemoryTag::Audio, pointer, size);
+}
+
+void freeTracked(void* pointer, void* /*user_data*/) {
+    Core::MemoryAccounting::deallocate(Core::MemoryTag::Audio, pointer);
+}
 } // namespace
 
 AudioManager::AudioManager() {
-    const ma_result result = ma_engine_init(nullptr, &m_engine);
+    // The engine hands these callbacks down to its device, resource manager, decoders and sounds
+    ma_engine_config config = ma_engine_config_init();
+    config.allocationCallbacks = {nullptr, allocateTracked, reallocateTracked, freeTracked};
+    const ma_result result = ma_engine_init(&config, &m_engine);
     if (result != MA_SUCCESS) {
         std::cerr << "Failed to initialize audio engine. Error code: " << result << '\n';
         m_initialized = false;
@@ -69,7 +85,7 @@ void AudioManager::playClickSound() {
         return;
     }
 
-    playEmbeddedSound(click_wav_data, click_wav_data_size);
+    playEmbeddedSound(getEmbeddedResources().get(Resources::CLICK_SOUND));
 }
 
 void AudioManager::playBellSound() {
@@ -77,7 +93,7 @@ void AudioManager::playBellSound() {
         return;
     }
 
-    playEmbeddedSound(bell_wav_data, bell_wav_data_size);
+    playEmbeddedSound(getEmbeddedResources().get(Resources::BELL_SOUND));
 }
 
 void AudioManager::playHydrationSound() {
@@ -85,7 +101,7 @@ void AudioManager::playHydrationSound() {
         return;
     }
 
-    playEmbeddedSound(hydration_wav_data, hydration_wav_data_size);
+    playEmbeddedSound(getEmbeddedResources().get(Resources::HYDRATION_SOUND));
 }
 
 void AudioManager::playWalkSound() {
@@ -93,7 +109,7 @@ void AudioManager::playWalkSound() {
         return;
     }
 
-    playEmbeddedSound(walk_wav_data, walk_wav_data_size);
+    playEmbeddedSound(getEmbeddedResources().get(Resources::WALK_SOUND));
 }
 
 bool AudioManager::isInitialized() const noexcept {
@@ -112,9 +128,12 @@ int AudioManager::getVolume() const noexcept {
     return m_volume;
 }
 
-void AudioManager::playEmbeddedSound(const unsigned char* data, size_t size) {
+void AudioManager::playEmbeddedSound(std::span<const std::uint8_t> wav) {
     // Stop any currently playing notification sound and clean up
     stopNotificationSounds();
+    if (wav.empty()) {
+        return;
+    }
 
     try {
         m_current_temp_path = createTemporaryWavPath();
@@ -130,7 +149,7 @@ void AudioManager::playEmbeddedSound(const unsigned char* data, size_t size) {
         return;
     }
 
-    temp_file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    temp_file.write(reinterpret_cast<const char*>(wav.data()), static_cast<std::streamsize>(wav.size()));
     temp_file.close();
 
     const std::string path_string = m_current_temp_path.string();
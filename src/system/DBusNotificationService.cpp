@@ -0,0 +1,249 @@
+#include "system/DBusNotificationService.h"
+#include "system/NotificationTexts.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+#include <dbus/dbus.h>
+
+namespace WorkBalance::System {
+
+namespace {
+constexpr std::uint8_t URGENCY_NORMAL = 1;
+// Lets the notification daemon pick how long the popup stays
+constexpr std::int32_t DEFAULT_EXPIRE_TIMEOUT = -1;
+
+/// @brief Frees a DBusError's strings when it goes out of scope
+class ScopedError {
+  public:
+    ScopedError() noexcept {
+        dbus_error_init(&m_error);
+    }
+    ~ScopedError() {
+        dbus_error_free(&m_error);
+    }
+
+    ScopedError(const ScopedError&) = delete;
+    ScopedError& operator=(const ScopedError&) = delete;
+    ScopedError(ScopedError&&) = delete;
+    ScopedError& operator=(ScopedError&&) = delete;
+
+    [[nodiscard]] DBusError* get() noexcept {
+        return &m_error;
+    }
+    [[nodiscard]] const char* message() const noexcept {
+        return m_error.message != nullptr ? m_error.message : "unknown error";
+    }
+
+  private:
+    DBusError m_error{};
+};
+
+struct MessageDeleter {
+    void operator()(DBusMessage* message) const noexcept {
+        dbus_message_unref(message);
+    }
+};
+using MessagePtr = std::unique_ptr<DBusMessage, MessageDeleter>;
+
+bool appendString(DBusMessageIter& iter, std::string_view text) {
+    // libdbus copies the string, which has to be nul-terminated
+    const std::string terminated(text);
+    const char* value = terminated.c_str();
+    return dbus_message_iter_append_basic(&iter, DBUS_TYPE_STRING, &value) != 0;
+}
+
+// Notify(app_name s, replaces_id u, app_icon s, summary s, body s, actions as, hints a{sv}, expire_timeout i)
+MessagePtr makeNotifyCall(std::string_view title, std::string_view message, std::uint32_t replaces_id) {
+    const std::string service(DBusNotificationService::SERVICE_NAME);
+    const std::string path(DBusNotificationService::OBJECT_PATH);
+    const std::string interface(DBusNotificationService::INTERFACE_NAME);
+    MessagePtr call{dbus_message_new_method_call(service.c_str(), path.c_str(), interface.c_str(), "Notify")};
+    if (!call) {
+        return nullptr;
+    }
+
+    DBusMessageIter args;
+    dbus_message_iter_init_append(call.get(), &args);
+    const dbus_uint32_t replaces = replaces_id;
+    bool appended = appendString(args, DBusNotificationService::APP_NAME) &&
+                    dbus_message_iter_append_basic(&args, DBUS_TYPE_UINT32, &replaces) != 0 &&
+                    appendString(args, "") && appendString(args, title) && appendString(args, message);
+
+    DBusMessageIter actions;
+    appended = appended && dbus_message_iter_open_container(&args, DBUS_TYPE_ARRAY, "s", &actions) != 0 &&
+               dbus_message_iter_close_container(&args, &actions) != 0;
+
+    DBusMessageIter hints;
+    DBusMessageIter entry;
+    DBusMessageIter variant;
+    const unsigned char urgency = URGENCY_NORMAL;
+    appended = appended && dbus_message_iter_open_container(&args, DBUS_TYPE_ARRAY, "{sv}", &hints) != 0 &&
+               dbus_message_iter_open_container(&hints, DBUS_TYPE_DICT_ENTRY, nullptr, &entry) != 0 &&
+               appendString(entry, "urgency") &&
+               dbus_message_iter_open_container(&entry, DBUS_TYPE_VARIANT, "y", &variant) != 0 &&
+               dbus_message_iter_append_basic(&variant, DBUS_TYPE_BYTE, &urgency) != 0 &&
+               dbus_message_iter_close_container(&entry, &variant) != 0 &&
+               dbus_message_iter_close_container(&hints, &entry) != 0 &&
+               dbus_message_iter_close_container(&args, &hints) != 0;
+
+    const dbus_int32_t expire_timeout = DEFAULT_EXPIRE_TIMEOUT;
+    appended = appended && dbus_message_iter_append_basic(&args, DBUS_TYPE_INT32, &expire_timeout) != 0;
+    return appended ? std::move(call) : nullptr;
+}
+} // namespace
+
+void DBusNotificationService::ConnectionDeleter::operator()(::DBusConnection* connection) const noexcept {
+    // Private connections must be closed before the last reference is dropped
+    dbus_connection_close(connection);
+    dbus_connection_unref(connection);
+}
+
+std::string DBusNotificationService::sessionBusAddress() {
+    const char* address = std::getenv("DBUS_SESSION_BUS_ADDRESS");
+    return address != nullptr ? address : "";
+}
+
+DBusNotificationService::DBusNotificationService(std::string bus_address, std::chrono::milliseconds call_timeout)
+    : m_bus_address(std::move(bus_address)), m_call_timeout(call_timeout) {
+}
+
+DBusNotificationService::~DBusNotificationService() {
+    if (m_worker.joinable()) {
+        m_worker.request_stop();
+        m_wakeups.fetch_add(1, std::memory_order_release);
+        m_wakeups.notify_one();
+        m_worker.join();
+    }
+}
+
+bool DBusNotificationService::initialize() {
+    if (m_worker.joinable()) {
+        return m_supported;
+    }
+    if (m_bus_address.empty()) {
+        m_bus_address = sessionBusAddress();
+    }
+    m_supported = !m_bus_address.empty();
+    if (!m_supported) {
+        std::cerr << "Desktop notifications are not available: no D-Bus session bus\n";
+        return false;
+    }
+    // The worker's connection is private to it, but libdbus keeps global state of its own
+    dbus_threads_init_default();
+    m_worker = std::jthread([this](const std::stop_token& stop) { run(stop); });
+    return true;
+}
+
+bool DBusNotificationService::isSupported() const noexcept {
+    return m_supported;
+}
+
+void DBusNotificationService::showNotification(std::string_view title, std::string_view message) {
+    if (!m_supported) {
+        return;
+    }
+    if (!m_queue.tryPush(Request{std::string(title), std::string(message)})) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    m_wakeups.fetch_add(1, std::memory_order_release);
+    m_wakeups.notify_one();
+}
+
+void DBusNotificationService::showPomodoroComplete() {
+    show(NotificationTexts::POMODORO_COMPLETE);
+}
+
+void DBusNotificationService::showShortBreakComplete() {
+    show(NotificationTexts::SHORT_BREAK_COMPLETE);
+}
+
+void DBusNotificationService::showLongBreakComplete() {
+    show(NotificationTexts::LONG_BREAK_COMPLETE);
+}
+
+void DBusNotificationService::showWaterReminder() {
+    show(NotificationTexts::WATER_REMINDER);
+}
+
+void DBusNotificationService::showStandupReminder() {
+    show(NotificationTexts::STANDUP_REMINDER);
+}
+
+void DBusNotificationService::showEyeCareReminder() {
+    show(NotificationTexts::EYE_CARE_REMINDER);
+}
+
+void DBusNotificationService::show(const NotificationText& text) {
+    showNotification(text.title, text.message);
+}
+
+void DBusNotificationService::run(const std::stop_token& stop) {
+    while (!stop.stop_requested()) {
+        // Read before draining: a push after the drain changes the counter and ends the wait
+        const std::uint32_t wakeups = m_wakeups.load(std::memory_order_acquire);
+        while (auto request = m_queue.tryPop()) {
+            if (stop.stop_requested()) {
+                return;
+            }
+            deliver(*request);
+        }
+        m_wakeups.wait(wakeups, std::memory_order_acquire);
+    }
+}
+
+bool DBusNotificationService::connect() {
+    // Ids handed out by a daemon that went away mean nothing to the next one
+    m_notification_ids.clear();
+    m_connection.reset();
+
+    ScopedError error;
+    std::unique_ptr<::DBusConnection, ConnectionDeleter> connection{
+        dbus_connection_open_private(m_bus_address.c_str(), error.get())};
+    if (connection) {
+        // libdbus would otherwise be allowed to _exit() the whole app when the bus goes away
+        dbus_connection_set_exit_on_disconnect(connection.get(), FALSE);
+        if (dbus_bus_register(connection.get(), error.get()) != 0) {
+            m_connection = std::move(connection);
+            return true;
+        }
+    }
+    if (!std::exchange(m_warned, true)) {
+        std::cerr << "Warning: Failed to connect to the D-Bus bus at " << m_bus_address << ": " << error.message()
+                  << '\n';
+    }
+    return false;
+}
+
+void DBusNotificationService::deliver(const Request& request) {
+    if ((!m_connection || dbus_connection_get_is_connected(m_connection.get()) == 0) && !connect()) {
+        return;
+    }
+
+    const auto known = m_notification_ids.find(request.title);
+    const std::uint32_t replaces_id = known != m_notification_ids.end() ? known->second : 0;
+    const MessagePtr call = makeNotifyCall(request.title, request.message, replaces_id);
+    if (!call) {
+        return;
+    }
+
+    ScopedError error;
+    const MessagePtr reply{dbus_connection_send_with_reply_and_block(
+        m_connection.get(), call.get(), static_cast<int>(m_call_timeout.count()), error.get())};
+    dbus_uint32_t id = 0;
+    if (!reply || dbus_message_get_args(reply.get(), error.get(), DBUS_TYPE_UINT32, &id, DBUS_TYPE_INVALID) == 0) {
+        if (!std::exchange(m_warned, true)) {
+            std::cerr << "Warning: Desktop notification failed: " << error.message() << '\n';
+        }
+        return;
+    }
+
+    if (id != 0) {
+        m_notification_ids[request.title] = id;
+    }
+    m_warned = false;
+}
+
+} // namespace WorkBalance::System
@@ -0,0 +1,69 @@
+#include <system/EmbeddedResources.h>
+
+#include <cstdint>
+#include <span>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+// The pack built by WorkBalanceResourcePacker is assembled straight into read-only data;
+// CMake passes its path in WORKBALANCE_RESOURCE_PACK_PATH
+#if defined(__APPLE__)
+#define WORKBALANCE_ASM_SYMBOL(name) "_" #name
+#define WORKBALANCE_ASM_RODATA ".pushsection __TEXT,__const\n"
+// Mach-O has no symbol types or sizes
+#define WORKBALANCE_ASM_OBJECT(name, size) ""
+#else
+#define WORKBALANCE_ASM_SYMBOL(name) #name
+#define WORKBALANCE_ASM_RODATA ".pushsection .rodata\n"
+// Typed and sized so debuggers, nm and the linker see a data object rather than a bare label
+#define WORKBALANCE_ASM_OBJECT(name, size) ".type " #name ", %object\n.size " #name ", " size "\n"
+#endif
+
+// push/popsection hand back whatever section the compiler was emitting into
+__asm__(WORKBALANCE_ASM_RODATA
+        ".balign 16\n"
+        ".global " WORKBALANCE_ASM_SYMBOL(workbalance_resource_pack) "\n"
+        WORKBALANCE_ASM_OBJECT(workbalance_resource_pack, "workbalance_resource_pack_end - workbalance_resource_pack")
+        WORKBALANCE_ASM_SYMBOL(workbalance_resource_pack) ":\n"
+        ".incbin \"" WORKBALANCE_RESOURCE_PACK_PATH "\"\n"
+        ".global " WORKBALANCE_ASM_SYMBOL(workbalance_resource_pack_end) "\n"
+        WORKBALANCE_ASM_OBJECT(workbalance_resource_pack_end, "0")
+        WORKBALANCE_ASM_SYMBOL(workbalance_resource_pack_end) ":\n"
+        ".popsection\n");
+
+extern "C" const std::uint8_t workbalance_resource_pack[];
+extern "C" const std::uint8_t workbalance_resource_pack_end[];
+#endif
+
+namespace WorkBalance::System {
+
+namespace {
+std::span<const std::uint8_t> linkedResourcePack() {
+#ifdef _WIN32
+    // MSVC has no .incbin; the pack is an RCDATA resource named in the generated resources.rc
+    constexpr auto* rcdata = MAKEINTRESOURCEW(10); // RT_RCDATA
+    HRSRC resource = FindResourceW(nullptr, L"WORKBALANCE_RESOURCES", rcdata);
+    if (resource == nullptr) {
+        return {};
+    }
+    HGLOBAL handle = LoadResource(nullptr, resource);
+    if (handle == nullptr) {
+        return {};
+    }
+    // Resource memory is mapped with the image and never has to be freed
+    return {static_cast<const std::uint8_t*>(LockResource(handle)), SizeofResource(nullptr, resource)};
+#else
+    return {workbalance_resource_pack, workbalance_resource_pack_end};
+#endif
+}
+} // namespace
+
+Core::ResourcePack& getEmbeddedResources() {
+    static Core::ResourcePack pack(linkedResourcePack());
+    return pack;
+}
+
+} // namespace WorkBalance::System
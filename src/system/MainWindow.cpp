@@ -1,12 +1,14 @@
 #include <system/MainWindow.h>
 
 #include <core/Configuration.h>
-#include "assets/embedded_resources.h"
-#include "assets/icons/stb_image.h"
+#include <core/DisplayLayout.h>
+#include <core/IconSet.h>
+#include <system/EmbeddedResources.h>
 
-#include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <tuple>
+#include <vector>
 
 #ifdef _WIN32
 #define GLFW_EXPOSE_NATIVE_WIN32
@@ -17,60 +19,10 @@
 
 namespace WorkBalance::System {
 namespace {
-struct MonitorData {
-    GLFWmonitor* handle = nullptr;
-    const GLFWvidmode* mode = nullptr;
-    int x = 0;
-    int y = 0;
-
-    [[nodiscard]] bool valid() const noexcept {
-        return handle != nullptr && mode != nullptr;
-    }
-};
-
-[[nodiscard]] std::optional<MonitorData> queryPrimaryMonitor() {
-    GLFWmonitor* monitor = glfwGetPrimaryMonitor();
-    if (monitor == nullptr) {
-        return std::nullopt;
-    }
-
-    const GLFWvidmode* mode = glfwGetVideoMode(monitor);
-    if (mode == nullptr) {
-        return std::nullopt;
-    }
-
-    MonitorData data{monitor, mode};
-    glfwGetMonitorPos(monitor, &data.x, &data.y);
-    return data;
-}
-
-void positionWindow(GLFWwindow* window, int x, int y) {
-    if (window != nullptr) {
-        glfwSetWindowPos(window, x, y);
-    }
-}
-
-void sizeWindow(GLFWwindow* window, int width, int height) {
-    if (window != nullptr) {
-        glfwSetWindowSize(window, width, height);
-    }
-}
-
-[[nodiscard]] int calculateWindowHeight(const MonitorData& monitor) {
-    constexpr int default_height = 600;
-    constexpr int taskbar_height = 90;
-    if (!monitor.valid()) {
-        return default_height;
-    }
-    return monitor.mode->height - taskbar_height;
-}
-
-[[nodiscard]] MonitorData monitorOrDefault(std::optional<MonitorData> monitor) {
-    if (monitor.has_value()) {
-        return *monitor;
-    }
-    return MonitorData{};
-}
+// Logical size of the compact overlay mode and its gap below the top of the work area
+constexpr int OVERLAY_WIDTH = 620;
+constexpr int OVERLAY_HEIGHT = 70;
+constexpr int OVERLAY_TOP = 10;
 
 #ifdef _WIN32
 void applyRoundedCornersToWindow(GLFWwindow* window) {
@@ -104,66 +56,23 @@ void setIcon(GLFWwindow* window) {
         return;
     }
 
-    int width = 0;
-    int height = 0;
-    int channels = 0;
-
-    unsigned char* pixels = stbi_load_from_memory(app_icon_png_data, static_cast<int>(app_icon_png_data_size), &width,
-                                                  &height, &channels, 4);
-
-    if (pixels == nullptr) {
-        return;
+    // Every pre-scaled size is passed so the platform can pick title bar and taskbar icons itself
+    const Core::IconSet icon_set(getEmbeddedResources().get(Resources::APP_ICON));
+    std::vector<GLFWimage> icons;
+    icons.reserve(icon_set.getImages().size());
+    for (const auto& image : icon_set.getImages()) {
+        // GLFW copies the pixels and never writes through this pointer
+        icons.push_back({image.width, image.height, const_cast<unsigned char*>(image.pixels.data())});
     }
 
-    GLFWimage icon{};
-    icon.width = width;
-    icon.height = height;
-    icon.pixels = pixels;
-
-    glfwSetWindowIcon(window, 1, &icon);
-    stbi_image_free(pixels);
-}
-
-void applyOverlaySize(GLFWwindow* window, const MonitorData& monitor) {
-    constexpr int overlay_width = 620;
-    constexpr int overlay_height = 70;
-    sizeWindow(window, overlay_width, overlay_height);
-
-    if (!monitor.valid()) {
-        return;
-    }
-
-    const int window_x = monitor.x + ((monitor.mode->width - overlay_width) / 2);
-    const int window_y = monitor.y + 10;
-    positionWindow(window, window_x, window_y);
-}
-
-void applyNormalSize(GLFWwindow* window, const MonitorData& monitor) {
-    const int height = calculateWindowHeight(monitor);
-    sizeWindow(window, Core::Configuration::DEFAULT_WINDOW_WIDTH, height);
-
-    if (!monitor.valid()) {
-        return;
+    if (!icons.empty()) {
+        glfwSetWindowIcon(window, static_cast<int>(icons.size()), icons.data());
     }
-
-    const int window_x = monitor.x + ((monitor.mode->width - Core::Configuration::DEFAULT_WINDOW_WIDTH) / 2);
-    const int window_y = monitor.y + ((monitor.mode->height - height) / 2);
-    positionWindow(window, window_x, window_y);
-}
-
-void centerWindow(GLFWwindow* window, int width, int height) {
-    const auto monitor = queryPrimaryMonitor();
-    if (!monitor.has_value()) {
-        return;
-    }
-
-    const int window_x = monitor->x + ((monitor->mode->width - width) / 2);
-    const int window_y = monitor->y + ((monitor->mode->height - height) / 2);
-    positionWindow(window, window_x, window_y);
 }
 } // namespace
 
-MainWindow::MainWindow(int width, int height, std::string_view title) {
+MainWindow::MainWindow(int width, int height, std::string_view title, const MonitorTopology& monitors)
+    : m_monitors(&monitors), m_normal_width(width), m_fallback_height(height) {
     setupOpenGLContext();
 
     m_window = glfwCreateWindow(width, height, title.data(), nullptr, nullptr);
@@ -171,14 +80,20 @@ MainWindow::MainWindow(int width, int height, std::string_view title) {
         throw std::runtime_error("Failed to create GLFW window");
     }
 
-    centerWindow(m_window, width, height);
-    applyRoundedCornersToWindow(m_window);
-    setIcon(m_window);
+    trackGeometry();
+    resizeForNormal();
+    applyRoundedCorners();
+    setWindowIcon();
 
     glfwMakeContextCurrent(m_window);
     glfwSwapInterval(0);
 }
 
+float MainWindow::uiScale() const noexcept {
+    const WindowGeometry& window = geometry();
+    return Core::DisplayLayout::uiScale(window.content_scale, window.width, window.framebuffer_width);
+}
+
 void MainWindow::setSavedOverlayPosition(int x, int y) {
     m_saved_overlay_x = x;
     m_saved_overlay_y = y;
@@ -194,45 +109,38 @@ void MainWindow::setOverlayMode(bool overlay_mode) {
     }
 
     glfwSetWindowAttrib(m_window, GLFW_FLOATING, overlay_mode ? GLFW_TRUE : GLFW_FALSE);
-    const MonitorData monitor = monitorOrDefault(queryPrimaryMonitor());
+    const float scale = uiScale();
 
     if (overlay_mode) {
         // Save current normal position before switching to overlay
-        glfwGetWindowPos(m_window, &m_saved_normal_x, &m_saved_normal_y);
-
-        // Set overlay size
-        constexpr int overlay_width = 620;
-        constexpr int overlay_height = 70;
-        sizeWindow(m_window, overlay_width, overlay_height);
+        std::tie(m_saved_normal_x, m_saved_normal_y) = getPosition();
 
         // Restore saved overlay position if we have one, otherwise center at top
         if (m_saved_overlay_x >= 0 && m_saved_overlay_y >= 0) {
-            positionWindow(m_window, m_saved_overlay_x, m_saved_overlay_y);
-        } else if (monitor.valid()) {
-            const int window_x = monitor.x + ((monitor.mode->width - overlay_width) / 2);
-            const int window_y = monitor.y + 10;
-            positionWindow(m_window, window_x, window_y);
+            setSize(Core::DisplayLayout::scaleLength(OVERLAY_WIDTH, scale),
+                    Core::DisplayLayout::scaleLength(OVERLAY_HEIGHT, scale));
+            setPosition(m_saved_overlay_x, m_saved_overlay_y);
+        } else {
+            resizeForOverlay();
         }
     } else {
         // Save current overlay position before switching to normal
-        glfwGetWindowPos(m_window, &m_saved_overlay_x, &m_saved_overlay_y);
-
-        // Restore to normal size
-        const int height = calculateWindowHeight(monitor);
-        sizeWindow(m_window, Core::Configuration::DEFAULT_WINDOW_WIDTH, height);
+        std::tie(m_saved_overlay_x, m_saved_overlay_y) = getPosition();
 
         // Restore saved position if we have one, otherwise center
         if (m_saved_normal_x >= 0 && m_saved_normal_y >= 0) {
-            positionWindow(m_window, m_saved_normal_x, m_saved_normal_y);
+            setSize(Core::DisplayLayout::scaleLength(m_normal_width, scale), getFullHeight());
+            setPosition(m_saved_normal_x, m_saved_normal_y);
         } else {
-            applyNormalSize(m_window, monitor);
+            resizeForNormal();
         }
     }
 }
 
-MainWindow::MainWindow(MainWindow&& other) noexcept : WindowBase() {
-    m_window = other.m_window;
-    other.m_window = nullptr;
+MainWindow::MainWindow(MainWindow&& other) noexcept
+    : WindowBase(), m_monitors(other.m_monitors), m_normal_width(other.m_normal_width),
+      m_fallback_height(other.m_fallback_height) {
+    takeWindow(other);
 }
 
 MainWindow& MainWindow::operator=(MainWindow&& other) noexcept {
@@ -244,8 +152,10 @@ MainWindow& MainWindow::operator=(MainWindow&& other) noexcept {
         glfwDestroyWindow(m_window);
     }
 
-    m_window = other.m_window;
-    other.m_window = nullptr;
+    m_monitors = other.m_monitors;
+    m_normal_width = other.m_normal_width;
+    m_fallback_height = other.m_fallback_height;
+    takeWindow(other);
     return *this;
 }
 
@@ -260,10 +170,20 @@ void MainWindow::setupOpenGLContext() const {
 
     glfwWindowHint(GLFW_TRANSPARENT_FRAMEBUFFER, GLFW_TRUE);
     glfwWindowHint(GLFW_DECORATED, GLFW_FALSE);
+    // Lets Windows resize the window when it is dragged to a monitor with a different DPI
+    glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_TRUE);
+}
+
+const MonitorInfo* MainWindow::currentMonitor() const noexcept {
+    const WindowGeometry& window = geometry();
+    return m_monitors->monitorFor({window.x, window.y, window.width, window.height});
 }
 
-void MainWindow::centerOnMonitor(int width, int height) const {
-    centerWindow(m_window, width, height);
+void MainWindow::centerOnMonitor(int width, int height) {
+    if (const MonitorInfo* monitor = currentMonitor(); monitor != nullptr) {
+        const Core::ScreenRect rect = Core::DisplayLayout::centeredIn(monitor->work_area, width, height);
+        setPosition(rect.x, rect.y);
+    }
 }
 
 void MainWindow::applyRoundedCorners() const {
@@ -274,19 +194,32 @@ void MainWindow::setWindowIcon() const {
     setIcon(m_window);
 }
 
-void MainWindow::resizeForOverlay() const {
-    const MonitorData monitor = monitorOrDefault(queryPrimaryMonitor());
-    applyOverlaySize(m_window, monitor);
+void MainWindow::resizeForOverlay() {
+    const float scale = uiScale();
+    const int width = Core::DisplayLayout::scaleLength(OVERLAY_WIDTH, scale);
+    const int height = Core::DisplayLayout::scaleLength(OVERLAY_HEIGHT, scale);
+    setSize(width, height);
+
+    if (const MonitorInfo* monitor = currentMonitor(); monitor != nullptr) {
+        const int top = Core::DisplayLayout::scaleLength(OVERLAY_TOP, scale);
+        const Core::ScreenRect rect = Core::DisplayLayout::topCenteredIn(monitor->work_area, width, height, top);
+        setPosition(rect.x, rect.y);
+    }
 }
 
-void MainWindow::resizeForNormal() const {
-    const MonitorData monitor = monitorOrDefault(queryPrimaryMonitor());
-    applyNormalSize(m_window, monitor);
+void MainWindow::resizeForNormal() {
+    const int width = Core::DisplayLayout::scaleLength(m_normal_width, uiScale());
+    const int height = getFullHeight();
+    setSize(width, height);
+    centerOnMonitor(width, height);
 }
 
 int MainWindow::getFullHeight() const {
-    const MonitorData monitor = monitorOrDefault(queryPrimaryMonitor());
-    return calculateWindowHeight(monitor);
+    const float scale = uiScale();
+    const int fallback = Core::DisplayLayout::scaleLength(m_fallback_height, scale);
+    const MonitorInfo* monitor = currentMonitor();
+    return monitor != nullptr ? Core::DisplayLayout::normalWindowHeight(monitor->work_area, scale, fallback)
+                              : fallback;
 }
 
 } // namespace WorkBalance::System
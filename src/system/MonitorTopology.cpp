@@ -0,0 +1,87 @@
+#include <system/MonitorTopology.h>
+
+#include <cassert>
+
+namespace WorkBalance::System {
+namespace {
+// GLFW's monitor callback has no user pointer
+MonitorTopology* g_topology = nullptr;
+} // namespace
+
+MonitorTopology::MonitorTopology() {
+    assert(g_topology == nullptr && "only one MonitorTopology may exist at a time");
+    g_topology = this;
+    m_previous_callback = glfwSetMonitorCallback(onMonitorChanged);
+    refresh();
+}
+
+MonitorTopology::~MonitorTopology() {
+    glfwSetMonitorCallback(m_previous_callback);
+    g_topology = nullptr;
+}
+
+void MonitorTopology::refresh() {
+    m_monitors.clear();
+    ++m_generation;
+
+    int count = 0;
+    GLFWmonitor** handles = glfwGetMonitors(&count);
+    if (handles == nullptr) {
+        return;
+    }
+
+    GLFWmonitor* primary = glfwGetPrimaryMonitor();
+    m_monitors.reserve(static_cast<std::size_t>(count));
+    for (GLFWmonitor* handle : std::span(handles, static_cast<std::size_t>(count))) {
+        MonitorInfo info;
+        info.handle = handle;
+        info.primary = handle == primary;
+        glfwGetMonitorPos(handle, &info.bounds.x, &info.bounds.y);
+        if (const GLFWvidmode* mode = glfwGetVideoMode(handle); mode != nullptr) {
+            info.bounds.width = mode->width;
+            info.bounds.height = mode->height;
+        }
+
+        glfwGetMonitorWorkarea(handle, &info.work_area.x, &info.work_area.y, &info.work_area.width,
+                               &info.work_area.height);
+        if (info.work_area.empty()) {
+            info.work_area = info.bounds;
+        }
+
+        float scale_y = 1.0f;
+        glfwGetMonitorContentScale(handle, &info.content_scale, &scale_y);
+        m_monitors.push_back(info);
+    }
+}
+
+const MonitorInfo* MonitorTopology::primary() const noexcept {
+    for (const MonitorInfo& monitor : m_monitors) {
+        if (monitor.primary) {
+            return &monitor;
+        }
+    }
+    return m_monitors.empty() ? nullptr : &m_monitors.front();
+}
+
+const MonitorInfo* MonitorTopology::monitorFor(const Core::ScreenRect& rect) const noexcept {
+    const int center_x = rect.x + (rect.width / 2);
+    const int center_y = rect.y + (rect.height / 2);
+    for (const MonitorInfo& monitor : m_monitors) {
+        if (monitor.bounds.contains(center_x, center_y)) {
+            return &monitor;
+        }
+    }
+    return primary();
+}
+
+void MonitorTopology::onMonitorChanged(GLFWmonitor* monitor, int event) {
+    if (g_topology == nullptr) {
+        return;
+    }
+    g_topology->refresh();
+    if (g_topology->m_previous_callback != nullptr) {
+        g_topology->m_previous_callback(monitor, event);
+    }
+}
+
+} // namespace WorkBalance::System
@@ -1,7 +1,12 @@
 #include "system/NotificationManager.h"
+#include "system/NotificationTexts.h"
 
 #include <iostream>
 
+#ifndef _WIN32
+#include "system/DBusNotificationService.h"
+#endif
+
 #ifdef _WIN32
 #include <Windows.h>
 #include <wintoastlib.h>
@@ -113,31 +118,39 @@ void NotificationManager::showNotification(std::string_view title, std::string_v
 }
 
 void NotificationManager::showPomodoroComplete() {
-    showNotification("Pomodoro Complete! \xF0\x9F\x8E\x89", "Great work! Time for a well-deserved break.");
+    show(NotificationTexts::POMODORO_COMPLETE);
 }
 
 void NotificationManager::showShortBreakComplete() {
-    showNotification("Break's Over! \xF0\x9F\x92\xAA", "Ready to focus? Let's get back to work!");
+    show(NotificationTexts::SHORT_BREAK_COMPLETE);
 }
 
 void NotificationManager::showLongBreakComplete() {
-    showNotification("Long Break Complete! \xE2\x9C\xA8", "Feeling refreshed? Time to start a new cycle!");
+    show(NotificationTexts::LONG_BREAK_COMPLETE);
 }
 
 void NotificationManager::showWaterReminder() {
-    showNotification("Stay Hydrated! \xF0\x9F\x92\xA7", "Time to drink some water. Your body will thank you!");
+    show(NotificationTexts::WATER_REMINDER);
 }
 
 void NotificationManager::showStandupReminder() {
-    showNotification("Time to Move! \xF0\x9F\x9A\xB6", "Stand up, stretch, and take a short walk.");
+    show(NotificationTexts::STANDUP_REMINDER);
 }
 
 void NotificationManager::showEyeCareReminder() {
-    showNotification("Eye Break! \xF0\x9F\x91\x80", "Look at something 20 feet away for 20 seconds.");
+    show(NotificationTexts::EYE_CARE_REMINDER);
+}
+
+void NotificationManager::show(const NotificationText& text) {
+    showNotification(text.title, text.message);
 }
 
 std::unique_ptr<INotificationService> createNotificationService() {
+#ifdef _WIN32
     auto service = std::make_unique<NotificationManager>();
+#else
+    auto service = std::make_unique<DBusNotificationService>();
+#endif
     (void)service->initialize();
     return service;
 }
@@ -9,39 +9,65 @@ constexpr int DEFAULT_HEIGHT = 80;
 constexpr int START_X = 100;
 constexpr int START_Y = 100;
 constexpr const char* OVERLAY_TITLE = "Timer Overlay";
-OverlayWindow::OverlayWindow() {
+OverlayWindow::OverlayWindow(GLFWwindow* shared_context) : m_shared_context(shared_context) {
+}
+
+void OverlayWindow::create() {
+    if (m_window != nullptr) {
+        return;
+    }
+
     configureWindowHints();
 
-    m_window = glfwCreateWindow(DEFAULT_WIDTH, DEFAULT_HEIGHT, OVERLAY_TITLE, nullptr, nullptr);
+    // Sharing lets the overlay draw with the ImGui textures and shaders created in the main context
+    m_window = glfwCreateWindow(DEFAULT_WIDTH, DEFAULT_HEIGHT, OVERLAY_TITLE, nullptr, m_shared_context);
     if (m_window == nullptr) {
         throw std::runtime_error("Failed to create overlay window");
     }
+    trackGeometry();
+
+    // The overlay is presented from the main loop; vsync here would stall the main window too
+    GLFWwindow* previous_context = glfwGetCurrentContext();
+    glfwMakeContextCurrent(m_window);
+    glfwSwapInterval(0);
+    glfwMakeContextCurrent(previous_context);
 
     glfwSetWindowPos(m_window, START_X, START_Y);
-    glfwHideWindow(m_window);
 }
 
 void OverlayWindow::show() {
-    if (m_window == nullptr || m_visible) {
+    if (m_window == nullptr || isVisible()) {
         return;
     }
 
-    glfwShowWindow(m_window);
-    m_visible = true;
+    WindowBase::show();
 }
 
 void OverlayWindow::hide() {
-    if (m_window == nullptr || !m_visible) {
+    if (m_window == nullptr || !isVisible()) {
         return;
     }
 
-    glfwHideWindow(m_window);
-    m_visible = false;
+    WindowBase::hide();
+    m_hidden_since = std::chrono::steady_clock::now();
+}
+
+bool OverlayWindow::releaseIfHiddenFor(std::chrono::steady_clock::duration delay) {
+    if (m_window == nullptr || isVisible() || std::chrono::steady_clock::now() - m_hidden_since < delay) {
+        return false;
+    }
+
+    glfwDestroyWindow(m_window);
+    m_window = nullptr;
+    return true;
 }
 
 void OverlayWindow::configureWindowHints() {
     using namespace Core;
 
+    // Hints persist between window creations; start from GLFW's defaults rather than whatever
+    // the last window left behind
+    glfwDefaultWindowHints();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, Configuration::GL_MAJOR_VERSION);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, Configuration::GL_MINOR_VERSION);
     if constexpr (Configuration::USE_CORE_PROFILE) {
@@ -49,6 +75,8 @@ void OverlayWindow::configureWindowHints() {
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     }
 
+    // Created hidden, so it never flashes at the default position before being placed
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
     glfwWindowHint(GLFW_DECORATED, GLFW_FALSE);
     glfwWindowHint(GLFW_FLOATING, GLFW_TRUE);
     glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
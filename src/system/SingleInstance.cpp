@@ -0,0 +1,458 @@
+#include <system/SingleInstance.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <WinSock2.h>
+#include <Windows.h>
+#include <afunix.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace WorkBalance::System {
+
+namespace {
+#ifdef _WIN32
+using NativeSocket = SOCKET;
+using IoSize = int;
+constexpr NativeSocket INVALID_NATIVE_SOCKET = INVALID_SOCKET;
+#else
+using NativeSocket = int;
+using IoSize = size_t;
+constexpr NativeSocket INVALID_NATIVE_SOCKET = -1;
+#endif
+
+#ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
+
+constexpr int LISTEN_BACKLOG = 8;
+// Clients being served at once; further launches wait in the listen backlog
+constexpr std::size_t MAX_PENDING_CLIENTS = 8;
+// A connected launch writes its whole command at once; a client still incomplete after this
+// long is dropped
+constexpr std::chrono::milliseconds CLIENT_TIMEOUT{2000};
+constexpr std::chrono::milliseconds CONNECT_RETRY_INTERVAL{10};
+
+class Socket {
+  public:
+    Socket() = default;
+    explicit Socket(NativeSocket socket) : m_socket(socket) {
+    }
+    ~Socket() {
+        close();
+    }
+
+    Socket(const Socket&) = delete;
+    Socket& operator=(const Socket&) = delete;
+    Socket(Socket&& other) noexcept : m_socket(std::exchange(other.m_socket, INVALID_NATIVE_SOCKET)) {
+    }
+    Socket& operator=(Socket&& other) noexcept {
+        if (this != &other) {
+            close();
+            m_socket = std::exchange(other.m_socket, INVALID_NATIVE_SOCKET);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] bool isValid() const noexcept {
+        return m_socket != INVALID_NATIVE_SOCKET;
+    }
+
+    [[nodiscard]] NativeSocket get() const noexcept {
+        return m_socket;
+    }
+
+    void close() noexcept {
+        if (isValid()) {
+#ifdef _WIN32
+            closesocket(m_socket);
+#else
+            ::close(m_socket);
+#endif
+            m_socket = INVALID_NATIVE_SOCKET;
+        }
+    }
+
+  private:
+    NativeSocket m_socket = INVALID_NATIVE_SOCKET;
+};
+
+std::optional<sockaddr_un> makeAddress(const std::filesystem::path& path) {
+#ifdef _WIN32
+    // Windows AF_UNIX addresses are UTF-8
+    const auto utf8 = path.u8string();
+    const std::string native(utf8.begin(), utf8.end());
+#else
+    const std::string& native = path.native();
+#endif
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (native.size() >= sizeof(address.sun_path)) {
+        return std::nullopt;
+    }
+    std::memcpy(address.sun_path, native.data(), native.size());
+    return address;
+}
+
+Socket createSocket() {
+    Socket socket{::socket(AF_UNIX, SOCK_STREAM, 0)};
+#ifndef _WIN32
+    if (socket.isValid()) {
+        fcntl(socket.get(), F_SETFD, FD_CLOEXEC);
+#ifdef SO_NOSIGPIPE
+        const int enabled = 1;
+        setsockopt(socket.get(), SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+    }
+#endif
+    return socket;
+}
+
+bool setNonBlocking(NativeSocket socket, bool enabled) {
+#ifdef _WIN32
+    u_long mode = enabled ? 1 : 0;
+    return ioctlsocket(socket, FIONBIO, &mode) == 0;
+#else
+    const int flags = fcntl(socket, F_GETFL, 0);
+    return flags >= 0 && fcntl(socket, F_SETFL, enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK)) == 0;
+#endif
+}
+
+void setTimeouts(NativeSocket socket, std::chrono::milliseconds timeout) {
+#ifdef _WIN32
+    const auto value = static_cast<DWORD>(timeout.count());
+#else
+    timeval value{};
+    value.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+    value.tv_usec = static_cast<suseconds_t>((timeout.count() % 1000) * 1000);
+#endif
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&value), sizeof(value));
+    setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool sendAll(NativeSocket socket, std::span<const std::uint8_t> bytes) {
+    while (!bytes.empty()) {
+        const auto sent =
+            ::send(socket, reinterpret_cast<const char*>(bytes.data()), static_cast<IoSize>(bytes.size()), SEND_FLAGS);
+        if (sent <= 0) {
+            return false;
+        }
+        bytes = bytes.subspan(static_cast<size_t>(sent));
+    }
+    return true;
+}
+
+bool receiveExact(NativeSocket socket, std::span<std::uint8_t> bytes) {
+    while (!bytes.empty()) {
+        const auto received =
+            ::recv(socket, reinterpret_cast<char*>(bytes.data()), static_cast<IoSize>(bytes.size()), 0);
+        if (received <= 0) {
+            return false;
+        }
+        bytes = bytes.subspan(static_cast<size_t>(received));
+    }
+    return true;
+}
+
+enum class IoStatus : std::uint8_t { Done, Pending, Failed };
+
+bool wouldBlock() noexcept {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+/// @brief Reads whatever part of a frame has arrived on a non-blocking socket
+/// @param frame Bytes received so far; Done once it holds the length prefix and the whole payload
+IoStatus receiveAvailable(NativeSocket socket, std::vector<std::uint8_t>& frame) {
+    constexpr std::size_t PREFIX_SIZE = Core::RemoteProtocol::LENGTH_PREFIX_SIZE;
+    while (true) {
+        std::size_t wanted = PREFIX_SIZE;
+        if (frame.size() >= PREFIX_SIZE) {
+            const std::span<const std::uint8_t, PREFIX_SIZE> prefix{frame.data(), PREFIX_SIZE};
+            const auto length = Core::RemoteProtocol::decodeLength(prefix);
+            if (!length) {
+                return IoStatus::Failed;
+            }
+            wanted += *length;
+            if (frame.size() == wanted) {
+                return IoStatus::Done;
+            }
+        }
+
+        // Never read past the frame, so the payload is exactly what follows the prefix
+        const std::size_t offset = frame.size();
+        frame.resize(wanted);
+        const auto received =
+            ::recv(socket, reinterpret_cast<char*>(frame.data() + offset), static_cast<IoSize>(wanted - offset), 0);
+        if (received <= 0) {
+            frame.resize(offset);
+            return received < 0 && wouldBlock() ? IoStatus::Pending : IoStatus::Failed;
+        }
+        frame.resize(offset + static_cast<size_t>(received));
+    }
+}
+
+/// @brief Writes as much of @p bytes as a non-blocking socket takes, erasing what was sent
+IoStatus sendAvailable(NativeSocket socket, std::vector<std::uint8_t>& bytes) {
+    while (!bytes.empty()) {
+        const auto sent =
+            ::send(socket, reinterpret_cast<const char*>(bytes.data()), static_cast<IoSize>(bytes.size()), SEND_FLAGS);
+        if (sent <= 0) {
+            return sent < 0 && wouldBlock() ? IoStatus::Pending : IoStatus::Failed;
+        }
+        bytes.erase(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(sent));
+    }
+    return IoStatus::Done;
+}
+
+std::optional<std::vector<std::uint8_t>> receiveFrame(NativeSocket socket) {
+    std::array<std::uint8_t, Core::RemoteProtocol::LENGTH_PREFIX_SIZE> prefix{};
+    if (!receiveExact(socket, prefix)) {
+        return std::nullopt;
+    }
+    const auto length = Core::RemoteProtocol::decodeLength(prefix);
+    if (!length) {
+        return std::nullopt;
+    }
+
+    std::vector<std::uint8_t> payload(*length);
+    if (!receiveExact(socket, payload)) {
+        return std::nullopt;
+    }
+    return payload;
+}
+} // namespace
+
+class SingleInstance::Impl {
+  public:
+    explicit Impl(const std::filesystem::path& directory) : m_socket_path(directory / SOCKET_FILENAME) {
+#ifdef _WIN32
+        WSADATA data{};
+        m_winsock_ready = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+#endif
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        acquireLock(directory / LOCK_FILENAME);
+        if (m_primary) {
+            listen();
+        }
+    }
+
+    ~Impl() {
+        if (m_listener.isValid()) {
+            m_listener.close();
+            std::error_code error;
+            std::filesystem::remove(m_socket_path, error);
+        }
+        releaseLock();
+#ifdef _WIN32
+        if (m_winsock_ready) {
+            WSACleanup();
+        }
+#endif
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+    Impl(Impl&&) = delete;
+    Impl& operator=(Impl&&) = delete;
+
+    [[nodiscard]] bool isPrimary() const noexcept {
+        return m_primary;
+    }
+
+    void processCommands(const CommandHandler& handler) {
+        if (!m_listener.isValid()) {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        while (m_clients.size() < MAX_PENDING_CLIENTS) {
+            Socket client{::accept(m_listener.get(), nullptr, nullptr)};
+            if (!client.isValid()) {
+                break; // Nothing pending
+            }
+            // Accepted sockets only inherit the listener's non-blocking mode on some platforms
+            if (setNonBlocking(client.get(), true)) {
+                m_clients.push_back(Client{std::move(client), {}, {}, now + CLIENT_TIMEOUT});
+            }
+        }
+
+        // Each client only gets the bytes already waiting, so a stalled one never holds up the loop
+        std::erase_if(m_clients, [&](Client& client) {
+            return serve(client, handler) != IoStatus::Pending || now >= client.deadline;
+        });
+    }
+
+    [[nodiscard]] std::optional<Core::RemoteReply> send(const Core::RemoteCommand& command,
+                                                        std::chrono::milliseconds timeout) const {
+        using clock = std::chrono::steady_clock;
+        const auto address = makeAddress(m_socket_path);
+        if (!address) {
+            return std::nullopt;
+        }
+
+        // The primary takes the lock before it binds the socket, so a launch racing a starting
+        // instance retries until it is listening
+        const auto deadline = clock::now() + timeout;
+        Socket connection;
+        while (true) {
+            connection = createSocket();
+            if (connection.isValid() && ::connect(connection.get(), reinterpret_cast<const sockaddr*>(&*address),
+                                                  sizeof(*address)) == 0) {
+                break;
+            }
+            if (clock::now() + CONNECT_RETRY_INTERVAL >= deadline) {
+                return std::nullopt;
+            }
+            std::this_thread::sleep_for(CONNECT_RETRY_INTERVAL);
+        }
+
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock::now());
+        setTimeouts(connection.get(), std::max(remaining, std::chrono::milliseconds{1}));
+        if (!sendAll(connection.get(), Core::RemoteProtocol::encode(command))) {
+            return std::nullopt;
+        }
+
+        const auto payload = receiveFrame(connection.get());
+        return payload ? Core::RemoteProtocol::decodeReply(*payload) : std::nullopt;
+    }
+
+  private:
+    /// @brief A connected launch whose command or reply is still in flight
+    struct Client {
+        Socket socket;
+        std::vector<std::uint8_t> received;
+        std::vector<std::uint8_t> reply; ///< Encoded reply not yet sent
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    static IoStatus serve(Client& client, const CommandHandler& handler) {
+        if (client.reply.empty()) {
+            const IoStatus status = receiveAvailable(client.socket.get(), client.received);
+            if (status != IoStatus::Done) {
+                return status;
+            }
+            const auto payload = std::span{client.received}.subspan(Core::RemoteProtocol::LENGTH_PREFIX_SIZE);
+            const auto command = Core::RemoteProtocol::decodeCommand(payload);
+            const Core::RemoteReply reply =
+                command ? handler(*command) : Core::RemoteReply{false, "Unrecognized command"};
+            client.reply = Core::RemoteProtocol::encode(reply);
+        }
+        return sendAvailable(client.socket.get(), client.reply);
+    }
+
+    void acquireLock(const std::filesystem::path& path) {
+        // If the lock can't be taken for any reason other than another instance holding it,
+        // run unguarded rather than refuse to start
+#ifdef _WIN32
+        // Opening without sharing is the lock: it fails while another process has the file open
+        m_lock_file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        m_primary = m_lock_file != INVALID_HANDLE_VALUE || GetLastError() != ERROR_SHARING_VIOLATION;
+#else
+        m_lock_file = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        m_primary = m_lock_file < 0 || flock(m_lock_file, LOCK_EX | LOCK_NB) == 0 || errno != EWOULDBLOCK;
+#endif
+    }
+
+    void releaseLock() noexcept {
+#ifdef _WIN32
+        if (m_lock_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_lock_file);
+        }
+#else
+        if (m_lock_file >= 0) {
+            ::close(m_lock_file);
+        }
+#endif
+    }
+
+    void listen() {
+        const auto address = makeAddress(m_socket_path);
+        if (!address) {
+            std::cerr << "Warning: Single-instance socket path is too long: " << m_socket_path << '\n';
+            return;
+        }
+
+        // Holding the lock proves nobody listens on a socket file left behind by a crashed instance
+        std::error_code error;
+        std::filesystem::remove(m_socket_path, error);
+
+        Socket listener = createSocket();
+        if (!listener.isValid() ||
+            ::bind(listener.get(), reinterpret_cast<const sockaddr*>(&*address), sizeof(*address)) != 0 ||
+            ::listen(listener.get(), LISTEN_BACKLOG) != 0 || !setNonBlocking(listener.get(), true)) {
+            std::cerr << "Warning: Failed to listen for other instances on " << m_socket_path << '\n';
+            return;
+        }
+#ifndef _WIN32
+        // Only the owning user may control the running instance
+        chmod(m_socket_path.c_str(), S_IRUSR | S_IWUSR);
+#endif
+        m_listener = std::move(listener);
+    }
+
+    std::filesystem::path m_socket_path;
+    Socket m_listener;
+    std::vector<Client> m_clients;
+    bool m_primary = true;
+#ifdef _WIN32
+    HANDLE m_lock_file = INVALID_HANDLE_VALUE;
+    bool m_winsock_ready = false;
+#else
+    int m_lock_file = -1;
+#endif
+};
+
+SingleInstance::SingleInstance(const std::filesystem::path& directory)
+    : m_impl(std::make_unique<Impl>(directory)) {
+}
+
+SingleInstance::~SingleInstance() = default;
+SingleInstance::SingleInstance(SingleInstance&&) noexcept = default;
+SingleInstance& SingleInstance::operator=(SingleInstance&&) noexcept = default;
+
+bool SingleInstance::isPrimary() const noexcept {
+    return m_impl->isPrimary();
+}
+
+void SingleInstance::processCommands(const CommandHandler& handler) {
+    m_impl->processCommands(handler);
+}
+
+std::optional<Core::RemoteReply> SingleInstance::send(const Core::RemoteCommand& command,
+                                                      std::chrono::milliseconds timeout) const {
+    return m_impl->send(command, timeout);
+}
+
+} // namespace WorkBalance::System
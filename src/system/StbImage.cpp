@@ -1,3 +0,0 @@
-#define STB_IMAGE_IMPLEMENTATION
-#define STBI_ONLY_PNG
-#include "assets/icons/stb_image.h"
@@ -6,11 +6,12 @@
 #include <Windows.h>
 #include <shellapi.h>
 
-#include "assets/embedded_resources.h"
-#include "assets/icons/stb_image.h"
+#include <core/IconSet.h>
+#include <system/EmbeddedResources.h>
 #endif
 
 #include <array>
+#include <cstdint>
 #include <cstring>
 
 namespace WorkBalance::System {
@@ -144,20 +145,13 @@ class SystemTray::Impl {
     }
 
     static HICON loadIconFromEmbeddedResource() {
-        int width = 0;
-        int height = 0;
-        int channels = 0;
-
-        unsigned char* pixels = stbi_load_from_memory(app_icon_png_data, static_cast<int>(app_icon_png_data_size),
-                                                      &width, &height, &channels, 4);
-        if (pixels == nullptr) {
+        const Core::IconSet icon_set(getEmbeddedResources().get(Resources::APP_ICON));
+        const Core::IconImage* image = icon_set.select(GetSystemMetrics(SM_CXSMICON));
+        if (image == nullptr) {
             return LoadIconW(nullptr, MAKEINTRESOURCEW(32512)); // IDI_APPLICATION
         }
-
-        // Convert RGBA to BGRA for Windows
-        for (int i = 0; i < width * height; ++i) {
-            std::swap(pixels[i * 4 + 0], pixels[i * 4 + 2]);
-        }
+        const int width = image->width;
+        const int height = image->height;
 
         HICON icon = nullptr;
         ICONINFO icon_info{};
@@ -176,7 +170,15 @@ class SystemTray::Impl {
         void* bits = nullptr;
         HBITMAP color_bitmap = CreateDIBSection(hdc, &bmi, DIB_RGB_COLORS, &bits, nullptr, 0);
         if (color_bitmap != nullptr && bits != nullptr) {
-            memcpy(bits, pixels, static_cast<size_t>(width * height * 4));
+            // Convert RGBA to BGRA for Windows while copying into the DIB
+            auto* destination = static_cast<std::uint8_t*>(bits);
+            const auto& pixels = image->pixels;
+            for (size_t i = 0; i < pixels.size(); i += 4) {
+                destination[i + 0] = pixels[i + 2];
+                destination[i + 1] = pixels[i + 1];
+                destination[i + 2] = pixels[i + 0];
+                destination[i + 3] = pixels[i + 3];
+            }
 
             // Create mask bitmap
             HBITMAP mask_bitmap = CreateBitmap(width, height, 1, 1, nullptr);
@@ -189,7 +191,6 @@ class SystemTray::Impl {
             DeleteObject(color_bitmap);
         }
         ReleaseDC(nullptr, hdc);
-        stbi_image_free(pixels);
 
         return icon != nullptr ? icon : LoadIconW(nullptr, MAKEINTRESOURCEW(32512)); // IDI_APPLICATION
     }
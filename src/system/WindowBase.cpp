@@ -1,9 +1,27 @@
 #include <system/WindowBase.h>
 
+#include <core/Trace.h>
+
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace WorkBalance::System {
+namespace {
+// The GLFW user pointer belongs to the application, so callbacks find their window here.
+// Only touched on the main thread, like every other GLFW window call.
+std::vector<WindowBase*>& trackedWindows() {
+    static std::vector<WindowBase*> windows;
+    return windows;
+}
+
+// Re-tracking the same window must not make a callback call itself
+template <typename Callback> [[nodiscard]] Callback chained(Callback previous, Callback own) noexcept {
+    return previous == own ? nullptr : previous;
+}
+} // namespace
 
 GLFWManager::GLFWManager() {
     glfwSetErrorCallback(
@@ -19,6 +37,7 @@ GLFWManager::~GLFWManager() {
 }
 
 WindowBase::~WindowBase() {
+    std::erase(trackedWindows(), this);
     if (m_window != nullptr) {
         glfwDestroyWindow(m_window);
         m_window = nullptr;
@@ -35,39 +54,184 @@ bool WindowBase::shouldClose() const noexcept {
 
 void WindowBase::swapBuffers() const noexcept {
     if (m_window != nullptr) {
+        const Core::TraceZone zone{"WindowBase::swapBuffers"};
         glfwSwapBuffers(m_window);
     }
 }
 
 std::pair<int, int> WindowBase::getFramebufferSize() const noexcept {
     if (m_window != nullptr) {
-        int width = 0;
-        int height = 0;
-        glfwGetFramebufferSize(m_window, &width, &height);
-        return {width, height};
+        return {m_geometry.framebuffer_width, m_geometry.framebuffer_height};
     }
     return {0, 0};
 }
 
 std::pair<int, int> WindowBase::getPosition() const noexcept {
     if (m_window != nullptr) {
-        int x = 0;
-        int y = 0;
-        glfwGetWindowPos(m_window, &x, &y);
-        return {x, y};
+        return {m_geometry.x, m_geometry.y};
+    }
+    return {0, 0};
+}
+
+std::pair<int, int> WindowBase::getSize() const noexcept {
+    if (m_window != nullptr) {
+        return {m_geometry.width, m_geometry.height};
     }
     return {0, 0};
 }
 
+std::pair<double, double> WindowBase::getCursorScreenPosition() const noexcept {
+    return m_geometry.cursorScreenPosition();
+}
+
 void WindowBase::setPosition(int x, int y) noexcept {
     if (m_window != nullptr) {
         glfwSetWindowPos(m_window, x, y);
+        // Later cursor events are relative to the moved window, so a drag must not see the old origin
+        m_geometry.moveTo(x, y);
     }
 }
 
 void WindowBase::setSize(int width, int height) noexcept {
     if (m_window != nullptr) {
         glfwSetWindowSize(m_window, width, height);
+        m_geometry.width = width;
+        m_geometry.height = height;
+    }
+}
+
+void WindowBase::show() noexcept {
+    if (m_window != nullptr) {
+        glfwShowWindow(m_window);
+        m_geometry.visible = true;
+    }
+}
+
+void WindowBase::hide() noexcept {
+    if (m_window != nullptr) {
+        glfwHideWindow(m_window);
+        m_geometry.visible = false;
+    }
+}
+
+void WindowBase::trackGeometry() {
+    if (m_window == nullptr) {
+        return;
+    }
+    if (std::ranges::find(trackedWindows(), this) == trackedWindows().end()) {
+        trackedWindows().push_back(this);
+    }
+
+    m_previous.position = chained(glfwSetWindowPosCallback(m_window, onPosition), &onPosition);
+    m_previous.size = chained(glfwSetWindowSizeCallback(m_window, onSize), &onSize);
+    m_previous.framebuffer = chained(glfwSetFramebufferSizeCallback(m_window, onFramebufferSize), &onFramebufferSize);
+    m_previous.cursor = chained(glfwSetCursorPosCallback(m_window, onCursorPosition), &onCursorPosition);
+    m_previous.cursor_enter = chained(glfwSetCursorEnterCallback(m_window, onCursorEnter), &onCursorEnter);
+    m_previous.focus = chained(glfwSetWindowFocusCallback(m_window, onFocus), &onFocus);
+    m_previous.iconify = chained(glfwSetWindowIconifyCallback(m_window, onIconify), &onIconify);
+    m_previous.content_scale = chained(glfwSetWindowContentScaleCallback(m_window, onContentScale), &onContentScale);
+
+    glfwGetWindowPos(m_window, &m_geometry.x, &m_geometry.y);
+    glfwGetWindowSize(m_window, &m_geometry.width, &m_geometry.height);
+    glfwGetFramebufferSize(m_window, &m_geometry.framebuffer_width, &m_geometry.framebuffer_height);
+    glfwGetCursorPos(m_window, &m_geometry.cursor_x, &m_geometry.cursor_y);
+    float scale_y = 1.0f;
+    glfwGetWindowContentScale(m_window, &m_geometry.content_scale, &scale_y);
+    m_geometry.visible = glfwGetWindowAttrib(m_window, GLFW_VISIBLE) == GLFW_TRUE;
+    m_geometry.focused = glfwGetWindowAttrib(m_window, GLFW_FOCUSED) == GLFW_TRUE;
+    m_geometry.iconified = glfwGetWindowAttrib(m_window, GLFW_ICONIFIED) == GLFW_TRUE;
+    m_geometry.hovered = glfwGetWindowAttrib(m_window, GLFW_HOVERED) == GLFW_TRUE;
+}
+
+void WindowBase::takeWindow(WindowBase& other) {
+    m_window = std::exchange(other.m_window, nullptr);
+    m_geometry = other.m_geometry;
+    m_previous = std::exchange(other.m_previous, PreviousCallbacks{});
+    std::erase(trackedWindows(), &other);
+    if (m_window != nullptr && std::ranges::find(trackedWindows(), this) == trackedWindows().end()) {
+        trackedWindows().push_back(this);
+    }
+}
+
+WindowBase* WindowBase::find(GLFWwindow* window) noexcept {
+    const auto& windows = trackedWindows();
+    const auto it = std::ranges::find(windows, window, &WindowBase::m_window);
+    return it != windows.end() ? *it : nullptr;
+}
+
+void WindowBase::onPosition(GLFWwindow* window, int x, int y) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.x = x;
+        self->m_geometry.y = y;
+        if (self->m_previous.position != nullptr) {
+            self->m_previous.position(window, x, y);
+        }
+    }
+}
+
+void WindowBase::onSize(GLFWwindow* window, int width, int height) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.width = width;
+        self->m_geometry.height = height;
+        if (self->m_previous.size != nullptr) {
+            self->m_previous.size(window, width, height);
+        }
+    }
+}
+
+void WindowBase::onFramebufferSize(GLFWwindow* window, int width, int height) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.framebuffer_width = width;
+        self->m_geometry.framebuffer_height = height;
+        if (self->m_previous.framebuffer != nullptr) {
+            self->m_previous.framebuffer(window, width, height);
+        }
+    }
+}
+
+void WindowBase::onCursorPosition(GLFWwindow* window, double x, double y) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.cursor_x = x;
+        self->m_geometry.cursor_y = y;
+        if (self->m_previous.cursor != nullptr) {
+            self->m_previous.cursor(window, x, y);
+        }
+    }
+}
+
+void WindowBase::onCursorEnter(GLFWwindow* window, int entered) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.hovered = entered == GLFW_TRUE;
+        if (self->m_previous.cursor_enter != nullptr) {
+            self->m_previous.cursor_enter(window, entered);
+        }
+    }
+}
+
+void WindowBase::onFocus(GLFWwindow* window, int focused) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.focused = focused == GLFW_TRUE;
+        if (self->m_previous.focus != nullptr) {
+            self->m_previous.focus(window, focused);
+        }
+    }
+}
+
+void WindowBase::onIconify(GLFWwindow* window, int iconified) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.iconified = iconified == GLFW_TRUE;
+        if (self->m_previous.iconify != nullptr) {
+            self->m_previous.iconify(window, iconified);
+        }
+    }
+}
+
+void WindowBase::onContentScale(GLFWwindow* window, float scale_x, float scale_y) {
+    if (WindowBase* self = find(window); self != nullptr) {
+        self->m_geometry.content_scale = scale_x;
+        if (self->m_previous.content_scale != nullptr) {
+            self->m_previous.content_scale(window, scale_x, scale_y);
+        }
     }
 }
 
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include "app/AllocationCounter.h"
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+using namespace WorkBalance::App;
+
+TEST(AllocationCounterTest, CountsEveryOperatorNew) {
+    const std::uint64_t before = AllocationCounter::allocations();
+    auto single = std::make_unique<int>(1);
+    auto array = std::make_unique<int[]>(4);
+    EXPECT_EQ(AllocationCounter::allocations() - before, 2U);
+}
+
+TEST(AllocationCounterTest, CountsOverAlignedAllocations) {
+    struct alignas(64) CacheLine {
+        char bytes[64];
+    };
+    const std::uint64_t before = AllocationCounter::allocations();
+    auto line = std::make_unique<CacheLine>();
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(line.get()) % 64, 0U);
+    EXPECT_EQ(AllocationCounter::allocations() - before, 1U);
+}
+
+TEST(AllocationCounterTest, ReservedVectorDoesNotAllocateAgain) {
+    std::vector<int> values;
+    values.reserve(16);
+    const std::uint64_t before = AllocationCounter::allocations();
+    for (int i = 0; i < 16; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(AllocationCounter::allocations(), before);
+}
+
+TEST(AllocationCounterTest, NothrowNewReturnsUsableMemory) {
+    const std::uint64_t before = AllocationCounter::allocations();
+    int* value = new (std::nothrow) int{7};
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 7);
+    delete value;
+    EXPECT_EQ(AllocationCounter::allocations() - before, 1U);
+}
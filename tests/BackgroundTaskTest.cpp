@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "app/BackgroundTask.h"
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace WorkBalance::App;
+
+TEST(BackgroundTaskTest, ReturnsResultOfJob) {
+    BackgroundTask<int> task([] { return 42; });
+    EXPECT_EQ(task.get(), 42);
+}
+
+TEST(BackgroundTaskTest, RunsOffTheCallingThread) {
+    BackgroundTask<std::thread::id> task([] { return std::this_thread::get_id(); });
+    EXPECT_NE(task.get(), std::this_thread::get_id());
+}
+
+TEST(BackgroundTaskTest, RunsWhileCallerContinues) {
+    std::promise<void> release;
+    auto released = release.get_future();
+    BackgroundTask<bool> task([&released] {
+        return released.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    });
+
+    // The job can only finish successfully if it started before get() was called
+    release.set_value();
+    EXPECT_TRUE(task.get());
+}
+
+TEST(BackgroundTaskTest, MovesMoveOnlyResults) {
+    BackgroundTask<std::unique_ptr<int>> task([] { return std::make_unique<int>(7); });
+    const auto value = task.get();
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 7);
+}
+
+TEST(BackgroundTaskTest, RethrowsJobExceptionsFromGet) {
+    BackgroundTask<int> task([]() -> int { throw std::runtime_error("job failed"); });
+    EXPECT_THROW(static_cast<void>(task.get()), std::runtime_error);
+}
+
+TEST(BackgroundTaskTest, RecordsDurationOnceJoined) {
+    BackgroundTask<int> task([] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return 1;
+    });
+    EXPECT_FALSE(task.durationMs().has_value());
+
+    ASSERT_EQ(task.get(), 1);
+    ASSERT_TRUE(task.durationMs().has_value());
+    EXPECT_GE(*task.durationMs(), 19.0);
+}
@@ -0,0 +1,320 @@
+#include <gtest/gtest.h>
+#include "system/DBusNotificationService.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dbus/dbus.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+using namespace WorkBalance;
+using namespace std::chrono_literals;
+using System::DBusNotificationService;
+
+namespace {
+/// @brief What the fake daemon read from one Notify call
+struct ReceivedNotification {
+    std::string app_name;
+    std::uint32_t replaces_id = 0;
+    std::string summary;
+    std::string body;
+    std::uint8_t urgency = 0;
+    std::int32_t expire_timeout = 0;
+};
+
+struct ConnectionDeleter {
+    void operator()(DBusConnection* connection) const noexcept {
+        dbus_connection_close(connection);
+        dbus_connection_unref(connection);
+    }
+};
+
+struct MessageDeleter {
+    void operator()(DBusMessage* message) const noexcept {
+        dbus_message_unref(message);
+    }
+};
+using MessagePtr = std::unique_ptr<DBusMessage, MessageDeleter>;
+
+/// @brief Reads the basic value under @p iter if it has @p type, then steps past it
+template <typename T> bool readBasic(DBusMessageIter& iter, int type, T& value) {
+    if (dbus_message_iter_get_arg_type(&iter) != type) {
+        return false;
+    }
+    dbus_message_iter_get_basic(&iter, &value);
+    dbus_message_iter_next(&iter);
+    return true;
+}
+
+bool readString(DBusMessageIter& iter, std::string& value) {
+    const char* text = nullptr;
+    if (!readBasic(iter, DBUS_TYPE_STRING, text)) {
+        return false;
+    }
+    value = text;
+    return true;
+}
+
+std::optional<ReceivedNotification> parseNotify(DBusMessage* call) {
+    const std::string interface(DBusNotificationService::INTERFACE_NAME);
+    if (dbus_message_is_method_call(call, interface.c_str(), "Notify") == 0 ||
+        dbus_message_has_signature(call, "susssasa{sv}i") == 0) {
+        return std::nullopt;
+    }
+    DBusMessageIter args;
+    dbus_message_iter_init(call, &args);
+    ReceivedNotification notification;
+    std::string icon;
+    dbus_uint32_t replaces_id = 0;
+    if (!readString(args, notification.app_name) || !readBasic(args, DBUS_TYPE_UINT32, replaces_id) ||
+        !readString(args, icon) || !readString(args, notification.summary) || !readString(args, notification.body)) {
+        return std::nullopt;
+    }
+    notification.replaces_id = replaces_id;
+    dbus_message_iter_next(&args); // actions
+
+    DBusMessageIter hints;
+    dbus_message_iter_recurse(&args, &hints);
+    while (dbus_message_iter_get_arg_type(&hints) == DBUS_TYPE_DICT_ENTRY) {
+        DBusMessageIter entry;
+        dbus_message_iter_recurse(&hints, &entry);
+        std::string key;
+        if (readString(entry, key) && key == "urgency") {
+            DBusMessageIter variant;
+            dbus_message_iter_recurse(&entry, &variant);
+            unsigned char urgency = 0;
+            if (!readBasic(variant, DBUS_TYPE_BYTE, urgency)) {
+                return std::nullopt;
+            }
+            notification.urgency = urgency;
+        }
+        dbus_message_iter_next(&hints);
+    }
+    dbus_message_iter_next(&args);
+
+    dbus_int32_t expire_timeout = 0;
+    if (!readBasic(args, DBUS_TYPE_INT32, expire_timeout)) {
+        return std::nullopt;
+    }
+    notification.expire_timeout = expire_timeout;
+    return notification;
+}
+
+/// @brief Owns org.freedesktop.Notifications on a test bus and records what it is sent
+///
+/// Answers each Notify with the replaces_id, or the next fresh id, like a real daemon; with
+/// @p answer false it never replies, like a hung one.
+class FakeNotificationDaemon {
+  public:
+    FakeNotificationDaemon(const std::string& address, bool answer) : m_answer(answer) {
+        dbus_threads_init_default();
+        std::promise<bool> registered;
+        auto ready = registered.get_future();
+        m_thread = std::jthread(
+            [this, address, registered = std::move(registered)](const std::stop_token& stop) mutable {
+                const std::unique_ptr<DBusConnection, ConnectionDeleter> connection{
+                    dbus_connection_open_private(address.c_str(), nullptr)};
+                const std::string service(DBusNotificationService::SERVICE_NAME);
+                const bool owned = connection && dbus_bus_register(connection.get(), nullptr) != 0 &&
+                                   dbus_bus_request_name(connection.get(), service.c_str(),
+                                                         DBUS_NAME_FLAG_DO_NOT_QUEUE, nullptr) ==
+                                       DBUS_REQUEST_NAME_REPLY_PRIMARY_OWNER;
+                registered.set_value(owned);
+                if (owned) {
+                    dbus_connection_set_exit_on_disconnect(connection.get(), FALSE);
+                    serve(connection.get(), stop);
+                }
+            });
+        m_registered = ready.get();
+    }
+
+    [[nodiscard]] bool isRegistered() const noexcept {
+        return m_registered;
+    }
+
+    /// @brief Waits until at least @p count notifications arrived
+    [[nodiscard]] bool waitFor(std::size_t count, std::chrono::milliseconds timeout = 5s) {
+        std::unique_lock lock(m_mutex);
+        return m_received.wait_for(lock, timeout, [&] { return m_notifications.size() >= count; });
+    }
+
+    [[nodiscard]] std::vector<ReceivedNotification> notifications() {
+        const std::lock_guard lock(m_mutex);
+        return m_notifications;
+    }
+
+  private:
+    void serve(DBusConnection* connection, const std::stop_token& stop) {
+        constexpr int POLL_MS = 20;
+        while (!stop.stop_requested() && dbus_connection_read_write(connection, POLL_MS) != 0) {
+            while (const MessagePtr call{dbus_connection_pop_message(connection)}) {
+                if (dbus_message_get_type(call.get()) == DBUS_MESSAGE_TYPE_METHOD_CALL) {
+                    handle(connection, call.get());
+                }
+            }
+        }
+    }
+
+    void handle(DBusConnection* connection, DBusMessage* call) {
+        const auto notification = parseNotify(call);
+        if (!notification) {
+            const MessagePtr error{dbus_message_new_error(call, DBUS_ERROR_UNKNOWN_METHOD, "Only Notify is served")};
+            (void)dbus_connection_send(connection, error.get(), nullptr);
+            return;
+        }
+        {
+            const std::lock_guard lock(m_mutex);
+            m_notifications.push_back(*notification);
+        }
+        m_received.notify_all();
+        if (m_answer) {
+            const MessagePtr reply{dbus_message_new_method_return(call)};
+            const dbus_uint32_t id = notification->replaces_id != 0 ? notification->replaces_id : m_next_id++;
+            (void)dbus_message_append_args(reply.get(), DBUS_TYPE_UINT32, &id, DBUS_TYPE_INVALID);
+            (void)dbus_connection_send(connection, reply.get(), nullptr);
+        }
+    }
+
+    bool m_answer;
+    bool m_registered = false;
+    std::uint32_t m_next_id = 1;
+    std::mutex m_mutex;
+    std::condition_variable m_received;
+    std::vector<ReceivedNotification> m_notifications;
+    std::jthread m_thread;
+};
+} // namespace
+
+/// Runs a private dbus-daemon for each test, so nothing reaches the desktop's real session bus
+class DBusNotificationServiceTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        int output[2] = {-1, -1};
+        ASSERT_EQ(pipe(output), 0);
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, output[1], STDOUT_FILENO);
+        posix_spawn_file_actions_addclose(&actions, output[0]);
+        posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+        char* argv[] = {const_cast<char*>("dbus-daemon"), const_cast<char*>("--session"),
+                        const_cast<char*>("--nofork"), const_cast<char*>("--print-address"), nullptr};
+        const int spawned = posix_spawnp(&m_daemon, "dbus-daemon", &actions, nullptr, argv, environ);
+        posix_spawn_file_actions_destroy(&actions);
+        close(output[1]);
+        if (spawned != 0) {
+            close(output[0]);
+            m_daemon = -1;
+            GTEST_SKIP() << "dbus-daemon is not installed";
+        }
+
+        // The daemon prints its address once it is listening
+        pollfd readable{output[0], POLLIN, 0};
+        char buffer[512] = {};
+        std::size_t length = 0;
+        while (length < sizeof(buffer) - 1 && poll(&readable, 1, 5000) > 0) {
+            const auto count = read(output[0], buffer + length, 1);
+            if (count <= 0 || buffer[length] == '\n') {
+                break;
+            }
+            length += static_cast<std::size_t>(count);
+        }
+        close(output[0]);
+        m_address.assign(buffer, length);
+        ASSERT_FALSE(m_address.empty()) << "dbus-daemon did not print its address";
+    }
+
+    void TearDown() override {
+        if (m_daemon > 0) {
+            kill(m_daemon, SIGTERM);
+            waitpid(m_daemon, nullptr, 0);
+        }
+    }
+
+    std::string m_address;
+    pid_t m_daemon = -1;
+};
+
+TEST_F(DBusNotificationServiceTest, DeliversNotificationsToTheDaemon) {
+    FakeNotificationDaemon daemon(m_address, true);
+    ASSERT_TRUE(daemon.isRegistered());
+    DBusNotificationService service(m_address);
+    ASSERT_TRUE(service.initialize());
+
+    service.showNotification("Stay Hydrated!", "Time to drink some water.");
+
+    ASSERT_TRUE(daemon.waitFor(1));
+    const ReceivedNotification notification = daemon.notifications().front();
+    EXPECT_EQ(notification.app_name, "WorkBalance");
+    EXPECT_EQ(notification.replaces_id, 0u);
+    EXPECT_EQ(notification.summary, "Stay Hydrated!");
+    EXPECT_EQ(notification.body, "Time to drink some water.");
+    EXPECT_EQ(notification.urgency, 1);
+    EXPECT_EQ(notification.expire_timeout, -1);
+}
+
+TEST_F(DBusNotificationServiceTest, RepeatedRemindersReplaceTheirPreviousNotification) {
+    FakeNotificationDaemon daemon(m_address, true);
+    ASSERT_TRUE(daemon.isRegistered());
+    DBusNotificationService service(m_address);
+    ASSERT_TRUE(service.initialize());
+
+    service.showWaterReminder();
+    service.showEyeCareReminder();
+    service.showWaterReminder();
+
+    ASSERT_TRUE(daemon.waitFor(3));
+    const auto notifications = daemon.notifications();
+    EXPECT_EQ(notifications[0].replaces_id, 0u);
+    EXPECT_EQ(notifications[1].replaces_id, 0u);
+    // The first water reminder was given id 1
+    EXPECT_EQ(notifications[2].replaces_id, 1u);
+    EXPECT_EQ(notifications[2].summary, notifications[0].summary);
+}
+
+TEST_F(DBusNotificationServiceTest, HungDaemonDoesNotBlockTheCaller) {
+    FakeNotificationDaemon daemon(m_address, false);
+    ASSERT_TRUE(daemon.isRegistered());
+    constexpr auto call_timeout = 1s;
+    DBusNotificationService service(m_address, call_timeout);
+    ASSERT_TRUE(service.initialize());
+
+    // The worker is now waiting for an answer that never comes
+    service.showStandupReminder();
+    ASSERT_TRUE(daemon.waitFor(1));
+
+    constexpr std::size_t extra = 4;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < DBusNotificationService::QUEUE_CAPACITY + extra; ++i) {
+        service.showStandupReminder();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(elapsed, call_timeout);
+    EXPECT_EQ(service.droppedCount(), extra);
+}
+
+TEST_F(DBusNotificationServiceTest, UnreachableBusDropsNotificationsQuietly) {
+    DBusNotificationService service("unix:path=/nonexistent/workbalance-test-bus");
+    ASSERT_TRUE(service.initialize());
+
+    service.showPomodoroComplete();
+    service.showShortBreakComplete();
+
+    EXPECT_TRUE(service.isSupported());
+    EXPECT_EQ(service.droppedCount(), 0u);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "core/DisplayLayout.h"
+
+#include <limits>
+
+using namespace WorkBalance::Core;
+
+TEST(DisplayLayoutTest, QuantizeRoundsToNearestStep) {
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(1.0f), 1.0f);
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(1.1f), 1.0f);
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(1.24f), 1.25f);
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(1.5f), 1.5f);
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(1.9f), 2.0f);
+}
+
+TEST(DisplayLayoutTest, QuantizeClampsAndRejectsBadScales) {
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(0.1f), DisplayLayout::MIN_UI_SCALE);
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(12.0f), DisplayLayout::MAX_UI_SCALE);
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(DisplayLayout::quantizeScale(std::numeric_limits<float>::quiet_NaN()), 1.0f);
+}
+
+TEST(DisplayLayoutTest, UiScaleIsContentScaleWhenCoordinatesArePixels) {
+    // Windows and X11: a 150% monitor, framebuffer and window sizes match
+    EXPECT_FLOAT_EQ(DisplayLayout::uiScale(1.5f, 750, 750), 1.5f);
+}
+
+TEST(DisplayLayoutTest, UiScaleIsOneWhenPlatformScalesCoordinates) {
+    // macOS and Wayland: two pixels behind each screen coordinate on a 200% monitor
+    EXPECT_FLOAT_EQ(DisplayLayout::uiScale(2.0f, 500, 1000), 1.0f);
+}
+
+TEST(DisplayLayoutTest, UiScaleFallsBackToContentScaleWithoutSizes) {
+    EXPECT_FLOAT_EQ(DisplayLayout::uiScale(1.25f, 0, 0), 1.25f);
+    EXPECT_FLOAT_EQ(DisplayLayout::uiScale(2.0f, 500, 0), 2.0f);
+}
+
+TEST(DisplayLayoutTest, ScaleLengthRounds) {
+    EXPECT_EQ(DisplayLayout::scaleLength(500, 1.0f), 500);
+    EXPECT_EQ(DisplayLayout::scaleLength(500, 1.25f), 625);
+    EXPECT_EQ(DisplayLayout::scaleLength(7, 1.5f), 11);
+}
+
+TEST(DisplayLayoutTest, CenteredInWorkArea) {
+    const ScreenRect work_area{1920, 0, 1920, 1040};
+
+    const ScreenRect rect = DisplayLayout::centeredIn(work_area, 500, 900);
+
+    EXPECT_EQ(rect.x, 1920 + 710);
+    EXPECT_EQ(rect.y, 70);
+    EXPECT_EQ(rect.width, 500);
+    EXPECT_EQ(rect.height, 900);
+}
+
+TEST(DisplayLayoutTest, TopCenteredInWorkArea) {
+    const ScreenRect work_area{0, 40, 1920, 1040};
+
+    const ScreenRect rect = DisplayLayout::topCenteredIn(work_area, 620, 70, 10);
+
+    EXPECT_EQ(rect.x, 650);
+    EXPECT_EQ(rect.y, 50);
+}
+
+TEST(DisplayLayoutTest, NormalHeightLeavesScaledMargins) {
+    const ScreenRect work_area{0, 0, 2560, 1400};
+
+    EXPECT_EQ(DisplayLayout::normalWindowHeight(work_area, 1.0f, 900), 1400 - 40);
+    EXPECT_EQ(DisplayLayout::normalWindowHeight(work_area, 2.0f, 900), 1400 - 80);
+}
+
+TEST(DisplayLayoutTest, NormalHeightUsesFallbackWithoutWorkArea) {
+    EXPECT_EQ(DisplayLayout::normalWindowHeight(ScreenRect{}, 1.0f, 900), 900);
+}
+
+TEST(DisplayLayoutTest, RectContainsIsHalfOpen) {
+    const ScreenRect rect{0, 0, 100, 50};
+
+    EXPECT_TRUE(rect.contains(0, 0));
+    EXPECT_TRUE(rect.contains(99, 49));
+    EXPECT_FALSE(rect.contains(100, 10));
+    EXPECT_FALSE(rect.contains(10, -1));
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "app/EventBus.h"
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace WorkBalance::App;
+using WorkBalance::Core::TimerMode;
+using WorkBalance::Core::WellnessType;
+
+namespace {
+std::atomic<int> g_wake_count{0};
+
+void countWake() {
+    g_wake_count.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace
+
+TEST(EventBusTest, DispatchEmitsMatchingEvents) {
+    EventBus bus;
+    ApplicationEvents events;
+    std::vector<TimerMode> timer_modes;
+    std::vector<WellnessType> wellness_types;
+    int tasks_changed = 0;
+    int close_requests = 0;
+    [[maybe_unused]] const auto timer_id =
+        events.onTimerComplete.subscribe([&](TimerMode mode) { timer_modes.push_back(mode); });
+    [[maybe_unused]] const auto wellness_id =
+        events.onWellnessTimerComplete.subscribe([&](WellnessType type) { wellness_types.push_back(type); });
+    [[maybe_unused]] const auto tasks_id = events.onTasksChanged.subscribe([&] { ++tasks_changed; });
+    [[maybe_unused]] const auto close_id = events.onCloseRequested.subscribe([&] { ++close_requests; });
+
+    EXPECT_TRUE(bus.post(TimerCompletedMessage{TimerMode::ShortBreak}));
+    EXPECT_TRUE(bus.post(WellnessTimerCompletedMessage{WellnessType::Water}));
+    EXPECT_TRUE(bus.post(TasksChangedMessage{}));
+    EXPECT_TRUE(bus.post(CloseRequestedMessage{}));
+    EXPECT_TRUE(bus.hasPending());
+
+    EXPECT_EQ(bus.dispatch(events), 4U);
+
+    EXPECT_EQ(timer_modes, std::vector<TimerMode>{TimerMode::ShortBreak});
+    EXPECT_EQ(wellness_types, std::vector<WellnessType>{WellnessType::Water});
+    EXPECT_EQ(tasks_changed, 1);
+    EXPECT_EQ(close_requests, 1);
+    EXPECT_FALSE(bus.hasPending());
+}
+
+TEST(EventBusTest, NothingIsEmittedBeforeDispatch) {
+    EventBus bus;
+    ApplicationEvents events;
+    int tasks_changed = 0;
+    [[maybe_unused]] const auto id = events.onTasksChanged.subscribe([&] { ++tasks_changed; });
+
+    EXPECT_TRUE(bus.post(TasksChangedMessage{}));
+    EXPECT_EQ(tasks_changed, 0);
+
+    bus.dispatch(events);
+    EXPECT_EQ(tasks_changed, 1);
+}
+
+TEST(EventBusTest, PostCallsWakeCallback) {
+    EventBus bus;
+    g_wake_count = 0;
+    bus.setWakeCallback(countWake);
+
+    EXPECT_TRUE(bus.post(TasksChangedMessage{}));
+    EXPECT_TRUE(bus.post(TasksChangedMessage{}));
+
+    EXPECT_EQ(g_wake_count.load(), 2);
+}
+
+TEST(EventBusTest, DropsMessagesWhenFull) {
+    EventBus bus;
+    ApplicationEvents events;
+    for (std::size_t i = 0; i < EventBus::CAPACITY; ++i) {
+        ASSERT_TRUE(bus.post(TasksChangedMessage{}));
+    }
+    EXPECT_FALSE(bus.post(TasksChangedMessage{}));
+
+    EXPECT_EQ(bus.dispatch(events), EventBus::CAPACITY);
+    EXPECT_TRUE(bus.post(TasksChangedMessage{}));
+}
+
+TEST(EventBusTest, DispatchIsBoundedWhenHandlersRepost) {
+    EventBus bus;
+    ApplicationEvents events;
+    int tasks_changed = 0;
+    // A handler that keeps reposting must not keep dispatch() from returning
+    [[maybe_unused]] const auto id = events.onTasksChanged.subscribe([&] {
+        ++tasks_changed;
+        (void)bus.post(TasksChangedMessage{});
+    });
+
+    EXPECT_TRUE(bus.post(TasksChangedMessage{}));
+    EXPECT_EQ(bus.dispatch(events), EventBus::CAPACITY);
+    EXPECT_TRUE(bus.hasPending());
+}
+
+TEST(EventBusTest, DeliversMessagesFromWorkerThreads) {
+    EventBus bus;
+    ApplicationEvents events;
+    constexpr int WORKERS = 4;
+    constexpr int MESSAGES_PER_WORKER = 10'000;
+    int received = 0;
+    [[maybe_unused]] const auto id = events.onTasksChanged.subscribe([&] { ++received; });
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < WORKERS; ++w) {
+        workers.emplace_back([&bus] {
+            for (int i = 0; i < MESSAGES_PER_WORKER; ++i) {
+                while (!bus.post(TasksChangedMessage{})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    while (received < WORKERS * MESSAGES_PER_WORKER) {
+        if (bus.dispatch(events) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(received, WORKERS * MESSAGES_PER_WORKER);
+    EXPECT_FALSE(bus.hasPending());
+}
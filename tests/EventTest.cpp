@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include "core/Event.h"
 
+#include <array>
+#include <string>
+#include <vector>
+
 using namespace WorkBalance::Core;
 
 class EventTest : public ::testing::Test {
@@ -134,3 +138,102 @@ TEST_F(EventTest, HasSubscribersReturnsCorrectly) {
     void_event.unsubscribe(id);
     EXPECT_FALSE(void_event.hasSubscribers());
 }
+
+TEST_F(EventTest, HandlerCanUnsubscribeItselfDuringEmit) {
+    int call_count = 0;
+    Event<>::HandlerId id = 0;
+    id = void_event.subscribe([&]() {
+        ++call_count;
+        void_event.unsubscribe(id);
+    });
+
+    void_event.emit();
+    void_event.emit();
+
+    EXPECT_EQ(call_count, 1);
+    EXPECT_FALSE(void_event.hasSubscribers());
+}
+
+TEST_F(EventTest, UnsubscribeDuringEmitSkipsLaterHandler) {
+    int later_calls = 0;
+    Event<>::HandlerId later_id = 0;
+    [[maybe_unused]] auto first = void_event.subscribe([&]() { void_event.unsubscribe(later_id); });
+    later_id = void_event.subscribe([&]() { ++later_calls; });
+
+    void_event.emit();
+
+    EXPECT_EQ(later_calls, 0);
+    EXPECT_EQ(void_event.subscriberCount(), 1U);
+}
+
+TEST_F(EventTest, SubscribeDuringEmitTakesEffectNextEmit) {
+    int added_calls = 0;
+    bool subscribed = false;
+    [[maybe_unused]] auto id = void_event.subscribe([&]() {
+        if (!subscribed) {
+            subscribed = true;
+            [[maybe_unused]] auto added = void_event.subscribe([&]() { ++added_calls; });
+        }
+    });
+
+    void_event.emit();
+    EXPECT_EQ(added_calls, 0);
+    EXPECT_EQ(void_event.subscriberCount(), 2U);
+
+    void_event.emit();
+    EXPECT_EQ(added_calls, 1);
+}
+
+TEST_F(EventTest, ClearDuringEmitStopsRemainingHandlers) {
+    int call_count = 0;
+    [[maybe_unused]] auto first = void_event.subscribe([&]() {
+        ++call_count;
+        void_event.clear();
+    });
+    [[maybe_unused]] auto second = void_event.subscribe([&]() { ++call_count; });
+
+    void_event.emit();
+    void_event.emit();
+
+    EXPECT_EQ(call_count, 1);
+    EXPECT_FALSE(void_event.hasSubscribers());
+}
+
+TEST_F(EventTest, NestedEmitCallsEachHandlerPerEmit) {
+    std::vector<int> received;
+    [[maybe_unused]] auto id = int_event.subscribe([&](int value) {
+        received.push_back(value);
+        if (value == 1) {
+            int_event.emit(2);
+        }
+    });
+
+    int_event.emit(1);
+
+    EXPECT_EQ(received, (std::vector<int>{1, 2}));
+}
+
+TEST_F(EventTest, IdsStayValidAfterCompaction) {
+    int last_calls = 0;
+    const auto first = void_event.subscribe([]() {});
+    [[maybe_unused]] const auto second = void_event.subscribe([&]() { void_event.unsubscribe(first); });
+    const auto last = void_event.subscribe([&]() { ++last_calls; });
+
+    void_event.emit();
+    void_event.unsubscribe(last);
+    void_event.emit();
+
+    EXPECT_EQ(last_calls, 1);
+    EXPECT_EQ(void_event.subscriberCount(), 1U);
+}
+
+TEST_F(EventTest, LargeHandlersAreSupported) {
+    std::array<int, 32> payload{};
+    payload.back() = 7;
+    int received = 0;
+    [[maybe_unused]] auto id = void_event.subscribe([payload, &received]() { received = payload.back(); });
+
+    void_event.emit();
+
+    EXPECT_EQ(received, 7);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "app/FontAtlasCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace WorkBalance::App;
+using WorkBalance::Core::PersistenceError;
+
+namespace {
+CachedFontAtlas makeAtlas() {
+    CachedFontAtlas atlas;
+    atlas.width = 4;
+    atlas.height = 2;
+    atlas.pixels = {0, 32, 64, 96, 128, 160, 192, 255};
+    atlas.white_pixel_uv = {0.125f, 0.25f};
+    atlas.line_uvs = {{0.0f, 0.0f, 0.5f, 0.5f}, {0.5f, 0.5f, 1.0f, 1.0f}};
+
+    CachedFont font;
+    font.size = 120.0f;
+    font.ascent = 96.0f;
+    font.descent = -24.0f;
+    font.ellipsis_char = 0x2026;
+    font.fallback_char = '?';
+    font.glyphs.push_back(CachedGlyph{'0', CachedGlyph::FLAG_VISIBLE, 64.0f, 1, 2, 3, 4, 0.1f, 0.2f, 0.3f, 0.4f});
+    font.glyphs.push_back(CachedGlyph{':', 0, 20.0f});
+    atlas.fonts.push_back(font);
+    atlas.fonts.push_back(CachedFont{40.0f, 32.0f, -8.0f, '.', '?', {}});
+    return atlas;
+}
+} // namespace
+
+class FontAtlasCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        m_test_dir = std::filesystem::temp_directory_path() / "workbalance_font_cache_test";
+        std::filesystem::remove_all(m_test_dir);
+        m_cache_path = m_test_dir / FontAtlasCache::DEFAULT_FILENAME;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_test_dir);
+    }
+
+    std::filesystem::path m_test_dir;
+    std::filesystem::path m_cache_path;
+};
+
+TEST(FontAtlasCachePathTest, EachScaleHasItsOwnFile) {
+    const std::filesystem::path directory = "config";
+    EXPECT_EQ(FontAtlasCache::pathForScale(directory, 1.0f), directory / FontAtlasCache::DEFAULT_FILENAME);
+    EXPECT_EQ(FontAtlasCache::pathForScale(directory, 1.5f), directory / "workbalance_fonts_150.cache");
+    EXPECT_NE(FontAtlasCache::pathForScale(directory, 1.25f), FontAtlasCache::pathForScale(directory, 1.5f));
+}
+
+TEST_F(FontAtlasCacheTest, MissingFileReportsNotFound) {
+    FontAtlasCache cache(m_cache_path);
+    auto loaded = cache.load(1);
+    ASSERT_FALSE(loaded.has_value());
+    EXPECT_EQ(loaded.error(), PersistenceError::FileNotFound);
+}
+
+TEST_F(FontAtlasCacheTest, SaveAndLoadRoundTrip) {
+    FontAtlasCache cache(m_cache_path);
+    const CachedFontAtlas atlas = makeAtlas();
+    ASSERT_TRUE(cache.save(42, atlas).has_value());
+
+    auto loaded = cache.load(42);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->width, 4);
+    EXPECT_EQ(loaded->height, 2);
+    EXPECT_EQ(loaded->pixels, atlas.pixels);
+    EXPECT_EQ(loaded->white_pixel_uv, atlas.white_pixel_uv);
+    EXPECT_EQ(loaded->line_uvs, atlas.line_uvs);
+    ASSERT_EQ(loaded->fonts.size(), 2);
+    EXPECT_FLOAT_EQ(loaded->fonts[0].size, 120.0f);
+    EXPECT_FLOAT_EQ(loaded->fonts[0].descent, -24.0f);
+    EXPECT_EQ(loaded->fonts[0].ellipsis_char, 0x2026U);
+    EXPECT_EQ(loaded->fonts[0].fallback_char, static_cast<std::uint32_t>('?'));
+    EXPECT_EQ(loaded->fonts[1].ellipsis_char, static_cast<std::uint32_t>('.'));
+    ASSERT_EQ(loaded->fonts[0].glyphs.size(), 2);
+    EXPECT_EQ(loaded->fonts[0].glyphs[0].codepoint, static_cast<std::uint32_t>('0'));
+    EXPECT_EQ(loaded->fonts[0].glyphs[0].flags, CachedGlyph::FLAG_VISIBLE);
+    EXPECT_FLOAT_EQ(loaded->fonts[0].glyphs[0].v1, 0.4f);
+    EXPECT_TRUE(loaded->fonts[1].glyphs.empty());
+}
+
+TEST_F(FontAtlasCacheTest, DifferentKeyIsMismatch) {
+    FontAtlasCache cache(m_cache_path);
+    ASSERT_TRUE(cache.save(42, makeAtlas()).has_value());
+
+    auto loaded = cache.load(43);
+    ASSERT_FALSE(loaded.has_value());
+    EXPECT_EQ(loaded.error(), PersistenceError::CacheMismatch);
+}
+
+TEST_F(FontAtlasCacheTest, TruncatedFileIsRejected) {
+    FontAtlasCache cache(m_cache_path);
+    ASSERT_TRUE(cache.save(42, makeAtlas()).has_value());
+    std::filesystem::resize_file(m_cache_path, std::filesystem::file_size(m_cache_path) - 3);
+
+    auto loaded = cache.load(42);
+    ASSERT_FALSE(loaded.has_value());
+    EXPECT_EQ(loaded.error(), PersistenceError::ParseError);
+}
+
+TEST_F(FontAtlasCacheTest, CorruptedPixelsAreRejected) {
+    FontAtlasCache cache(m_cache_path);
+    ASSERT_TRUE(cache.save(42, makeAtlas()).has_value());
+    {
+        std::fstream file(m_cache_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('\x01');
+    }
+
+    auto loaded = cache.load(42);
+    ASSERT_FALSE(loaded.has_value());
+    EXPECT_EQ(loaded.error(), PersistenceError::ParseError);
+}
+
+TEST_F(FontAtlasCacheTest, SaveReplacesPreviousAtlas) {
+    FontAtlasCache cache(m_cache_path);
+    ASSERT_TRUE(cache.save(1, makeAtlas()).has_value());
+
+    CachedFontAtlas smaller = makeAtlas();
+    smaller.height = 1;
+    smaller.pixels.resize(4);
+    ASSERT_TRUE(cache.save(2, smaller).has_value());
+
+    EXPECT_EQ(cache.load(1).error(), PersistenceError::CacheMismatch);
+    auto loaded = cache.load(2);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->pixels.size(), 4);
+    EXPECT_FALSE(std::filesystem::exists(m_cache_path.string() + ".tmp"));
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "app/FrameCache.h"
+#include "core/Task.h"
+
+#include <string_view>
+
+using namespace WorkBalance::App;
+using WorkBalance::Core::TaskManager;
+using Action = FrameCache::Action;
+
+namespace {
+// Run unchanged frames until the settle frames after a change are used up
+void settle(FrameCache& cache, std::uint64_t signature) {
+    for (int i = 0; i < FrameCache::SETTLE_FRAMES; ++i) {
+        ASSERT_EQ(cache.beginFrame(signature, false), Action::Build);
+    }
+}
+} // namespace
+
+TEST(FrameSignatureTest, SameInputsHashEqual) {
+    FrameSignature a;
+    FrameSignature b;
+    a.add(42).add(true).add(std::string_view{"12:34"});
+    b.add(42).add(true).add(std::string_view{"12:34"});
+    EXPECT_EQ(a.value(), b.value());
+}
+
+TEST(FrameSignatureTest, DifferentInputsHashDifferently) {
+    FrameSignature a;
+    FrameSignature b;
+    a.add(1499);
+    b.add(1498);
+    EXPECT_NE(a.value(), b.value());
+}
+
+TEST(FrameSignatureTest, UndoneRenameChangesTaskSignature) {
+    // Undo arrives through the app's key callback, not ImGui input, so only the hash can notice it
+    const auto task_signature = [](const TaskManager& manager) {
+        FrameSignature signature;
+        signature.add(manager.getRevision())
+            .add(manager.getTaskCount())
+            .add(manager.getCompletedPomodoros())
+            .add(manager.getTargetPomodoros());
+        return signature.value();
+    };
+
+    TaskManager manager;
+    manager.addTask("Draft", 2);
+    manager.updateTask(0, "Final", 2, 0);
+    const std::uint64_t renamed = task_signature(manager);
+
+    ASSERT_TRUE(manager.undo());
+    const std::uint64_t undone = task_signature(manager);
+    EXPECT_NE(undone, renamed);
+
+    ASSERT_TRUE(manager.redo());
+    EXPECT_NE(task_signature(manager), undone);
+}
+
+TEST(FrameCacheTest, FirstFrameIsBuilt) {
+    FrameCache cache;
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Build);
+    EXPECT_EQ(cache.getStats().frames_built, 1);
+}
+
+TEST(FrameCacheTest, UnchangedFramesAreSkippedAfterSettling) {
+    FrameCache cache;
+    ASSERT_EQ(cache.beginFrame(1, false), Action::Build);
+    settle(cache, 1);
+
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Skip);
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Skip);
+    EXPECT_EQ(cache.getStats().frames_built, 1 + FrameCache::SETTLE_FRAMES);
+    EXPECT_EQ(cache.getStats().frames_skipped, 2);
+}
+
+TEST(FrameCacheTest, SignatureChangeRebuilds) {
+    FrameCache cache;
+    ASSERT_EQ(cache.beginFrame(1, false), Action::Build);
+    settle(cache, 1);
+    ASSERT_EQ(cache.beginFrame(1, false), Action::Skip);
+
+    EXPECT_EQ(cache.beginFrame(2, false), Action::Build);
+}
+
+TEST(FrameCacheTest, ForcedBuildIgnoresSignature) {
+    FrameCache cache;
+    ASSERT_EQ(cache.beginFrame(1, false), Action::Build);
+    settle(cache, 1);
+
+    EXPECT_EQ(cache.beginFrame(1, true), Action::Build);
+}
+
+TEST(FrameCacheTest, DamagedFramebufferReusesDrawData) {
+    FrameCache cache;
+    ASSERT_EQ(cache.beginFrame(1, false), Action::Build);
+    settle(cache, 1);
+
+    cache.invalidateFramebuffer();
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Reuse);
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Skip);
+    EXPECT_EQ(cache.getStats().frames_reused, 1);
+}
+
+TEST(FrameCacheTest, DamageWithStaleDrawDataRebuilds) {
+    FrameCache cache;
+    ASSERT_EQ(cache.beginFrame(1, false), Action::Build);
+    settle(cache, 1);
+
+    cache.invalidateDrawData();
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Skip);
+
+    cache.invalidateFramebuffer();
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Build);
+}
+
+TEST(FrameCacheTest, InvalidateForcesRebuild) {
+    FrameCache cache;
+    ASSERT_EQ(cache.beginFrame(1, false), Action::Build);
+    settle(cache, 1);
+
+    cache.invalidate();
+    EXPECT_EQ(cache.beginFrame(1, false), Action::Build);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "app/FrameProfiler.h"
+
+#include <chrono>
+#include <cstdint>
+
+using namespace WorkBalance::App;
+using namespace std::chrono_literals;
+using Stage = FrameProfiler::Stage;
+
+namespace {
+// Records one frame that starts at @p start and keeps the CPU busy for @p busy
+void recordFrame(FrameProfiler& profiler, FrameProfiler::Clock::time_point start, FrameProfiler::Clock::duration busy,
+                 std::uint64_t allocations_before = 0, std::uint64_t allocations_after = 0) {
+    profiler.beginFrame(start, allocations_before);
+    profiler.endFrame(start + busy, allocations_after);
+}
+} // namespace
+
+TEST(FrameProfilerTest, StartsEmpty) {
+    const FrameProfiler profiler;
+    EXPECT_EQ(profiler.size(), 0U);
+    EXPECT_EQ(profiler.summarize().max_interval_ms, 0.0f);
+}
+
+TEST(FrameProfilerTest, MeasuresIntervalBusyAndIdleTime) {
+    FrameProfiler profiler;
+    const FrameProfiler::Clock::time_point start{};
+    recordFrame(profiler, start, 2ms);
+    recordFrame(profiler, start + 7ms, 3ms);
+
+    const auto& latest = profiler.latest();
+    EXPECT_FLOAT_EQ(latest.interval_ms, 7.0f);
+    EXPECT_FLOAT_EQ(latest.cpu_ms, 3.0f);
+    EXPECT_FLOAT_EQ(latest.idle_ms, 5.0f);
+}
+
+TEST(FrameProfilerTest, FirstFrameHasNoInterval) {
+    FrameProfiler profiler;
+    recordFrame(profiler, FrameProfiler::Clock::time_point{} + 1s, 1ms);
+    EXPECT_EQ(profiler.latest().interval_ms, 0.0f);
+    EXPECT_EQ(profiler.latest().idle_ms, 0.0f);
+}
+
+TEST(FrameProfilerTest, StageTimesAccumulateWithinAFrame) {
+    FrameProfiler profiler;
+    profiler.beginFrame(FrameProfiler::Clock::time_point{}, 0);
+    profiler.addStageTime(Stage::Render, 1ms);
+    profiler.addStageTime(Stage::Render, 500us);
+    profiler.addStageTime(Stage::Swap, 2ms);
+    profiler.endFrame(FrameProfiler::Clock::time_point{} + 4ms, 0);
+
+    const auto& latest = profiler.latest();
+    EXPECT_FLOAT_EQ(latest.stage_ms[static_cast<std::size_t>(Stage::Render)], 1.5f);
+    EXPECT_FLOAT_EQ(latest.stage_ms[static_cast<std::size_t>(Stage::Swap)], 2.0f);
+    EXPECT_EQ(latest.stage_ms[static_cast<std::size_t>(Stage::Poll)], 0.0f);
+}
+
+TEST(FrameProfilerTest, EachFrameStartsFresh) {
+    FrameProfiler profiler;
+    profiler.beginFrame(FrameProfiler::Clock::time_point{}, 0);
+    profiler.addStageTime(Stage::Poll, 1ms);
+    profiler.setDrawStats(12, 3400);
+    profiler.setAction(FrameCache::Action::Build);
+    profiler.endFrame(FrameProfiler::Clock::time_point{} + 2ms, 0);
+
+    recordFrame(profiler, FrameProfiler::Clock::time_point{} + 7ms, 1ms);
+
+    const auto& latest = profiler.latest();
+    EXPECT_EQ(latest.stage_ms[static_cast<std::size_t>(Stage::Poll)], 0.0f);
+    EXPECT_EQ(latest.draw_calls, 0U);
+    EXPECT_EQ(latest.action, FrameCache::Action::Skip);
+}
+
+TEST(FrameProfilerTest, CountsAllocationsMadeDuringTheFrame) {
+    FrameProfiler profiler;
+    recordFrame(profiler, FrameProfiler::Clock::time_point{}, 1ms, 1000, 1003);
+    EXPECT_EQ(profiler.latest().allocations, 3U);
+}
+
+TEST(FrameProfilerTest, KeepsOnlyTheLatestHistory) {
+    FrameProfiler profiler;
+    FrameProfiler::Clock::time_point start{};
+    for (std::size_t i = 0; i < FrameProfiler::HISTORY + 10; ++i) {
+        recordFrame(profiler, start, 1ms);
+        start += 5ms;
+    }
+
+    EXPECT_EQ(profiler.size(), FrameProfiler::HISTORY);
+    EXPECT_EQ(profiler.historyOffset(), 10U);
+    EXPECT_FLOAT_EQ(profiler.intervalHistory()[profiler.historyOffset()], 5.0f);
+}
+
+TEST(FrameProfilerTest, HistoryStartsAtZeroUntilFull) {
+    FrameProfiler profiler;
+    recordFrame(profiler, FrameProfiler::Clock::time_point{}, 1ms);
+    recordFrame(profiler, FrameProfiler::Clock::time_point{} + 6ms, 1ms);
+    EXPECT_EQ(profiler.historyOffset(), 0U);
+    EXPECT_FLOAT_EQ(profiler.intervalHistory()[1], 6.0f);
+}
+
+TEST(FrameProfilerTest, SummarizesAveragesAndWorstFrame) {
+    FrameProfiler profiler;
+    FrameProfiler::Clock::time_point start{};
+    recordFrame(profiler, start, 2ms);
+    recordFrame(profiler, start + 10ms, 4ms);
+    recordFrame(profiler, start + 40ms, 6ms);
+
+    const auto summary = profiler.summarize();
+    EXPECT_FLOAT_EQ(summary.average_interval_ms, (0.0f + 10.0f + 30.0f) / 3.0f);
+    EXPECT_FLOAT_EQ(summary.max_interval_ms, 30.0f);
+    EXPECT_FLOAT_EQ(summary.average_cpu_ms, 4.0f);
+}
+
+TEST(FrameProfilerTest, ScopedStageAddsElapsedTime) {
+    FrameProfiler profiler;
+    profiler.beginFrame(FrameProfiler::Clock::now(), 0);
+    {
+        const FrameProfiler::ScopedStage stage{profiler, Stage::Update};
+    }
+    profiler.endFrame(FrameProfiler::Clock::now(), 0);
+    EXPECT_GE(profiler.latest().stage_ms[static_cast<std::size_t>(Stage::Update)], 0.0f);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "daemon/HeadlessSession.h"
+#include "core/ITimeSource.h"
+#include <memory>
+
+using namespace WorkBalance;
+using namespace WorkBalance::Core;
+using namespace std::chrono_literals;
+
+class HeadlessSessionTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        mock_time_source = std::make_shared<MockTimeSource>();
+        data.settings.pomodoro_duration_minutes = 1;
+        data.settings.short_break_duration_minutes = 1;
+        data.settings.long_break_duration_minutes = 2;
+        data.settings.pomodoros_before_long_break = 2;
+        data.settings.auto_start_breaks = false;
+        data.settings.auto_start_pomodoros = false;
+        data.tasks.push_back(Task{.name = data.task_names.intern("Write report"), .estimated_pomodoros = 2});
+        data.current_task_index = 0;
+    }
+
+    std::unique_ptr<Daemon::HeadlessSession> makeSession() {
+        return std::make_unique<Daemon::HeadlessSession>(data, nullptr, nullptr, mock_time_source);
+    }
+
+    // Runs the current timer to completion
+    static bool finishTimer(Daemon::HeadlessSession& session, MockTimeSource& time_source) {
+        time_source.advance(std::chrono::seconds(session.getTimer().getRemainingTime()));
+        return session.update();
+    }
+
+    std::shared_ptr<MockTimeSource> mock_time_source;
+    PersistentData data;
+};
+
+TEST_F(HeadlessSessionTest, StartsStoppedWithSavedDurations) {
+    const auto session = makeSession();
+    const SessionStatus status = session->getStatus();
+    EXPECT_EQ(status.mode, TimerMode::Pomodoro);
+    EXPECT_EQ(status.state, TimerState::Stopped);
+    EXPECT_EQ(status.remaining_seconds, 60);
+}
+
+TEST_F(HeadlessSessionTest, ToggleCommandStartsTimer) {
+    const auto session = makeSession();
+    const RemoteReply reply = session->handleCommand({RemoteAction::ToggleTimer});
+    EXPECT_TRUE(reply.success);
+    EXPECT_EQ(session->getStatus().state, TimerState::Running);
+    EXPECT_EQ(reply.message, formatSessionStatus(session->getStatus()));
+}
+
+TEST_F(HeadlessSessionTest, ShowCommandIsRefused) {
+    const auto session = makeSession();
+    EXPECT_FALSE(session->handleCommand({RemoteAction::Show}).success);
+}
+
+TEST_F(HeadlessSessionTest, QuitCommandRequestsQuit) {
+    const auto session = makeSession();
+    EXPECT_FALSE(session->isQuitRequested());
+    EXPECT_TRUE(session->handleCommand({RemoteAction::Quit}).success);
+    EXPECT_TRUE(session->isQuitRequested());
+}
+
+TEST_F(HeadlessSessionTest, StartBreakCommandSwitchesMode) {
+    const auto session = makeSession();
+    EXPECT_TRUE(session->handleCommand({RemoteAction::StartBreak, BreakKind::LongBreak}).success);
+    EXPECT_EQ(session->getStatus().mode, TimerMode::LongBreak);
+    EXPECT_EQ(session->getStatus().state, TimerState::Running);
+    EXPECT_EQ(session->getStatus().remaining_seconds, 120);
+}
+
+TEST_F(HeadlessSessionTest, WaterBreakCountsGlass) {
+    const auto session = makeSession();
+    EXPECT_TRUE(session->handleCommand({RemoteAction::StartBreak, BreakKind::Water}).success);
+    EXPECT_EQ(session->getStatus().water_glasses, 1);
+}
+
+TEST_F(HeadlessSessionTest, CompletedPomodoroCreditsCurrentTask) {
+    const auto session = makeSession();
+    (void)session->handleCommand({RemoteAction::ToggleTimer});
+    EXPECT_TRUE(finishTimer(*session, *mock_time_source));
+
+    const PersistentData snapshot = session->snapshot();
+    ASSERT_EQ(snapshot.tasks.size(), 1U);
+    EXPECT_EQ(snapshot.tasks[0].name, "Write report");
+    EXPECT_EQ(snapshot.tasks[0].completed_pomodoros, 1);
+    EXPECT_EQ(session->getStatus().mode, TimerMode::ShortBreak);
+    EXPECT_EQ(session->getStatus().state, TimerState::Stopped);
+}
+
+TEST_F(HeadlessSessionTest, FollowsPomodoroCycleWithAutoStart) {
+    data.settings.auto_start_breaks = true;
+    data.settings.auto_start_pomodoros = true;
+    const auto session = makeSession();
+    (void)session->handleCommand({RemoteAction::ToggleTimer});
+
+    const TimerMode expected[] = {TimerMode::ShortBreak, TimerMode::Pomodoro, TimerMode::LongBreak,
+                                  TimerMode::Pomodoro};
+    for (const TimerMode mode : expected) {
+        EXPECT_TRUE(finishTimer(*session, *mock_time_source));
+        EXPECT_EQ(session->getStatus().mode, mode);
+        EXPECT_EQ(session->getStatus().state, TimerState::Running);
+    }
+}
+
+TEST_F(HeadlessSessionTest, SnapshotKeepsLoadedSettings) {
+    data.settings.water_daily_goal = 11;
+    const auto session = makeSession();
+    const PersistentData snapshot = session->snapshot();
+    EXPECT_EQ(snapshot.settings.water_daily_goal, 11);
+    EXPECT_EQ(snapshot.settings.pomodoros_before_long_break, 2);
+    EXPECT_EQ(snapshot.current_task_index, 0);
+}
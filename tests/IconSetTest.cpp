@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "core/IconSet.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+namespace {
+std::vector<std::uint8_t> solidImage(int size, std::array<std::uint8_t, 4> colour) {
+    std::vector<std::uint8_t> pixels;
+    for (int i = 0; i < size * size; ++i) {
+        pixels.insert(pixels.end(), colour.begin(), colour.end());
+    }
+    return pixels;
+}
+} // namespace
+
+TEST(IconSetTest, BuildsRequestedSizesSmallestFirst) {
+    const auto source = solidImage(64, {10, 20, 30, 255});
+    constexpr std::array sizes{32, 16, 48};
+
+    const auto data = IconSet::build(source, 64, 64, sizes);
+    const IconSet icon_set(data);
+
+    const auto& images = icon_set.getImages();
+    ASSERT_EQ(images.size(), 4u);
+    EXPECT_EQ(images[0].width, 16);
+    EXPECT_EQ(images[1].width, 32);
+    EXPECT_EQ(images[2].width, 48);
+    EXPECT_EQ(images[3].width, 64);
+    for (const auto& image : images) {
+        EXPECT_EQ(image.height, image.width);
+        EXPECT_EQ(image.pixels.size(), static_cast<size_t>(image.width * image.height * 4));
+    }
+}
+
+TEST(IconSetTest, KeepsSourcePixelsAndSkipsUpscaling) {
+    const auto source = solidImage(16, {1, 2, 3, 4});
+    constexpr std::array sizes{16, 32, 8, 8};
+
+    const auto data = IconSet::build(source, 16, 16, sizes);
+    const IconSet icon_set(data);
+
+    ASSERT_EQ(icon_set.getImages().size(), 2u);
+    EXPECT_EQ(icon_set.getImages()[0].width, 8);
+    const auto& original = icon_set.getImages()[1];
+    EXPECT_EQ(original.width, 16);
+    EXPECT_TRUE(std::ranges::equal(original.pixels, source));
+}
+
+TEST(IconSetTest, DownscaleAveragesAndIgnoresTransparentColour) {
+    // Left half opaque red, right half fully transparent green
+    std::vector<std::uint8_t> source;
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            const std::array<std::uint8_t, 4> pixel =
+                x < 2 ? std::array<std::uint8_t, 4>{255, 0, 0, 255} : std::array<std::uint8_t, 4>{0, 255, 0, 0};
+            source.insert(source.end(), pixel.begin(), pixel.end());
+        }
+    }
+    constexpr std::array sizes{1, 2};
+
+    const auto data = IconSet::build(source, 4, 4, sizes);
+    const IconSet icon_set(data);
+    ASSERT_EQ(icon_set.getImages().size(), 3u);
+
+    const auto& single = icon_set.getImages()[0];
+    EXPECT_EQ(single.pixels[0], 255);
+    EXPECT_EQ(single.pixels[1], 0);
+    EXPECT_EQ(single.pixels[3], 128);
+
+    const auto& half = icon_set.getImages()[1];
+    EXPECT_EQ(half.pixels[3], 255); // left column stays opaque
+    EXPECT_EQ(half.pixels[7], 0); // right column stays transparent
+}
+
+TEST(IconSetTest, SelectPrefersSmallestImageThatIsLargeEnough) {
+    const auto source = solidImage(64, {0, 0, 0, 255});
+    constexpr std::array sizes{16, 32};
+
+    const auto data = IconSet::build(source, 64, 64, sizes);
+    const IconSet icon_set(data);
+
+    ASSERT_NE(icon_set.select(16), nullptr);
+    EXPECT_EQ(icon_set.select(16)->width, 16);
+    EXPECT_EQ(icon_set.select(20)->width, 32);
+    EXPECT_EQ(icon_set.select(33)->width, 64);
+    EXPECT_EQ(icon_set.select(256)->width, 64);
+}
+
+TEST(IconSetTest, RejectsInvalidInput) {
+    const auto source = solidImage(8, {0, 0, 0, 255});
+    constexpr std::array sizes{4};
+
+    EXPECT_TRUE(IconSet::build(source, 8, 9, sizes).empty());
+    EXPECT_TRUE(IconSet::build(source, 0, 8, sizes).empty());
+
+    auto data = IconSet::build(source, 8, 8, sizes);
+    data.resize(data.size() - 1);
+    const IconSet truncated(data);
+    EXPECT_TRUE(truncated.getImages().empty());
+    EXPECT_EQ(truncated.select(16), nullptr);
+
+    const std::vector<std::uint8_t> garbage(64, 0xAB);
+    EXPECT_TRUE(IconSet(garbage).getImages().empty());
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "core/InplaceFunction.h"
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <utility>
+
+using namespace WorkBalance::Core;
+
+namespace {
+int addOne(int value) {
+    return value + 1;
+}
+} // namespace
+
+TEST(InplaceFunctionTest, DefaultIsEmpty) {
+    const InplaceFunction<void()> function;
+    EXPECT_FALSE(function);
+}
+
+TEST(InplaceFunctionTest, InvokesLambda) {
+    int base = 10;
+    const InplaceFunction<int(int)> function{[&base](int value) { return base + value; }};
+    ASSERT_TRUE(function);
+    EXPECT_EQ(function(5), 15);
+}
+
+TEST(InplaceFunctionTest, InvokesFunctionPointer) {
+    const InplaceFunction<int(int)> function{&addOne};
+    EXPECT_EQ(function(1), 2);
+}
+
+TEST(InplaceFunctionTest, EmptyStdFunctionStaysEmpty) {
+    const InplaceFunction<void()> function{std::function<void()>{}};
+    EXPECT_FALSE(function);
+}
+
+TEST(InplaceFunctionTest, LargeCallableFallsBackToHeap) {
+    std::array<int, 64> payload{};
+    payload.back() = 42;
+    const InplaceFunction<int()> function{[payload]() { return payload.back(); }};
+    EXPECT_EQ(function(), 42);
+}
+
+TEST(InplaceFunctionTest, MoveOnlyCallable) {
+    auto value = std::make_unique<int>(3);
+    const InplaceFunction<int()> function{[value = std::move(value)]() { return *value; }};
+    EXPECT_EQ(function(), 3);
+}
+
+TEST(InplaceFunctionTest, MoveTransfersCallable) {
+    int calls = 0;
+    InplaceFunction<void()> source{[&calls]() { ++calls; }};
+    InplaceFunction<void()> target{std::move(source)};
+
+    target();
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_FALSE(source); // Moved-from functions are empty
+}
+
+TEST(InplaceFunctionTest, ResetDestroysCallable) {
+    auto shared = std::make_shared<int>(0);
+    InplaceFunction<void()> function{[shared]() {}};
+    EXPECT_EQ(shared.use_count(), 2);
+
+    function.reset();
+
+    EXPECT_FALSE(function);
+    EXPECT_EQ(shared.use_count(), 1);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "core/MemoryAccounting.h"
+#include "core/StringPool.h"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <string>
+#include <string_view>
+
+using namespace WorkBalance::Core;
+
+// Accounts are process-wide, so every test measures the change it causes rather than absolute values
+TEST(MemoryAccountingTest, ResourceCountsBytesWhileHeld) {
+    MemoryAccount account;
+    TaggedMemoryResource resource{account};
+
+    void* block = resource.allocate(256, 16);
+    EXPECT_EQ(account.current(), 256u);
+
+    resource.deallocate(block, 256, 16);
+    EXPECT_EQ(account.current(), 0u);
+    EXPECT_EQ(account.peak(), 256u);
+}
+
+TEST(MemoryAccountingTest, PeakKeepsHighestTotal) {
+    MemoryAccount account;
+
+    account.add(100);
+    account.add(50);
+    account.remove(120);
+    account.add(40);
+
+    EXPECT_EQ(account.current(), 70u);
+    EXPECT_EQ(account.peak(), 150u);
+}
+
+TEST(MemoryAccountingTest, PmrContainerIsAccountedUnderItsTag) {
+    const MemoryAccount& account = MemoryAccounting::account(MemoryTag::UiStrings);
+    const std::uint64_t before = account.current();
+    {
+        std::pmr::string text{MemoryAccounting::resource(MemoryTag::UiStrings)};
+        text.assign(200, 'x');
+        EXPECT_GE(account.current(), before + 200);
+    }
+    EXPECT_EQ(account.current(), before);
+}
+
+TEST(MemoryAccountingTest, AllocateReallocateAndDeallocateTrackSizes) {
+    const MemoryAccount& account = MemoryAccounting::account(MemoryTag::Audio);
+    const std::uint64_t before = account.current();
+
+    void* block = MemoryAccounting::allocate(MemoryTag::Audio, 64);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(account.current(), before + 64);
+    std::memset(block, 0x5a, 64);
+
+    block = MemoryAccounting::reallocate(MemoryTag::Audio, block, 1024);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(account.current(), before + 1024);
+    EXPECT_EQ(static_cast<unsigned char*>(block)[63], 0x5a);
+
+    MemoryAccounting::deallocate(MemoryTag::Audio, block);
+    EXPECT_EQ(account.current(), before);
+}
+
+TEST(MemoryAccountingTest, AllocateIsSuitablyAligned) {
+    void* block = MemoryAccounting::allocate(MemoryTag::ImGui, 3);
+    ASSERT_NE(block, nullptr);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t), 0u);
+    MemoryAccounting::deallocate(MemoryTag::ImGui, block);
+}
+
+TEST(MemoryAccountingTest, ReallocateNullAllocatesAndDeallocateNullIsIgnored) {
+    const MemoryAccount& account = MemoryAccounting::account(MemoryTag::ImGui);
+    const std::uint64_t before = account.current();
+
+    void* block = MemoryAccounting::reallocate(MemoryTag::ImGui, nullptr, 32);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(account.current(), before + 32);
+
+    MemoryAccounting::deallocate(MemoryTag::ImGui, block);
+    MemoryAccounting::deallocate(MemoryTag::ImGui, nullptr);
+    EXPECT_EQ(account.current(), before);
+}
+
+TEST(MemoryAccountingTest, StringPoolChunksComeFromItsResource) {
+    MemoryAccount account;
+    TaggedMemoryResource resource{account};
+    {
+        StringPool pool{128, &resource};
+        (void)pool.intern("A task name long enough to skip the small string set");
+
+        EXPECT_EQ(pool.resource(), &resource);
+        EXPECT_EQ(account.current(), 128u);
+    }
+    EXPECT_EQ(account.current(), 0u);
+}
+
+TEST(MemoryAccountingTest, TagNamesAreDistinct) {
+    std::set<std::string_view> names;
+    for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i) {
+        names.insert(getMemoryTagName(static_cast<MemoryTag>(i)));
+    }
+
+    EXPECT_EQ(names.size(), MEMORY_TAG_COUNT);
+    EXPECT_EQ(getMemoryTagName(MemoryTag::UiStrings), "ui_strings");
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include "core/Metrics.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+TEST(MetricsTest, CounterAccumulates) {
+    Counter counter;
+    counter.increment();
+    counter.increment(4);
+    EXPECT_EQ(counter.value(), 5U);
+}
+
+TEST(MetricsTest, GaugeKeepsLastValue) {
+    Gauge gauge;
+    gauge.set(3.5);
+    gauge.set(-1.0);
+    EXPECT_DOUBLE_EQ(gauge.value(), -1.0);
+}
+
+TEST(MetricsTest, SmallValuesHaveExactBuckets) {
+    for (std::uint64_t value = 0; value < Histogram::SUB_BUCKETS; ++value) {
+        const auto index = Histogram::bucketIndex(value);
+        EXPECT_EQ(Histogram::bucketUpperBound(index), value);
+    }
+}
+
+TEST(MetricsTest, BucketsCoverEveryValueWithinPrecision) {
+    // Each value's bucket ends at or above it, and the previous bucket ends below it
+    for (std::uint64_t value = 1; value < (std::uint64_t{1} << 41); value = value * 3 + 1) {
+        const auto index = Histogram::bucketIndex(value);
+        ASSERT_LT(index, Histogram::BUCKET_COUNT);
+        const std::uint64_t upper = Histogram::bucketUpperBound(index);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(static_cast<double>(upper - value), static_cast<double>(value) / 8.0);
+        if (index > 0) {
+            EXPECT_LT(Histogram::bucketUpperBound(index - 1), value);
+        }
+    }
+}
+
+TEST(MetricsTest, TopExponentRowStaysInBounds) {
+    constexpr std::uint64_t two_pow_40 = std::uint64_t{1} << 40;
+    constexpr std::uint64_t two_pow_41 = std::uint64_t{1} << 41;
+
+    EXPECT_LT(Histogram::bucketIndex(two_pow_40), Histogram::BUCKET_COUNT);
+    EXPECT_GT(Histogram::bucketIndex(two_pow_40), Histogram::bucketIndex(two_pow_40 - 1));
+    EXPECT_EQ(Histogram::bucketIndex(two_pow_41 - 1), Histogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(Histogram::bucketUpperBound(Histogram::BUCKET_COUNT - 1), two_pow_41 - 1);
+    EXPECT_EQ(Histogram::bucketIndex(two_pow_41), Histogram::BUCKET_COUNT - 1);
+
+    Histogram histogram;
+    histogram.record(two_pow_40 + 1);
+    EXPECT_EQ(histogram.snapshot().count, 1U);
+}
+
+TEST(MetricsTest, HugeValuesLandInLastBucket) {
+    EXPECT_EQ(Histogram::bucketIndex(UINT64_MAX), Histogram::BUCKET_COUNT - 1);
+}
+
+TEST(MetricsTest, HistogramSnapshotCountsAndSums) {
+    Histogram histogram;
+    histogram.record(100);
+    histogram.record(200);
+    histogram.record(std::chrono::microseconds{1});
+
+    const auto snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 3U);
+    EXPECT_EQ(snapshot.sum, 1300U);
+}
+
+TEST(MetricsTest, QuantilesFallInTheRightBuckets) {
+    Histogram histogram;
+    for (int i = 0; i < 90; ++i) {
+        histogram.record(1000);
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(1'000'000);
+    }
+
+    const auto snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.quantile(0.5), Histogram::bucketUpperBound(Histogram::bucketIndex(1000)));
+    EXPECT_EQ(snapshot.quantile(0.9), Histogram::bucketUpperBound(Histogram::bucketIndex(1000)));
+    EXPECT_EQ(snapshot.quantile(0.99), Histogram::bucketUpperBound(Histogram::bucketIndex(1'000'000)));
+    EXPECT_EQ(Histogram{}.snapshot().quantile(0.5), 0U);
+}
+
+TEST(MetricsTest, ConcurrentRecordingLosesNothing) {
+    Histogram histogram;
+    Counter counter;
+    constexpr int THREADS = 4;
+    constexpr int SAMPLES = 100'000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < SAMPLES; ++i) {
+                histogram.record(static_cast<std::uint64_t>(i));
+                counter.increment();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(histogram.snapshot().count, static_cast<std::uint64_t>(THREADS * SAMPLES));
+    EXPECT_EQ(counter.value(), static_cast<std::uint64_t>(THREADS * SAMPLES));
+}
+
+TEST(MetricsTest, RegistryReturnsExistingMetricForSameName) {
+    MetricsRegistry registry;
+    Counter& first = registry.counter("workbalance_test_total", "Test");
+    Counter& second = registry.counter("workbalance_test_total", "Ignored");
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(registry.counters().size(), 1U);
+    EXPECT_EQ(registry.counters().front().help, "Test");
+}
+
+TEST(MetricsTest, RegisteredReferencesStayValid) {
+    MetricsRegistry registry;
+    Counter& first = registry.counter("workbalance_first_total", "First");
+    first.increment();
+    for (int i = 0; i < 100; ++i) {
+        registry.counter("workbalance_extra_" + std::to_string(i) + "_total", "Extra");
+    }
+    first.increment();
+    EXPECT_EQ(registry.counters().front().metric.value(), 2U);
+}
+
+TEST(MetricsTest, PrometheusTextListsEveryMetric) {
+    MetricsRegistry registry;
+    registry.counter("workbalance_saves_total", "Settings saves").increment(3);
+    registry.gauge("workbalance_tasks", "Tasks in the list").set(7);
+    Histogram& latency = registry.histogram("workbalance_save_seconds", "Time to save settings");
+    latency.record(1000);
+    latency.record(1000);
+    latency.record(3000);
+
+    const std::string text = registry.toPrometheusText();
+    const std::string expected = "# HELP workbalance_saves_total Settings saves\n"
+                                 "# TYPE workbalance_saves_total counter\n"
+                                 "workbalance_saves_total 3\n"
+                                 "# HELP workbalance_tasks Tasks in the list\n"
+                                 "# TYPE workbalance_tasks gauge\n"
+                                 "workbalance_tasks 7\n"
+                                 "# HELP workbalance_save_seconds Time to save settings\n"
+                                 "# TYPE workbalance_save_seconds histogram\n"
+                                 "workbalance_save_seconds_bucket{le=\"1.023e-06\"} 2\n"
+                                 "workbalance_save_seconds_bucket{le=\"3.071e-06\"} 3\n"
+                                 "workbalance_save_seconds_bucket{le=\"+Inf\"} 3\n"
+                                 "workbalance_save_seconds_sum 5e-06\n"
+                                 "workbalance_save_seconds_count 3\n";
+    EXPECT_EQ(text, expected);
+}
+
+class MetricsFileTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        m_test_dir = std::filesystem::temp_directory_path() / "workbalance_metrics_test";
+        std::filesystem::remove_all(m_test_dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_test_dir);
+    }
+
+    std::filesystem::path m_test_dir;
+};
+
+TEST_F(MetricsFileTest, WritesPrometheusTextToFile) {
+    MetricsRegistry registry;
+    registry.counter("workbalance_saves_total", "Settings saves").increment();
+    const auto path = m_test_dir / MetricsRegistry::DEFAULT_FILENAME;
+
+    ASSERT_TRUE(registry.writePrometheusFile(path).has_value());
+
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), registry.toPrometheusText());
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+}
+
+TEST_F(MetricsFileTest, OverwritesPreviousFile) {
+    MetricsRegistry registry;
+    Counter& saves = registry.counter("workbalance_saves_total", "Settings saves");
+    const auto path = m_test_dir / MetricsRegistry::DEFAULT_FILENAME;
+
+    ASSERT_TRUE(registry.writePrometheusFile(path).has_value());
+    saves.increment(5);
+    ASSERT_TRUE(registry.writePrometheusFile(path).has_value());
+
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_NE(contents.str().find("workbalance_saves_total 5\n"), std::string::npos);
+}
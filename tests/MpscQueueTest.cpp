@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "core/MpscQueue.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+TEST(MpscQueueTest, StartsEmpty) {
+    MpscQueue<int, 4> queue;
+    EXPECT_FALSE(queue.hasItems());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TEST(MpscQueueTest, PopsInPushOrder) {
+    MpscQueue<int, 8> queue;
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+
+    for (int i = 0; i < 5; ++i) {
+        const auto value = queue.tryPop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_FALSE(queue.hasItems());
+}
+
+TEST(MpscQueueTest, RejectsPushWhenFull) {
+    MpscQueue<int, 4> queue;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_FALSE(queue.tryPush(4));
+
+    // Popping frees a slot
+    EXPECT_EQ(queue.tryPop(), 0);
+    EXPECT_TRUE(queue.tryPush(4));
+}
+
+TEST(MpscQueueTest, WrapsAroundManyTimes) {
+    MpscQueue<int, 2> queue;
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(queue.tryPush(i));
+        ASSERT_EQ(queue.tryPop(), i);
+    }
+}
+
+TEST(MpscQueueTest, MovesMoveOnlyItems) {
+    MpscQueue<std::unique_ptr<int>, 4> queue;
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(7)));
+
+    const auto value = queue.tryPop();
+    ASSERT_TRUE(value.has_value());
+    ASSERT_NE(*value, nullptr);
+    EXPECT_EQ(**value, 7);
+}
+
+TEST(MpscQueueTest, DestroysItemsLeftInQueue) {
+    const auto item = std::make_shared<int>(1);
+    {
+        MpscQueue<std::shared_ptr<int>, 4> queue;
+        EXPECT_TRUE(queue.tryPush(item));
+        EXPECT_TRUE(queue.tryPush(item));
+        EXPECT_EQ(item.use_count(), 3);
+    }
+    EXPECT_EQ(item.use_count(), 1);
+}
+
+// Several producers race each other and the consumer through a small ring, so positions wrap
+// thousands of times. Build with WORKBALANCE_SANITIZE_THREAD to have TSAN check the handoffs.
+TEST(MpscQueueTest, ManyProducersOneConsumerStress) {
+    constexpr std::size_t PRODUCERS = 4;
+    constexpr std::uint32_t ITEMS_PER_PRODUCER = 500'000;
+    struct Item {
+        std::uint32_t producer;
+        std::uint32_t sequence;
+    };
+    MpscQueue<Item, 64> queue;
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (std::uint32_t i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                while (!queue.tryPush(Item{static_cast<std::uint32_t>(p), i})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Each producer's items must arrive complete and in the order it pushed them
+    std::array<std::uint32_t, PRODUCERS> next_expected{};
+    std::size_t received = 0;
+    bool in_order = true;
+    while (received < PRODUCERS * ITEMS_PER_PRODUCER) {
+        if (const auto item = queue.tryPop()) {
+            in_order = in_order && item->producer < PRODUCERS && item->sequence == next_expected[item->producer];
+            if (item->producer < PRODUCERS) {
+                next_expected[item->producer] = item->sequence + 1;
+            }
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(in_order);
+    for (const std::uint32_t count : next_expected) {
+        EXPECT_EQ(count, ITEMS_PER_PRODUCER);
+    }
+    EXPECT_FALSE(queue.hasItems());
+}
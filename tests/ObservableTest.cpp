@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "core/Observable.h"
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace WorkBalance::Core;
@@ -149,6 +150,21 @@ TEST_F(ObservableTest, StringObservable) {
     EXPECT_EQ(new_str, "updated");
 }
 
+TEST_F(ObservableTest, ValuesWithoutEqualityAlwaysNotify) {
+    struct Color {
+        float r = 0.0f;
+    };
+    Observable<Color> color{Color{0.5f}};
+    int notify_count = 0;
+    color.observe([&](const Color&, const Color&) { ++notify_count; });
+
+    color.set(Color{0.5f});
+    color.set(Color{0.25f});
+
+    EXPECT_EQ(notify_count, 2);
+    EXPECT_FLOAT_EQ(color.get().r, 0.25f);
+}
+
 // Tests for ComputedObservable
 TEST(ComputedObservableTest, InitialComputation) {
     int base_value = 10;
@@ -206,3 +222,181 @@ TEST(ComputedObservableTest, ImplicitConversion) {
     int value = computed;
     EXPECT_EQ(value, 42);
 }
+
+TEST(ComputedObservableTest, ComputesLazily) {
+    int compute_count = 0;
+    ComputedObservable<int> computed([&]() {
+        ++compute_count;
+        return 1;
+    });
+
+    EXPECT_EQ(compute_count, 0);
+    EXPECT_EQ(computed.get(), 1);
+    EXPECT_EQ(computed.get(), 1);
+    EXPECT_EQ(compute_count, 1);
+}
+
+TEST(ComputedObservableTest, TracksObservableInputs) {
+    Observable<int> width{10};
+    Observable<int> height{20};
+    ComputedObservable<int> area([&]() { return width.get() * height.get(); });
+    EXPECT_EQ(area.get(), 200);
+
+    width.set(30);
+
+    EXPECT_EQ(area.get(), 600);
+}
+
+TEST(ComputedObservableTest, RecomputesOnlyWhenReadAfterChange) {
+    Observable<int> input{1};
+    int compute_count = 0;
+    ComputedObservable<int> doubled([&]() {
+        ++compute_count;
+        return input.get() * 2;
+    });
+    EXPECT_EQ(doubled.get(), 2);
+
+    input.set(2);
+    input.set(3);
+    EXPECT_EQ(compute_count, 1);
+
+    EXPECT_EQ(doubled.get(), 6);
+    EXPECT_EQ(compute_count, 2);
+}
+
+TEST(ComputedObservableTest, ChainsThroughComputedInputs) {
+    Observable<int> input{1};
+    ComputedObservable<int> doubled([&]() { return input.get() * 2; });
+    ComputedObservable<int> plus_one([&]() { return doubled.get() + 1; });
+    EXPECT_EQ(plus_one.get(), 3);
+
+    input.set(5);
+
+    EXPECT_EQ(plus_one.get(), 11);
+}
+
+TEST(ComputedObservableTest, DropsInputsNoLongerRead) {
+    Observable<bool> use_first{true};
+    Observable<int> first{1};
+    Observable<int> second{2};
+    int compute_count = 0;
+    ComputedObservable<int> selected([&]() {
+        ++compute_count;
+        return use_first.get() ? first.get() : second.get();
+    });
+    EXPECT_EQ(selected.get(), 1);
+
+    use_first.set(false);
+    EXPECT_EQ(selected.get(), 2);
+    first.set(10);
+    EXPECT_EQ(selected.get(), 2);
+
+    EXPECT_EQ(compute_count, 2);
+}
+
+TEST(ComputedObservableTest, ObserversNotifiedWhenTrackedInputChanges) {
+    Observable<int> input{1};
+    ComputedObservable<int> doubled([&]() { return input.get() * 2; });
+    std::vector<std::pair<int, int>> changes;
+    doubled.observe([&](int old_v, int new_v) { changes.emplace_back(old_v, new_v); });
+
+    input.set(4);
+
+    EXPECT_EQ(changes, (std::vector<std::pair<int, int>>{{2, 8}}));
+}
+
+TEST(ComputedObservableTest, DiamondNotifiesOnce) {
+    Observable<int> input{1};
+    ComputedObservable<int> left([&]() { return input.get() + 1; });
+    ComputedObservable<int> right([&]() { return input.get() * 10; });
+    ComputedObservable<int> sum([&]() { return left.get() + right.get(); });
+    std::vector<int> seen;
+    sum.observe([&](int, int new_v) { seen.push_back(new_v); });
+
+    input.set(2);
+
+    EXPECT_EQ(seen, std::vector<int>{23});
+}
+
+TEST(ObservableTransactionTest, CoalescesNotifications) {
+    Observable<int> value{0};
+    std::vector<std::pair<int, int>> changes;
+    value.observe([&](int old_v, int new_v) { changes.emplace_back(old_v, new_v); });
+
+    {
+        const ObservableTransaction transaction;
+        value.set(1);
+        value.set(2);
+        value.set(3);
+        EXPECT_EQ(value.get(), 3);
+        EXPECT_TRUE(changes.empty());
+    }
+
+    EXPECT_EQ(changes, (std::vector<std::pair<int, int>>{{0, 3}}));
+}
+
+TEST(ObservableTransactionTest, RevertedValueIsNotReported) {
+    Observable<int> value{5};
+    int notify_count = 0;
+    value.observe([&](int, int) { ++notify_count; });
+
+    {
+        const ObservableTransaction transaction;
+        value.set(6);
+        value.set(5);
+    }
+
+    EXPECT_EQ(notify_count, 0);
+}
+
+TEST(ObservableTransactionTest, ComputedNotifiedOncePerCommit) {
+    Observable<int> water{0};
+    Observable<int> standups{0};
+    ComputedObservable<int> total([&]() { return water.get() + standups.get(); });
+    int notify_count = 0;
+    total.observe([&](int, int) { ++notify_count; });
+
+    {
+        const ObservableTransaction transaction;
+        water.set(3);
+        standups.set(2);
+        water.set(4);
+    }
+
+    EXPECT_EQ(notify_count, 1);
+    EXPECT_EQ(total.get(), 6);
+}
+
+TEST(ObservableTransactionTest, NestedTransactionsCommitWithOutermost) {
+    Observable<int> value{0};
+    int notify_count = 0;
+    value.observe([&](int, int) { ++notify_count; });
+
+    {
+        const ObservableTransaction outer;
+        {
+            const ObservableTransaction inner;
+            value.set(1);
+        }
+        EXPECT_EQ(notify_count, 0);
+        EXPECT_TRUE(ObservableTransaction::isActive());
+    }
+
+    EXPECT_EQ(notify_count, 1);
+    EXPECT_FALSE(ObservableTransaction::isActive());
+}
+
+TEST(ObservableTransactionTest, ObserverChangesJoinTheCommit) {
+    Observable<int> source{0};
+    Observable<int> mirror{0};
+    std::vector<int> mirrored;
+    source.observe([&](int, int new_v) { mirror.set(new_v); });
+    mirror.observe([&](int, int new_v) { mirrored.push_back(new_v); });
+
+    {
+        const ObservableTransaction transaction;
+        source.set(7);
+    }
+
+    EXPECT_EQ(mirrored, std::vector<int>{7});
+}
@@ -354,6 +354,25 @@ TEST_F(PersistenceTest, SaveAndLoadTaskWithSpecialCharacters) {
     EXPECT_EQ(loaded.tasks[0].name, "Task with \"quotes\" and \\backslash");
 }
 
+TEST_F(PersistenceTest, SaveAndLoadTaskWithControlCharacters) {
+    PersistentData data;
+
+    Task task;
+    task.name = "Line\nbreak\tand\x01" "bell\x1f";
+    data.tasks.push_back(task);
+
+    ASSERT_TRUE(m_persistence->save(data).has_value());
+
+    std::ifstream file(m_persistence->getConfigPath());
+    const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_NE(json.find(R"("Line\nbreak\tand\u0001bell\u001f")"), std::string::npos);
+
+    auto load_result = m_persistence->load();
+    ASSERT_TRUE(load_result.has_value());
+    ASSERT_EQ(load_result->tasks.size(), 1u);
+    EXPECT_EQ(load_result->tasks[0].name, "Line\nbreak\tand\x01" "bell\x1f");
+}
+
 TEST_F(PersistenceTest, SaveAndLoadEmptyTaskList) {
     PersistentData data;
     // No tasks added
@@ -368,6 +387,20 @@ TEST_F(PersistenceTest, SaveAndLoadEmptyTaskList) {
     EXPECT_TRUE(loaded.tasks.empty());
 }
 
+TEST_F(PersistenceTest, SaveAndLoadTaskCompletionTime) {
+    PersistentData data;
+    data.tasks.push_back(Task{"Done", true, 2, 2, 1700000000123});
+    data.settings.archive_after_days = 30;
+
+    ASSERT_TRUE(m_persistence->save(data).has_value());
+    auto load_result = m_persistence->load();
+    ASSERT_TRUE(load_result.has_value());
+
+    ASSERT_EQ(load_result->tasks.size(), 1);
+    EXPECT_EQ(load_result->tasks[0].completed_at, 1700000000123);
+    EXPECT_EQ(load_result->settings.archive_after_days, 30);
+}
+
 TEST_F(PersistenceTest, LoadReturnsErrorWhenFileNotFound) {
     // Don't save anything, try to load
     auto load_result = m_persistence->load();
@@ -565,4 +598,44 @@ TEST(PersistenceErrorTest, ErrorMessagesAreDescriptive) {
     EXPECT_FALSE(getPersistenceErrorMessage(PersistenceError::ParseError).empty());
     EXPECT_FALSE(getPersistenceErrorMessage(PersistenceError::WriteError).empty());
     EXPECT_FALSE(getPersistenceErrorMessage(PersistenceError::DirectoryCreateError).empty());
+    EXPECT_FALSE(getPersistenceErrorMessage(PersistenceError::EntryNotFound).empty());
+    EXPECT_FALSE(getPersistenceErrorMessage(PersistenceError::CacheMismatch).empty());
+}
+
+TEST_F(PersistenceTest, LoadedTaskNamesLiveInDataArena) {
+    PersistentData data;
+    data.tasks.push_back(Task{"Arena Task", false, 1, 0});
+
+    ASSERT_TRUE(m_persistence->save(data).has_value());
+
+    auto load_result = m_persistence->load();
+    ASSERT_TRUE(load_result.has_value());
+
+    const auto& loaded = load_result.value();
+    ASSERT_EQ(loaded.tasks.size(), 1u);
+    EXPECT_TRUE(loaded.task_names.owns(loaded.tasks[0].name));
+}
+
+TEST(PersistentDataTest, CopyOwnsIndependentNames) {
+    PersistentData original;
+    original.tasks.push_back(Task{original.task_names.intern("Copied Task"), false, 1, 0});
+
+    PersistentData copy = original;
+    original = PersistentData{};
+
+    ASSERT_EQ(copy.tasks.size(), 1u);
+    EXPECT_EQ(copy.tasks[0].name, "Copied Task");
+    EXPECT_TRUE(copy.task_names.owns(copy.tasks[0].name));
+}
+
+TEST_F(PersistenceTest, WriteFileAtomicallyCreatesDirectoryAndReplacesFile) {
+    const auto path = m_test_dir / "nested" / "report.txt";
+
+    ASSERT_TRUE(writeFileAtomically(path, "first").has_value());
+    ASSERT_TRUE(writeFileAtomically(path, "second").has_value());
+
+    std::ifstream file(path, std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(contents, "second");
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
 }
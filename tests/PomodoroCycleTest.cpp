@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include "core/PomodoroCycle.h"
+
+using namespace WorkBalance::Core;
+
+TEST(PomodoroCycleTest, PomodoroIsFollowedByShortBreak) {
+    PomodoroCycle cycle;
+    EXPECT_EQ(cycle.advance(TimerMode::Pomodoro, 4, 1), TimerMode::ShortBreak);
+    EXPECT_EQ(cycle.getPomodorosCompleted(), 1);
+}
+
+TEST(PomodoroCycleTest, BreaksAreFollowedByPomodoro) {
+    PomodoroCycle cycle;
+    EXPECT_EQ(cycle.advance(TimerMode::ShortBreak, 4, 1), TimerMode::Pomodoro);
+    EXPECT_EQ(cycle.advance(TimerMode::LongBreak, 4, 2), TimerMode::Pomodoro);
+}
+
+TEST(PomodoroCycleTest, LongBreakAfterConfiguredPomodoros) {
+    PomodoroCycle cycle;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(cycle.advance(TimerMode::Pomodoro, 4, 1), TimerMode::ShortBreak);
+        EXPECT_EQ(cycle.advance(TimerMode::ShortBreak, 4, 1), TimerMode::Pomodoro);
+    }
+    EXPECT_EQ(cycle.advance(TimerMode::Pomodoro, 4, 1), TimerMode::LongBreak);
+}
+
+TEST(PomodoroCycleTest, CycleResetsAfterConfiguredLongBreaks) {
+    PomodoroCycle cycle;
+    EXPECT_EQ(cycle.advance(TimerMode::Pomodoro, 1, 2), TimerMode::LongBreak);
+    EXPECT_EQ(cycle.advance(TimerMode::LongBreak, 1, 2), TimerMode::Pomodoro);
+    EXPECT_EQ(cycle.getLongBreaksTaken(), 1);
+
+    EXPECT_EQ(cycle.advance(TimerMode::Pomodoro, 1, 2), TimerMode::LongBreak);
+    EXPECT_EQ(cycle.advance(TimerMode::LongBreak, 1, 2), TimerMode::Pomodoro);
+    EXPECT_EQ(cycle.getPomodorosCompleted(), 0);
+    EXPECT_EQ(cycle.getLongBreaksTaken(), 0);
+}
+
+TEST(PomodoroCycleTest, ResetClearsProgress) {
+    PomodoroCycle cycle;
+    (void)cycle.advance(TimerMode::Pomodoro, 4, 1);
+    (void)cycle.advance(TimerMode::Pomodoro, 4, 1);
+    cycle.reset();
+    EXPECT_EQ(cycle.getPomodorosCompleted(), 0);
+    EXPECT_EQ(cycle.getLongBreaksTaken(), 0);
+}
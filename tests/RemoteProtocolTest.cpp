@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "core/RemoteProtocol.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+namespace {
+constexpr size_t PREFIX_SIZE = RemoteProtocol::LENGTH_PREFIX_SIZE;
+
+std::span<const std::uint8_t, PREFIX_SIZE> prefixOf(const std::vector<std::uint8_t>& frame) {
+    return std::span<const std::uint8_t, PREFIX_SIZE>{frame.data(), PREFIX_SIZE};
+}
+
+std::span<const std::uint8_t> payloadOf(const std::vector<std::uint8_t>& frame) {
+    return std::span{frame}.subspan(PREFIX_SIZE);
+}
+} // namespace
+
+TEST(RemoteProtocolTest, CommandRoundTrips) {
+    const RemoteCommand command{RemoteAction::StartBreak, BreakKind::Water};
+    const auto frame = RemoteProtocol::encode(command);
+
+    const auto length = RemoteProtocol::decodeLength(prefixOf(frame));
+    ASSERT_TRUE(length.has_value());
+    EXPECT_EQ(*length, frame.size() - PREFIX_SIZE);
+    EXPECT_EQ(RemoteProtocol::decodeCommand(payloadOf(frame)), command);
+}
+
+TEST(RemoteProtocolTest, CommandFramesAreCompact) {
+    const auto frame = RemoteProtocol::encode(RemoteCommand{RemoteAction::ToggleTimer});
+    EXPECT_EQ(frame.size(), PREFIX_SIZE + 3);
+}
+
+TEST(RemoteProtocolTest, ReplyRoundTrips) {
+    const RemoteReply reply{false, "Pomodoro 24:59, paused"};
+    const auto frame = RemoteProtocol::encode(reply);
+
+    ASSERT_EQ(RemoteProtocol::decodeLength(prefixOf(frame)), frame.size() - PREFIX_SIZE);
+    EXPECT_EQ(RemoteProtocol::decodeReply(payloadOf(frame)), reply);
+}
+
+TEST(RemoteProtocolTest, LongReplyMessagesAreTruncated) {
+    const RemoteReply reply{true, std::string(RemoteProtocol::MAX_PAYLOAD_SIZE * 2, 'x')};
+    const auto frame = RemoteProtocol::encode(reply);
+
+    EXPECT_EQ(RemoteProtocol::decodeLength(prefixOf(frame)), RemoteProtocol::MAX_PAYLOAD_SIZE);
+    const auto decoded = RemoteProtocol::decodeReply(payloadOf(frame));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_TRUE(decoded->success);
+    EXPECT_EQ(decoded->message.size(), RemoteProtocol::MAX_PAYLOAD_SIZE - 2);
+}
+
+TEST(RemoteProtocolTest, RejectsOversizedLength) {
+    const std::array<std::uint8_t, PREFIX_SIZE> prefix{0xFF, 0xFF, 0xFF, 0x7F};
+    EXPECT_FALSE(RemoteProtocol::decodeLength(prefix).has_value());
+}
+
+TEST(RemoteProtocolTest, RejectsMalformedCommands) {
+    const std::vector<std::uint8_t> wrong_version{RemoteProtocol::VERSION + 1, 1, 0};
+    const std::vector<std::uint8_t> unknown_action{RemoteProtocol::VERSION, 99, 0};
+    const std::vector<std::uint8_t> unknown_break{RemoteProtocol::VERSION, 3, 99};
+    const std::vector<std::uint8_t> truncated{RemoteProtocol::VERSION, 1};
+
+    EXPECT_FALSE(RemoteProtocol::decodeCommand(wrong_version).has_value());
+    EXPECT_FALSE(RemoteProtocol::decodeCommand(unknown_action).has_value());
+    EXPECT_FALSE(RemoteProtocol::decodeCommand(unknown_break).has_value());
+    EXPECT_FALSE(RemoteProtocol::decodeCommand(truncated).has_value());
+    EXPECT_FALSE(RemoteProtocol::decodeReply(std::vector<std::uint8_t>{RemoteProtocol::VERSION}).has_value());
+}
+
+TEST(RemoteProtocolTest, BreakKindNamesRoundTrip) {
+    for (const auto kind :
+         {BreakKind::ShortBreak, BreakKind::LongBreak, BreakKind::Water, BreakKind::Standup, BreakKind::EyeCare}) {
+        EXPECT_EQ(parseBreakKind(getBreakKindName(kind)), kind);
+    }
+    EXPECT_EQ(parseBreakKind("water"), BreakKind::Water);
+    EXPECT_FALSE(parseBreakKind("coffee").has_value());
+}
+
+TEST(RemoteProtocolTest, QuitCommandRoundTrips) {
+    const auto frame = RemoteProtocol::encode(RemoteCommand{RemoteAction::Quit});
+    EXPECT_EQ(RemoteProtocol::decodeCommand(payloadOf(frame)), RemoteCommand{RemoteAction::Quit});
+}
+
+TEST(RemoteProtocolTest, FormatsSessionStatus) {
+    const SessionStatus status{.mode = TimerMode::ShortBreak,
+                               .state = TimerState::Paused,
+                               .remaining_seconds = 4 * 60 + 5,
+                               .water_glasses = 3,
+                               .water_goal = 8,
+                               .standups = 2,
+                               .eye_breaks = 1};
+    EXPECT_EQ(formatSessionStatus(status), "Short break 04:05 (paused)\nWater 3/8, standups 2, eye breaks 1");
+}
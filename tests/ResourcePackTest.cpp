@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "core/ResourcePack.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+namespace {
+constexpr int COMPRESSION_LEVEL = 3;
+
+std::vector<std::uint8_t> repetitiveBytes(size_t size) {
+    std::vector<std::uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<std::uint8_t>(i % 7);
+    }
+    return bytes;
+}
+
+std::vector<std::uint8_t> randomBytes(size_t size) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<std::uint8_t> bytes(size);
+    for (auto& byte : bytes) {
+        byte = static_cast<std::uint8_t>(distribution(generator));
+    }
+    return bytes;
+}
+
+bool equal(std::span<const std::uint8_t> actual, const std::vector<std::uint8_t>& expected) {
+    return std::ranges::equal(actual, expected);
+}
+} // namespace
+
+TEST(ResourcePackTest, RoundTripsEntries) {
+    const auto sound = repetitiveBytes(10000);
+    const auto font = randomBytes(3000);
+    const std::vector<ResourcePack::Source> sources{{"sounds/click.wav", sound}, {"fonts/a.ttf", font}};
+    const auto blob = ResourcePack::build(sources, COMPRESSION_LEVEL);
+
+    ResourcePack pack(blob);
+    ASSERT_TRUE(pack.isValid());
+    EXPECT_TRUE(equal(pack.get("sounds/click.wav"), sound));
+    EXPECT_TRUE(equal(pack.get("fonts/a.ttf"), font));
+}
+
+TEST(ResourcePackTest, CompressesCompressibleEntries) {
+    const auto sound = repetitiveBytes(100000);
+    const std::vector<ResourcePack::Source> sources{{"sound", sound}};
+    EXPECT_LT(ResourcePack::build(sources, COMPRESSION_LEVEL).size(), sound.size() / 10);
+}
+
+TEST(ResourcePackTest, DecompressesOnlyOnFirstUse) {
+    const auto first = repetitiveBytes(5000);
+    const auto second = repetitiveBytes(8000);
+    const std::vector<ResourcePack::Source> sources{{"first", first}, {"second", second}};
+    const auto blob = ResourcePack::build(sources, COMPRESSION_LEVEL);
+
+    ResourcePack pack(blob);
+    EXPECT_EQ(pack.getDecompressedBytes(), 0U);
+
+    const auto contents = pack.get("first");
+    EXPECT_EQ(pack.getDecompressedBytes(), first.size());
+
+    // Later requests return the cached bytes
+    EXPECT_EQ(pack.get("first").data(), contents.data());
+    EXPECT_EQ(pack.getDecompressedBytes(), first.size());
+}
+
+TEST(ResourcePackTest, IncompressibleEntriesAreServedFromTheBlob) {
+    const auto noise = randomBytes(4096);
+    const std::vector<ResourcePack::Source> sources{{"noise", noise}};
+    const auto blob = ResourcePack::build(sources, COMPRESSION_LEVEL);
+
+    ResourcePack pack(blob);
+    const auto contents = pack.get("noise");
+    EXPECT_TRUE(equal(contents, noise));
+    EXPECT_GE(contents.data(), blob.data());
+    EXPECT_LT(contents.data(), blob.data() + blob.size());
+    EXPECT_EQ(pack.getDecompressedBytes(), 0U);
+}
+
+TEST(ResourcePackTest, MissingEntryIsEmpty) {
+    const auto data = repetitiveBytes(100);
+    const std::vector<ResourcePack::Source> sources{{"present", data}};
+    const auto blob = ResourcePack::build(sources, COMPRESSION_LEVEL);
+
+    ResourcePack pack(blob);
+    EXPECT_TRUE(pack.contains("present"));
+    EXPECT_FALSE(pack.contains("absent"));
+    EXPECT_TRUE(pack.get("absent").empty());
+}
+
+TEST(ResourcePackTest, RejectsMalformedBlob) {
+    const auto data = repetitiveBytes(1000);
+    const std::vector<ResourcePack::Source> sources{{"entry", data}};
+    auto blob = ResourcePack::build(sources, COMPRESSION_LEVEL);
+
+    const std::vector<std::uint8_t> truncated(blob.begin(), blob.begin() + 20);
+    EXPECT_FALSE(ResourcePack(truncated).isValid());
+
+    blob[0] ^= 0xFFU;
+    ResourcePack bad_magic(blob);
+    EXPECT_FALSE(bad_magic.isValid());
+    EXPECT_TRUE(bad_magic.get("entry").empty());
+}
+
+TEST(ResourcePackTest, CorruptEntryIsEmpty) {
+    const auto data = repetitiveBytes(1000);
+    const std::vector<ResourcePack::Source> sources{{"entry", data}};
+    auto blob = ResourcePack::build(sources, COMPRESSION_LEVEL);
+    std::fill(blob.end() - 8, blob.end(), std::uint8_t{0xFF});
+
+    ResourcePack pack(blob);
+    ASSERT_TRUE(pack.isValid());
+    EXPECT_TRUE(pack.get("entry").empty());
+}
+
+TEST(ResourcePackTest, ConcurrentFirstUseDecompressesOnce) {
+    const auto data = repetitiveBytes(200000);
+    const std::vector<ResourcePack::Source> sources{{"entry", data}};
+    const auto blob = ResourcePack::build(sources, COMPRESSION_LEVEL);
+    ResourcePack pack(blob);
+
+    std::vector<const std::uint8_t*> seen(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < seen.size(); ++i) {
+        threads.emplace_back([&pack, &seen, i] { seen[i] = pack.get("entry").data(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(std::ranges::all_of(seen, [&](const std::uint8_t* data) { return data == seen.front(); }));
+    EXPECT_EQ(pack.getDecompressedBytes(), data.size());
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "system/SingleInstance.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace WorkBalance;
+using System::SingleInstance;
+
+class SingleInstanceTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        m_test_dir = std::filesystem::temp_directory_path() / "workbalance_single_instance_test";
+        std::filesystem::remove_all(m_test_dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_test_dir);
+    }
+
+    std::filesystem::path m_test_dir;
+};
+
+TEST_F(SingleInstanceTest, FirstInstanceIsPrimary) {
+    const SingleInstance first(m_test_dir);
+    const SingleInstance second(m_test_dir);
+
+    EXPECT_TRUE(first.isPrimary());
+    EXPECT_FALSE(second.isPrimary());
+}
+
+TEST_F(SingleInstanceTest, LockIsReleasedWithThePrimary) {
+    {
+        const SingleInstance first(m_test_dir);
+        ASSERT_TRUE(first.isPrimary());
+    }
+    const SingleInstance next(m_test_dir);
+    EXPECT_TRUE(next.isPrimary());
+}
+
+TEST_F(SingleInstanceTest, ForwardsCommandsToThePrimary) {
+    SingleInstance primary(m_test_dir);
+    ASSERT_TRUE(primary.isPrimary());
+
+    std::atomic<bool> done{false};
+    Core::RemoteCommand received;
+    std::thread server([&] {
+        while (!done) {
+            primary.processCommands([&](const Core::RemoteCommand& command) {
+                received = command;
+                return Core::RemoteReply{true, "Pomodoro 25:00"};
+            });
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    });
+
+    const SingleInstance secondary(m_test_dir);
+    const auto reply = secondary.send({Core::RemoteAction::StartBreak, Core::BreakKind::EyeCare});
+    done = true;
+    server.join();
+
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_TRUE(reply->success);
+    EXPECT_EQ(reply->message, "Pomodoro 25:00");
+    EXPECT_EQ(received, (Core::RemoteCommand{Core::RemoteAction::StartBreak, Core::BreakKind::EyeCare}));
+}
+
+TEST_F(SingleInstanceTest, SendTimesOutWithoutAListener) {
+    const SingleInstance lone(m_test_dir);
+    std::filesystem::remove(m_test_dir / SingleInstance::SOCKET_FILENAME);
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto reply = lone.send({Core::RemoteAction::Status}, std::chrono::milliseconds{50});
+    EXPECT_FALSE(reply.has_value());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{1});
+}
+
+TEST_F(SingleInstanceTest, ProcessCommandsDoesNotBlockWhenIdle) {
+    SingleInstance primary(m_test_dir);
+    bool called = false;
+
+    const auto start = std::chrono::steady_clock::now();
+    primary.processCommands([&](const Core::RemoteCommand&) {
+        called = true;
+        return Core::RemoteReply{};
+    });
+    EXPECT_FALSE(called);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{50});
+}
+
+TEST_F(SingleInstanceTest, StalledClientDoesNotBlockOthers) {
+#ifdef _WIN32
+    GTEST_SKIP() << "Uses a POSIX socket to play the stalled client";
+#else
+    SingleInstance primary(m_test_dir);
+    ASSERT_TRUE(primary.isPrimary());
+
+    // Connects and sends half a length prefix, then goes quiet
+    const int stalled = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_GE(stalled, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string path = (m_test_dir / SingleInstance::SOCKET_FILENAME).string();
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+    ASSERT_EQ(::connect(stalled, reinterpret_cast<const sockaddr*>(&address), sizeof(address)), 0);
+    const std::uint8_t partial[2] = {0, 0};
+    ASSERT_EQ(::send(stalled, partial, sizeof(partial), 0), 2);
+
+    std::atomic<bool> done{false};
+    std::atomic<std::int64_t> slowest_call_us{0};
+    std::thread server([&] {
+        while (!done) {
+            const auto start = std::chrono::steady_clock::now();
+            primary.processCommands([](const Core::RemoteCommand&) { return Core::RemoteReply{true, "ok"}; });
+            const auto elapsed =
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            if (elapsed.count() > slowest_call_us) {
+                slowest_call_us = elapsed.count();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    });
+
+    const SingleInstance secondary(m_test_dir);
+    const auto reply = secondary.send({Core::RemoteAction::Status});
+    done = true;
+    server.join();
+    ::close(stalled);
+
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->message, "ok");
+    EXPECT_LT(slowest_call_us.load(), std::chrono::microseconds{std::chrono::milliseconds{50}}.count());
+#endif
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "app/StartupProfiler.h"
+
+using namespace WorkBalance::App;
+using namespace std::chrono_literals;
+using Clock = StartupProfiler::Clock;
+
+TEST(StartupProfilerTest, LapsAreConsecutivePhases) {
+    const auto origin = Clock::time_point{};
+    StartupProfiler profiler(origin);
+
+    profiler.lap("glfw_init", origin + 5ms);
+    profiler.lap("main_window", origin + 20ms);
+
+    const auto& phases = profiler.getPhases();
+    ASSERT_EQ(phases.size(), 2);
+    EXPECT_EQ(phases[0].name, "glfw_init");
+    EXPECT_DOUBLE_EQ(phases[0].start_ms, 0.0);
+    EXPECT_DOUBLE_EQ(phases[0].duration_ms, 5.0);
+    EXPECT_EQ(phases[1].name, "main_window");
+    EXPECT_DOUBLE_EQ(phases[1].start_ms, 5.0);
+    EXPECT_DOUBLE_EQ(phases[1].duration_ms, 15.0);
+}
+
+TEST(StartupProfilerTest, FirstFrameIsRecordedOnce) {
+    const auto origin = Clock::time_point{};
+    StartupProfiler profiler(origin);
+    EXPECT_FALSE(profiler.getTimeToFirstFrame().has_value());
+
+    profiler.markFirstFrame(origin + 120ms);
+    profiler.markFirstFrame(origin + 500ms);
+
+    ASSERT_TRUE(profiler.getTimeToFirstFrame().has_value());
+    EXPECT_DOUBLE_EQ(*profiler.getTimeToFirstFrame(), 120.0);
+}
+
+TEST(StartupProfilerTest, CheckpointWithoutProfilerIsNoOp) {
+    const StartupProfiler::Checkpoint checkpoint(nullptr, "unused");
+    (void)checkpoint;
+}
+
+TEST(StartupProfilerTest, CheckpointLapsProfiler) {
+    StartupProfiler profiler;
+    const StartupProfiler::Checkpoint checkpoint(&profiler, "phase");
+    (void)checkpoint;
+
+    ASSERT_EQ(profiler.getPhases().size(), 1);
+    EXPECT_EQ(profiler.getPhases()[0].name, "phase");
+}
+
+TEST(StartupProfilerTest, JsonReport) {
+    const auto origin = Clock::time_point{};
+    StartupProfiler profiler(origin);
+    profiler.lap("fonts", origin + 1500us);
+    profiler.addValue("font_atlas_from_cache", 1);
+    profiler.markFirstFrame(origin + 40ms);
+
+    EXPECT_EQ(profiler.toJson(), "{\"phases\":[{\"name\":\"fonts\",\"start_ms\":0.000,\"duration_ms\":1.500}],"
+                                 "\"values\":{\"font_atlas_from_cache\":1},\"time_to_first_frame_ms\":40.000}");
+}
+
+TEST(StartupProfilerTest, JsonReportEscapesNames) {
+    const auto origin = Clock::time_point{};
+    StartupProfiler profiler(origin);
+    profiler.addValue("say \"hi\"\n\x01", 2);
+
+    EXPECT_NE(profiler.toJson().find(R"("say \"hi\"\n\u0001":2)"), std::string::npos);
+}
+
+TEST(StartupProfilerTest, JsonReportWithoutFirstFrame) {
+    StartupProfiler profiler;
+    EXPECT_EQ(profiler.toJson(), "{\"phases\":[],\"values\":{},\"time_to_first_frame_ms\":null}");
+}
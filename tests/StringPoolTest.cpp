@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "core/StringPool.h"
+
+#include <string>
+#include <utility>
+
+using namespace WorkBalance::Core;
+
+class StringPoolTest : public ::testing::Test {
+  protected:
+    StringPool pool;
+};
+
+TEST_F(StringPoolTest, InternCopiesIntoPool) {
+    std::string source = "Write report";
+    const auto view = pool.intern(source);
+
+    source = "changed";
+
+    EXPECT_EQ(view, "Write report");
+    EXPECT_TRUE(pool.owns(view));
+    EXPECT_EQ(pool.bytesUsed(), 12u);
+}
+
+TEST_F(StringPoolTest, EmptyStringIsNotStored) {
+    const auto view = pool.intern("");
+
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(pool.bytesUsed(), 0u);
+    EXPECT_EQ(pool.chunkCount(), 0u);
+}
+
+TEST_F(StringPoolTest, SmallStringsAreInterned) {
+    const auto first = pool.intern("Email");
+    const auto second = pool.intern(std::string("Email"));
+
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(pool.bytesUsed(), 5u);
+}
+
+TEST_F(StringPoolTest, LongStringsAreNotDeduplicated) {
+    const std::string long_name(StringPool::SMALL_STRING_MAX + 1, 'x');
+
+    const auto first = pool.intern(long_name);
+    const auto second = pool.intern(long_name);
+
+    EXPECT_NE(first.data(), second.data());
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(StringPoolTest, OversizedStringGetsDedicatedChunk) {
+    StringPool small_pool{8};
+    const std::string big(64, 'a');
+
+    const auto view = small_pool.intern(big);
+
+    EXPECT_EQ(view, big);
+    EXPECT_GE(small_pool.bytesReserved(), big.size());
+}
+
+TEST_F(StringPoolTest, ViewsSurviveNewChunks) {
+    StringPool small_pool{16};
+    const auto first = small_pool.intern("first string");
+
+    for (int i = 0; i < 100; ++i) {
+        (void)small_pool.intern("filler " + std::to_string(i));
+    }
+
+    EXPECT_GT(small_pool.chunkCount(), 1u);
+    EXPECT_EQ(first, "first string");
+}
+
+TEST_F(StringPoolTest, ViewsSurviveMove) {
+    const auto view = pool.intern("Moved name");
+
+    StringPool moved = std::move(pool);
+
+    EXPECT_EQ(view, "Moved name");
+    EXPECT_TRUE(moved.owns(view));
+}
+
+TEST_F(StringPoolTest, OwnsRejectsForeignStrings) {
+    (void)pool.intern("inside");
+
+    EXPECT_FALSE(pool.owns("outside"));
+    EXPECT_FALSE(pool.owns(std::string_view{}));
+}
+
+TEST_F(StringPoolTest, ClearReleasesStorage) {
+    (void)pool.intern("Task");
+
+    pool.clear();
+
+    EXPECT_EQ(pool.bytesUsed(), 0u);
+    EXPECT_EQ(pool.bytesReserved(), 0u);
+    EXPECT_EQ(pool.chunkCount(), 0u);
+}
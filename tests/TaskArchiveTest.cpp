@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include "core/TaskArchive.h"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace WorkBalance::Core;
+
+class TaskArchiveTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        m_test_dir = std::filesystem::temp_directory_path() / "workbalance_archive_test";
+        std::filesystem::remove_all(m_test_dir);
+        m_archive_path = m_test_dir / TaskArchive::DEFAULT_FILENAME;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_test_dir);
+    }
+
+    std::filesystem::path m_test_dir;
+    std::filesystem::path m_archive_path;
+};
+
+TEST_F(TaskArchiveTest, MissingFileIsEmptyArchive) {
+    TaskArchive archive(m_archive_path);
+
+    auto count = archive.size();
+    ASSERT_TRUE(count.has_value());
+    EXPECT_EQ(*count, 0);
+    EXPECT_FALSE(std::filesystem::exists(m_archive_path));
+}
+
+TEST_F(TaskArchiveTest, AppendDoesNotLoadIndex) {
+    TaskArchive archive(m_archive_path);
+    const std::vector<Task> tasks{{"Done", true, 2, 2, 1000}};
+
+    ASSERT_TRUE(archive.append(tasks).has_value());
+    EXPECT_FALSE(archive.isIndexLoaded());
+    EXPECT_TRUE(std::filesystem::exists(m_archive_path));
+}
+
+TEST_F(TaskArchiveTest, SearchFindsAppendedTasksNewestFirst) {
+    TaskArchive archive(m_archive_path);
+    const std::vector<Task> tasks{{"Write report", true, 2, 2, 1000}, {"Review code", true, 1, 1, 2000},
+                                  {"Write tests", true, 3, 3, 3000}};
+    ASSERT_TRUE(archive.append(tasks).has_value());
+
+    auto results = archive.search("WRITE");
+    ASSERT_TRUE(results.has_value());
+    ASSERT_EQ(results->size(), 2);
+    EXPECT_EQ((*results)[0].name, "Write tests");
+    EXPECT_EQ((*results)[0].estimated_pomodoros, 3);
+    EXPECT_EQ((*results)[0].completed_at, 3000);
+    EXPECT_EQ((*results)[1].name, "Write report");
+}
+
+TEST_F(TaskArchiveTest, SearchRespectsLimit) {
+    TaskArchive archive(m_archive_path);
+    std::vector<Task> tasks(10, Task{"Task", true, 1, 1, 1000});
+    ASSERT_TRUE(archive.append(tasks).has_value());
+
+    auto results = archive.search("", 3);
+    ASSERT_TRUE(results.has_value());
+    EXPECT_EQ(results->size(), 3);
+}
+
+TEST_F(TaskArchiveTest, IndexIsRebuiltFromFile) {
+    {
+        TaskArchive archive(m_archive_path);
+        ASSERT_TRUE(archive.append(std::vector<Task>{{"First", true, 1, 1, 1000}}).has_value());
+        ASSERT_TRUE(archive.append(std::vector<Task>{{"Second", true, 4, 5, 2000}}).has_value());
+    }
+
+    TaskArchive reopened(m_archive_path);
+    auto results = reopened.search("");
+    ASSERT_TRUE(results.has_value());
+    ASSERT_EQ(results->size(), 2);
+    EXPECT_EQ((*results)[0].name, "Second");
+    EXPECT_EQ((*results)[0].completed_pomodoros, 5);
+    EXPECT_EQ((*results)[1].name, "First");
+}
+
+TEST_F(TaskArchiveTest, AppendAfterIndexLoadIsSearchable) {
+    TaskArchive archive(m_archive_path);
+    ASSERT_TRUE(archive.append(std::vector<Task>{{"Before", true, 1, 1, 1000}}).has_value());
+    ASSERT_TRUE(archive.size().has_value());
+
+    ASSERT_TRUE(archive.append(std::vector<Task>{{"After", true, 1, 1, 2000}}).has_value());
+    auto results = archive.search("after");
+    ASSERT_TRUE(results.has_value());
+    ASSERT_EQ(results->size(), 1);
+
+    // Ids of in-memory appends must match what a fresh reader computes
+    TaskArchive reopened(m_archive_path);
+    auto reread = reopened.search("after");
+    ASSERT_TRUE(reread.has_value());
+    ASSERT_EQ(reread->size(), 1);
+    EXPECT_EQ((*reread)[0].id, (*results)[0].id);
+}
+
+TEST_F(TaskArchiveTest, RestoreRemovesTaskPersistently) {
+    TaskArchive archive(m_archive_path);
+    ASSERT_TRUE(archive.append(std::vector<Task>{{"Keep", true, 1, 1, 1000}, {"Bring back", true, 2, 2, 2000}})
+                    .has_value());
+
+    auto results = archive.search("bring");
+    ASSERT_TRUE(results.has_value());
+    ASSERT_EQ(results->size(), 1);
+
+    auto restored = archive.restore((*results)[0].id);
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->name, "Bring back");
+    EXPECT_EQ(restored->estimated_pomodoros, 2);
+    EXPECT_EQ(*archive.size(), 1);
+
+    TaskArchive reopened(m_archive_path);
+    EXPECT_EQ(*reopened.size(), 1);
+    EXPECT_TRUE(reopened.search("bring")->empty());
+}
+
+TEST_F(TaskArchiveTest, RestoreUnknownIdFails) {
+    TaskArchive archive(m_archive_path);
+    ASSERT_TRUE(archive.append(std::vector<Task>{{"Task", true, 1, 1, 1000}}).has_value());
+
+    auto restored = archive.restore(12345);
+    ASSERT_FALSE(restored.has_value());
+    EXPECT_EQ(restored.error(), PersistenceError::EntryNotFound);
+}
+
+TEST_F(TaskArchiveTest, NamesWithSeparatorsRoundTrip) {
+    TaskArchive archive(m_archive_path);
+    const std::string tricky = "Tab\there\nnew line \\ backslash";
+    ASSERT_TRUE(archive.append(std::vector<Task>{{tricky, true, 1, 1, 1000}}).has_value());
+
+    TaskArchive reopened(m_archive_path);
+    auto results = reopened.search("");
+    ASSERT_TRUE(results.has_value());
+    ASSERT_EQ(results->size(), 1);
+    EXPECT_EQ((*results)[0].name, tricky);
+}
+
+TEST_F(TaskArchiveTest, TornTrailingRecordIsIgnored) {
+    {
+        TaskArchive archive(m_archive_path);
+        ASSERT_TRUE(archive.append(std::vector<Task>{{"Complete", true, 1, 1, 1000}}).has_value());
+    }
+    {
+        std::ofstream file(m_archive_path, std::ios::binary | std::ios::app);
+        file << "A\t2000\t1\t";
+    }
+
+    TaskArchive reopened(m_archive_path);
+    EXPECT_EQ(*reopened.size(), 1);
+
+    ASSERT_TRUE(reopened.append(std::vector<Task>{{"Next", true, 1, 1, 3000}}).has_value());
+    TaskArchive again(m_archive_path);
+    EXPECT_EQ(again.search("next")->size(), 1);
+}
+
+TEST_F(TaskArchiveTest, ArchivesTasksTakenFromManager) {
+    TaskManager manager;
+    manager.addTask("Old", 1);
+    manager.addTask("Active", 2);
+    manager.addTask("Recent", 1);
+    manager.getTask(0)->completed = true;
+    manager.getTask(0)->completed_at = 1000;
+    manager.getTask(2)->completed = true;
+    manager.getTask(2)->completed_at = 5000;
+
+    TaskArchive archive(m_archive_path);
+    const auto stale = manager.takeCompletedBefore(2000);
+    ASSERT_TRUE(archive.append(stale).has_value());
+
+    EXPECT_EQ(manager.getTaskCount(), 2);
+    auto results = archive.search("old");
+    ASSERT_TRUE(results.has_value());
+    ASSERT_EQ(results->size(), 1);
+    EXPECT_EQ((*results)[0].completed_at, 1000);
+}
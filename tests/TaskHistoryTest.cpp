@@ -0,0 +1,422 @@
+#include <gtest/gtest.h>
+#include "core/ITimeSource.h"
+#include "core/Task.h"
+#include "core/TaskHistory.h"
+
+#include <string>
+
+using namespace WorkBalance::Core;
+using namespace std::chrono_literals;
+
+class TaskHistoryTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        time_source = std::make_shared<MockTimeSource>();
+        manager = std::make_unique<TaskManager>(time_source);
+    }
+
+    // Move past the coalesce window so the next edit starts its own undo step
+    void pause() {
+        time_source->advance(TaskHistory::DEFAULT_COALESCE_WINDOW + 1ms);
+    }
+
+    std::shared_ptr<MockTimeSource> time_source;
+    std::unique_ptr<TaskManager> manager;
+};
+
+TEST_F(TaskHistoryTest, InitiallyEmpty) {
+    EXPECT_FALSE(manager->canUndo());
+    EXPECT_FALSE(manager->canRedo());
+    EXPECT_FALSE(manager->undo());
+    EXPECT_FALSE(manager->redo());
+}
+
+TEST_F(TaskHistoryTest, UndoAddRemovesTask) {
+    manager->addTask("Task 1", 2);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTaskCount(), 0);
+    EXPECT_EQ(manager->getTargetPomodoros(), 0);
+
+    EXPECT_TRUE(manager->redo());
+    ASSERT_EQ(manager->getTaskCount(), 1);
+    EXPECT_EQ(manager->getTask(0)->name, "Task 1");
+    EXPECT_EQ(manager->getTask(0)->estimated_pomodoros, 2);
+}
+
+TEST_F(TaskHistoryTest, UndoRemoveRestoresTaskAtOriginalPosition) {
+    manager->addTask("Task 1");
+    manager->addTask("Task 2", 3);
+    manager->addTask("Task 3");
+    manager->incrementTaskPomodoros(1);
+    pause();
+
+    manager->removeTask(1);
+    ASSERT_EQ(manager->getTaskCount(), 2);
+
+    EXPECT_TRUE(manager->undo());
+    ASSERT_EQ(manager->getTaskCount(), 3);
+    EXPECT_EQ(manager->getTask(1)->name, "Task 2");
+    EXPECT_EQ(manager->getTask(1)->estimated_pomodoros, 3);
+    EXPECT_EQ(manager->getTask(1)->completed_pomodoros, 1);
+    EXPECT_EQ(manager->getTask(2)->name, "Task 3");
+}
+
+TEST_F(TaskHistoryTest, UndoRemoveKeepsCompletionTime) {
+    constexpr std::int64_t completed_at = 1'700'000'000;
+    manager->restoreTask(Task{"Old", true, 1, 1, completed_at});
+    manager->addTask("Open");
+    pause();
+
+    manager->removeTask(0);
+    ASSERT_TRUE(manager->undo());
+
+    ASSERT_EQ(manager->getTaskCount(), 2);
+    EXPECT_EQ(manager->getTask(0)->completed_at, completed_at);
+    const auto stale = manager->getCompletedBefore(completed_at + 1);
+    ASSERT_EQ(stale.size(), 1);
+    EXPECT_EQ(stale.front().name, "Old");
+
+    // Redo and undo again must not reset it either
+    ASSERT_TRUE(manager->redo());
+    ASSERT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->completed_at, completed_at);
+}
+
+TEST_F(TaskHistoryTest, UndoToggleRestoresCompletionTime) {
+    constexpr std::int64_t completed_at = 1'700'000'000;
+    manager->restoreTask(Task{"Old", true, 2, 0, completed_at});
+    pause();
+
+    manager->toggleTaskCompletion(0);
+    ASSERT_FALSE(manager->getTask(0)->completed);
+    ASSERT_TRUE(manager->undo());
+
+    EXPECT_TRUE(manager->getTask(0)->completed);
+    EXPECT_EQ(manager->getTask(0)->completed_at, completed_at);
+}
+
+TEST_F(TaskHistoryTest, UndoUpdateRestoresAllFields) {
+    manager->addTask("Original", 2);
+    pause();
+
+    manager->updateTask(0, "Renamed", 1, 1);
+    EXPECT_TRUE(manager->getTask(0)->completed);
+
+    EXPECT_TRUE(manager->undo());
+    const Task* task = manager->getTask(0);
+    EXPECT_EQ(task->name, "Original");
+    EXPECT_EQ(task->estimated_pomodoros, 2);
+    EXPECT_EQ(task->completed_pomodoros, 0);
+    EXPECT_FALSE(task->completed);
+
+    EXPECT_TRUE(manager->redo());
+    EXPECT_EQ(manager->getTask(0)->name, "Renamed");
+    EXPECT_TRUE(manager->getTask(0)->completed);
+}
+
+TEST_F(TaskHistoryTest, UpdateWithoutChangesIsNotRecorded) {
+    manager->addTask("Task", 2);
+    pause();
+
+    manager->updateTask(0, "Task", 2, 0);
+    EXPECT_EQ(manager->getHistory().undoCount(), 1);
+}
+
+TEST_F(TaskHistoryTest, UndoToggleAndIncrement) {
+    manager->addTask("Task", 2);
+    pause();
+    manager->toggleTaskCompletion(0);
+    pause();
+    manager->incrementTaskPomodoros(0);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->completed_pomodoros, 0);
+    EXPECT_TRUE(manager->getTask(0)->completed);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_FALSE(manager->getTask(0)->completed);
+    EXPECT_EQ(manager->getTargetPomodoros(), 2);
+}
+
+TEST_F(TaskHistoryTest, UndoMoveRestoresOrder) {
+    manager->addTask("A");
+    manager->addTask("B");
+    manager->addTask("C");
+    pause();
+
+    manager->moveTask(0, 2);
+    EXPECT_EQ(manager->getTask(2)->name, "A");
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->name, "A");
+    EXPECT_EQ(manager->getTask(1)->name, "B");
+    EXPECT_EQ(manager->getTask(2)->name, "C");
+
+    EXPECT_TRUE(manager->redo());
+    EXPECT_EQ(manager->getTask(0)->name, "B");
+    EXPECT_EQ(manager->getTask(2)->name, "A");
+}
+
+TEST_F(TaskHistoryTest, NewEditDiscardsRedo) {
+    manager->addTask("Task 1");
+    pause();
+    manager->addTask("Task 2");
+    EXPECT_TRUE(manager->undo());
+    EXPECT_TRUE(manager->canRedo());
+
+    manager->addTask("Task 3");
+    EXPECT_FALSE(manager->canRedo());
+}
+
+TEST_F(TaskHistoryTest, RapidEditsToSameTaskCoalesce) {
+    manager->addTask("Task", 4);
+    pause();
+
+    for (int i = 0; i < 3; ++i) {
+        time_source->advance(100ms);
+        manager->incrementTaskPomodoros(0);
+    }
+    time_source->advance(100ms);
+    manager->updateTask(0, "Renamed", 5, 3);
+
+    EXPECT_EQ(manager->getHistory().undoCount(), 2);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->name, "Task");
+    EXPECT_EQ(manager->getTask(0)->estimated_pomodoros, 4);
+    EXPECT_EQ(manager->getTask(0)->completed_pomodoros, 0);
+}
+
+TEST_F(TaskHistoryTest, EditsOutsideWindowDoNotCoalesce) {
+    manager->addTask("Task", 4);
+    pause();
+    manager->incrementTaskPomodoros(0);
+    pause();
+    manager->incrementTaskPomodoros(0);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->completed_pomodoros, 1);
+}
+
+TEST_F(TaskHistoryTest, BreakCoalescingStartsNewStep) {
+    manager->addTask("Task", 4);
+    pause();
+    manager->incrementTaskPomodoros(0);
+    manager->getHistory().breakCoalescing();
+    manager->incrementTaskPomodoros(0);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->completed_pomodoros, 1);
+}
+
+TEST_F(TaskHistoryTest, ChainedMovesCoalesce) {
+    manager->addTask("A");
+    manager->addTask("B");
+    manager->addTask("C");
+    pause();
+
+    // Dragging A down one row at a time
+    manager->moveTask(0, 1);
+    manager->moveTask(1, 2);
+    EXPECT_EQ(manager->getHistory().undoCount(), 4);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->name, "A");
+    EXPECT_EQ(manager->getTask(1)->name, "B");
+}
+
+TEST_F(TaskHistoryTest, MoveBackToStartIsDropped) {
+    manager->addTask("A");
+    manager->addTask("B");
+    pause();
+
+    manager->moveTask(0, 1);
+    manager->moveTask(1, 0);
+    EXPECT_EQ(manager->getHistory().undoCount(), 2);
+}
+
+TEST_F(TaskHistoryTest, ToggleBackToStartIsDropped) {
+    manager->addTask("A");
+    manager->addTask("B");
+    pause();
+
+    manager->toggleTaskCompletion(1);
+    manager->toggleTaskCompletion(1);
+    EXPECT_EQ(manager->getHistory().undoCount(), 2);
+
+    // The next toggle starts a step of its own instead of merging into the previous task's
+    manager->toggleTaskCompletion(1);
+    EXPECT_TRUE(manager->undo());
+    EXPECT_FALSE(manager->getTask(1)->completed);
+    EXPECT_EQ(manager->getHistory().undoCount(), 2);
+}
+
+TEST_F(TaskHistoryTest, RenameBackToStartIsDropped) {
+    manager->addTask("Task", 3);
+    pause();
+
+    manager->updateTask(0, "Renamed", 3, 0);
+    manager->updateTask(0, "Task", 3, 0);
+    EXPECT_EQ(manager->getHistory().undoCount(), 1);
+}
+
+TEST_F(TaskHistoryTest, TimerIncrementIsNotUndoable) {
+    manager->addTask("Task", 3);
+    pause();
+
+    manager->incrementTaskPomodoros(0, false);
+    EXPECT_EQ(manager->getHistory().undoCount(), 1);
+
+    // Undoing the add is the only step left
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTaskCount(), 0);
+}
+
+TEST_F(TaskHistoryTest, TimerIncrementDoesNotMergeIntoUserEdit) {
+    manager->addTask("Task", 3);
+    pause();
+
+    manager->updateTask(0, "Renamed", 3, 0);
+    manager->incrementTaskPomodoros(0, false);
+    manager->updateTask(0, "Renamed", 4, 1);
+    EXPECT_EQ(manager->getHistory().undoCount(), 3);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTask(0)->estimated_pomodoros, 3);
+    EXPECT_EQ(manager->getTask(0)->completed_pomodoros, 1);
+    EXPECT_EQ(manager->getTask(0)->name, "Renamed");
+}
+
+TEST_F(TaskHistoryTest, ClearIsUndoneAsOneStep) {
+    manager->addTask("A", 1);
+    manager->addTask("B", 2);
+    manager->addTask("C", 3);
+    pause();
+
+    manager->clear();
+    EXPECT_EQ(manager->getTaskCount(), 0);
+
+    EXPECT_TRUE(manager->undo());
+    ASSERT_EQ(manager->getTaskCount(), 3);
+    EXPECT_EQ(manager->getTask(0)->name, "A");
+    EXPECT_EQ(manager->getTask(1)->name, "B");
+    EXPECT_EQ(manager->getTask(2)->name, "C");
+    EXPECT_EQ(manager->getTargetPomodoros(), 6);
+
+    EXPECT_TRUE(manager->redo());
+    EXPECT_EQ(manager->getTaskCount(), 0);
+}
+
+TEST_F(TaskHistoryTest, BatchIsUndoneTogether) {
+    manager->addTask("A");
+    pause();
+
+    manager->beginBatch();
+    manager->addTask("B");
+    manager->addTask("C");
+    manager->moveTask(2, 0);
+    manager->endBatch();
+
+    EXPECT_TRUE(manager->undo());
+    ASSERT_EQ(manager->getTaskCount(), 1);
+    EXPECT_EQ(manager->getTask(0)->name, "A");
+
+    EXPECT_TRUE(manager->redo());
+    ASSERT_EQ(manager->getTaskCount(), 3);
+    EXPECT_EQ(manager->getTask(0)->name, "C");
+}
+
+TEST_F(TaskHistoryTest, UndoneNamesSurviveManagerCompaction) {
+    const std::string long_name(1024, 'x');
+    manager->getHistory().setMemoryLimit(1024 * 1024);
+    manager->addTask(long_name);
+    pause();
+
+    // Enough renames to force the manager to rebuild its name arena
+    for (int i = 0; i < 200; ++i) {
+        manager->getHistory().breakCoalescing();
+        manager->updateTask(0, long_name + std::to_string(i), 1, 0);
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_TRUE(manager->undo());
+    }
+    EXPECT_EQ(manager->getTask(0)->name, long_name);
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTaskCount(), 0);
+}
+
+TEST_F(TaskHistoryTest, RenameHistoryRoundTrips) {
+    manager->getHistory().setMemoryLimit(1024 * 1024);
+    manager->addTask("Name 0");
+    for (int i = 1; i <= 50; ++i) {
+        pause();
+        manager->updateTask(0, "Name " + std::to_string(i), 1, 0);
+    }
+
+    for (int i = 49; i >= 0; --i) {
+        ASSERT_TRUE(manager->undo());
+        EXPECT_EQ(manager->getTask(0)->name, "Name " + std::to_string(i));
+    }
+    for (int i = 1; i <= 50; ++i) {
+        ASSERT_TRUE(manager->redo());
+        EXPECT_EQ(manager->getTask(0)->name, "Name " + std::to_string(i));
+    }
+}
+
+TEST_F(TaskHistoryTest, MemoryLimitDropsOldestSteps) {
+    manager->getHistory().setMemoryLimit(sizeof(TaskEdit) * 10);
+    for (int i = 0; i < 50; ++i) {
+        manager->addTask("Task");
+        pause();
+    }
+
+    EXPECT_LE(manager->getHistory().memoryUsage(), sizeof(TaskEdit) * 10);
+    EXPECT_EQ(manager->getHistory().undoCount(), 10);
+
+    while (manager->undo()) {
+    }
+    EXPECT_EQ(manager->getTaskCount(), 40);
+}
+
+TEST_F(TaskHistoryTest, MemoryLimitKeepsNewestBatch) {
+    for (int i = 0; i < 20; ++i) {
+        manager->addTask("Task");
+    }
+    manager->getHistory().setMemoryLimit(sizeof(TaskEdit) * 4);
+    pause();
+
+    manager->clear();
+    EXPECT_EQ(manager->getHistory().undoCount(), 20);
+
+    EXPECT_TRUE(manager->undo());
+    EXPECT_EQ(manager->getTaskCount(), 20);
+}
+
+TEST_F(TaskHistoryTest, AdoptTasksClearsHistory) {
+    manager->addTask("Task");
+    manager->adoptTasks({}, StringPool{});
+    EXPECT_FALSE(manager->canUndo());
+}
+
+TEST(TaskHistoryStandaloneTest, NamesAreCopiedIntoHistory) {
+    TaskHistory history;
+    std::string name = "Temporary";
+
+    TaskEdit edit;
+    edit.kind = TaskEdit::Kind::Removed;
+    edit.fields = TaskEdit::AllFields;
+    edit.name = name;
+    history.record(edit);
+    name.assign("Overwritten");
+
+    std::string restored;
+    EXPECT_TRUE(history.undo([&](TaskEdit& undone) {
+        restored = undone.name;
+        undone.kind = TaskEdit::Kind::Added;
+        undone.fields = 0;
+    }));
+    EXPECT_EQ(restored, "Temporary");
+    EXPECT_TRUE(history.canRedo());
+}
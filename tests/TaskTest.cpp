@@ -199,3 +199,131 @@ TEST_F(TaskManagerTest, MutableTaskAccess) {
 
     EXPECT_EQ(manager.getTask(0)->name, "Modified");
 }
+
+TEST_F(TaskManagerTest, TaskNamesAreOwnedByManager) {
+    std::string name = "Temporary";
+    manager.addTask(name);
+
+    name = "Overwritten";
+
+    EXPECT_EQ(manager.getTask(0)->name, "Temporary");
+    EXPECT_TRUE(manager.getNamePool().owns(manager.getTask(0)->name));
+}
+
+TEST_F(TaskManagerTest, AdoptTasksTakesArenaWithoutCopying) {
+    StringPool names;
+    std::vector<Task> tasks;
+    tasks.push_back(Task{names.intern("Loaded 1"), false, 2, 1});
+    tasks.push_back(Task{names.intern("Loaded 2"), true, 1, 1});
+    const char* const original_storage = tasks[0].name.data();
+
+    manager.adoptTasks(std::move(tasks), std::move(names));
+
+    ASSERT_EQ(manager.getTaskCount(), 2u);
+    EXPECT_EQ(manager.getTask(0)->name.data(), original_storage);
+    EXPECT_EQ(manager.getTask(1)->name, "Loaded 2");
+    EXPECT_EQ(manager.getTargetPomodoros(), 2);
+    EXPECT_EQ(manager.getCompletedPomodoros(), 2);
+}
+
+TEST_F(TaskManagerTest, AdoptTasksInternsForeignNames) {
+    std::vector<Task> tasks;
+    tasks.push_back(Task{"Literal", false, 1, 0});
+
+    manager.adoptTasks(std::move(tasks), StringPool{});
+
+    EXPECT_EQ(manager.getTask(0)->name, "Literal");
+    EXPECT_TRUE(manager.getNamePool().owns(manager.getTask(0)->name));
+}
+
+TEST_F(TaskManagerTest, RenamingManyTimesCompactsNameArena) {
+    manager.addTask("Keep me");
+    manager.addTask("Rename me");
+
+    const std::string long_suffix(200, 'x');
+    for (int i = 0; i < 2000; ++i) {
+        manager.updateTask(1, "Rename " + std::to_string(i) + long_suffix, 1, 0);
+    }
+
+    EXPECT_EQ(manager.getTask(0)->name, "Keep me");
+    EXPECT_EQ(manager.getTask(1)->name, "Rename 1999" + long_suffix);
+    EXPECT_LT(manager.getNamePool().bytesUsed(), 2000u * long_suffix.size() / 2);
+}
+
+TEST_F(TaskManagerTest, CompletingTaskRecordsTime) {
+    manager.addTask("Task", 1);
+    EXPECT_EQ(manager.getTask(0)->completed_at, 0);
+
+    manager.incrementTaskPomodoros(0);
+    EXPECT_TRUE(manager.getTask(0)->completed);
+    EXPECT_GT(manager.getTask(0)->completed_at, 0);
+}
+
+TEST_F(TaskManagerTest, AdoptTasksStampsLegacyCompletedTasks) {
+    std::vector<Task> tasks;
+    tasks.push_back(Task{"Legacy", true, 1, 1});
+    tasks.push_back(Task{"Open", false, 1, 0});
+
+    manager.adoptTasks(std::move(tasks), StringPool{});
+
+    EXPECT_GT(manager.getTask(0)->completed_at, 0);
+    EXPECT_EQ(manager.getTask(1)->completed_at, 0);
+}
+
+TEST_F(TaskManagerTest, TakeCompletedBeforeRemovesOnlyStaleTasks) {
+    manager.addTask("Stale", 3);
+    manager.addTask("Active", 2);
+    manager.addTask("Fresh", 4);
+    manager.getTask(0)->completed = true;
+    manager.getTask(0)->completed_at = 100;
+    manager.getTask(2)->completed = true;
+    manager.getTask(2)->completed_at = 500;
+
+    const auto taken = manager.takeCompletedBefore(200);
+
+    ASSERT_EQ(taken.size(), 1);
+    EXPECT_EQ(taken[0].name, "Stale");
+    ASSERT_EQ(manager.getTaskCount(), 2);
+    EXPECT_EQ(manager.getTask(0)->name, "Active");
+    EXPECT_EQ(manager.getTargetPomodoros(), 2);
+    EXPECT_FALSE(manager.canUndo());
+}
+
+TEST_F(TaskManagerTest, RestoreTaskAppendsWithAllFields) {
+    manager.restoreTask(Task{"Restored", true, 3, 2, 1234});
+
+    ASSERT_EQ(manager.getTaskCount(), 1);
+    const Task* task = manager.getTask(0);
+    EXPECT_EQ(task->name, "Restored");
+    EXPECT_TRUE(task->completed);
+    EXPECT_EQ(task->estimated_pomodoros, 3);
+    EXPECT_EQ(task->completed_pomodoros, 2);
+    EXPECT_EQ(task->completed_at, 1234);
+    EXPECT_TRUE(manager.getNamePool().owns(task->name));
+}
+
+TEST_F(TaskManagerTest, RestoreTaskIsNotUndoable) {
+    manager.addTask("Existing", 1);
+    manager.restoreTask(Task{"Restored", false, 2, 0, 0});
+
+    // Undo reverts the user's add, not the restore
+    ASSERT_TRUE(manager.undo());
+    ASSERT_EQ(manager.getTaskCount(), 1);
+    EXPECT_EQ(manager.getTask(0)->name, "Restored");
+    EXPECT_FALSE(manager.canUndo());
+}
+
+TEST_F(TaskManagerTest, GetCompletedBeforeLeavesListUntouched) {
+    manager.addTask("Active", 2);
+    manager.addTask("Stale", 1);
+    manager.toggleTaskCompletion(1);
+    manager.getTask(1)->completed_at = 100;
+
+    const auto stale = manager.getCompletedBefore(200);
+
+    ASSERT_EQ(stale.size(), 1);
+    EXPECT_EQ(stale[0].name, "Stale");
+    ASSERT_EQ(manager.getTaskCount(), 2);
+    EXPECT_EQ(manager.getTask(1)->name, "Stale");
+    EXPECT_TRUE(manager.canUndo());
+}
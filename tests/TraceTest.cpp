@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include "core/Trace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace WorkBalance::Core;
+
+namespace {
+[[nodiscard]] std::size_t countOccurrences(const std::string& text, std::string_view needle) {
+    std::size_t count = 0;
+    for (auto pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+TEST(TraceRingTest, KeepsEventsInOrder) {
+    TraceRing ring{8};
+    ring.push("a", 10, 1);
+    ring.push("b", 20, 2);
+
+    const auto events = ring.snapshot();
+    ASSERT_EQ(events.size(), 2U);
+    EXPECT_STREQ(events[0].name, "a");
+    EXPECT_EQ(events[0].start_ns, 10);
+    EXPECT_EQ(events[1].duration_ns, 2);
+}
+
+TEST(TraceRingTest, OverwritesOldestWhenFull) {
+    TraceRing ring{4};
+    for (std::int64_t i = 0; i < 10; ++i) {
+        ring.push("zone", i, 1);
+    }
+
+    const auto events = ring.snapshot();
+    // The slot the next push would overwrite is not reported, so one fewer than the capacity
+    ASSERT_EQ(events.size(), 3U);
+    EXPECT_EQ(events.front().start_ns, 7);
+    EXPECT_EQ(events.back().start_ns, 9);
+}
+
+TEST(TraceRingTest, RoundsCapacityUpToPowerOfTwo) {
+    EXPECT_EQ(TraceRing{5}.capacity(), 8U);
+    EXPECT_EQ(TraceRing{16}.capacity(), 16U);
+}
+
+TEST(TraceRingTest, SnapshotWhileWritingSeesNoTornEvents) {
+    TraceRing ring{64};
+    std::atomic<bool> done{false};
+    constexpr std::int64_t EVENTS = 200'000;
+
+    std::thread writer([&] {
+        for (std::int64_t i = 0; i < EVENTS; ++i) {
+            ring.push("zone", i, i * 2);
+        }
+        done = true;
+    });
+
+    bool consistent = true;
+    while (!done) {
+        const auto events = ring.snapshot();
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            consistent = consistent && events[i].duration_ns == events[i].start_ns * 2;
+            if (i > 0) {
+                consistent = consistent && events[i].start_ns == events[i - 1].start_ns + 1;
+            }
+        }
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+}
+
+TEST(TracerTest, DisabledTracerRecordsNothing) {
+    Tracer tracer;
+    {
+        const TraceZone zone{"ignored", tracer};
+    }
+    EXPECT_EQ(tracer.toChromeTraceJson().find("ignored"), std::string::npos);
+}
+
+TEST(TracerTest, ExportsZonesAsCompleteEvents) {
+    Tracer tracer;
+    tracer.setEnabled(true);
+    tracer.setThreadName("main");
+    {
+        const TraceZone outer{"frame", tracer};
+        const TraceZone inner{"glfwPollEvents", tracer};
+    }
+
+    const std::string json = tracer.toChromeTraceJson();
+    EXPECT_EQ(json.rfind(R"({"displayTimeUnit":"ms","traceEvents":[)", 0), 0U);
+    EXPECT_NE(json.find(R"("name":"thread_name","args":{"name":"main"})"), std::string::npos);
+    EXPECT_NE(json.find(R"("ph":"X","pid":1,"tid":1,"name":"frame")"), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"glfwPollEvents")"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+}
+
+TEST(TracerTest, RecordsTimesRelativeToTracerStart) {
+    Tracer tracer;
+    tracer.setEnabled(true);
+    const auto start = Tracer::Clock::now() + std::chrono::milliseconds{2};
+    tracer.record("zone", start, start + std::chrono::microseconds{1500});
+
+    const std::string json = tracer.toChromeTraceJson();
+    EXPECT_NE(json.find(R"("dur":1500.000)"), std::string::npos);
+}
+
+TEST(TracerTest, EachThreadGetsItsOwnTrack) {
+    Tracer tracer;
+    tracer.setEnabled(true);
+    tracer.record("main_zone", Tracer::Clock::now(), Tracer::Clock::now());
+    std::thread worker([&tracer] {
+        tracer.setThreadName("worker");
+        tracer.record("worker_zone", Tracer::Clock::now(), Tracer::Clock::now());
+    });
+    worker.join();
+
+    const std::string json = tracer.toChromeTraceJson();
+    EXPECT_EQ(countOccurrences(json, R"("name":"thread_name")"), 2U);
+    EXPECT_NE(json.find(R"("tid":1,"name":"main_zone")"), std::string::npos);
+    EXPECT_NE(json.find(R"("tid":2,"name":"worker_zone")"), std::string::npos);
+    EXPECT_NE(json.find(R"("args":{"name":"worker"})"), std::string::npos);
+    EXPECT_NE(json.find(R"("args":{"name":"thread 1"})"), std::string::npos);
+}
+
+TEST(TracerTest, ClearDropsEarlierEvents) {
+    Tracer tracer;
+    tracer.setEnabled(true);
+    tracer.record("before", Tracer::Clock::now(), Tracer::Clock::now());
+    tracer.clear();
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    tracer.record("after", Tracer::Clock::now(), Tracer::Clock::now());
+
+    const std::string json = tracer.toChromeTraceJson();
+    EXPECT_EQ(json.find("before"), std::string::npos);
+    EXPECT_NE(json.find("after"), std::string::npos);
+}
+
+TEST(TracerTest, EscapesNames) {
+    Tracer tracer;
+    tracer.setEnabled(true);
+    tracer.setThreadName("say \"hi\"\\");
+    const std::string json = tracer.toChromeTraceJson();
+    EXPECT_NE(json.find(R"("name":"say \"hi\"\\")"), std::string::npos);
+}
+
+TEST(TracerTest, TracersDoNotShareRings) {
+    Tracer first;
+    Tracer second;
+    first.setEnabled(true);
+    second.setEnabled(true);
+    first.record("first_zone", Tracer::Clock::now(), Tracer::Clock::now());
+    second.record("second_zone", Tracer::Clock::now(), Tracer::Clock::now());
+    first.record("first_again", Tracer::Clock::now(), Tracer::Clock::now());
+
+    const std::string json = first.toChromeTraceJson();
+    EXPECT_NE(json.find("first_again"), std::string::npos);
+    EXPECT_EQ(json.find("second_zone"), std::string::npos);
+    EXPECT_EQ(countOccurrences(json, R"("name":"thread_name")"), 1U);
+}
+
+TEST(TracerTest, WritesChromeTraceFile) {
+    const auto path = std::filesystem::temp_directory_path() / "workbalance_trace_test" / "trace.json";
+    std::filesystem::remove_all(path.parent_path());
+    Tracer tracer;
+    tracer.setEnabled(true);
+    tracer.record("zone", Tracer::Clock::now(), Tracer::Clock::now());
+
+    ASSERT_TRUE(tracer.writeChromeTrace(path).has_value());
+
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), tracer.toChromeTraceJson());
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+    std::filesystem::remove_all(path.parent_path());
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <controllers/WellnessController.h>
+#include <core/ITimeSource.h>
+#include <core/WellnessTimer.h>
+
+#include <memory>
+#include <vector>
+
+using namespace WorkBalance::Controllers;
+using namespace WorkBalance::Core;
+using namespace std::chrono_literals;
+
+class WellnessControllerTest : public ::testing::Test {
+  protected:
+    static constexpr int INTERVAL_SECONDS = 60;
+    static constexpr int BREAK_SECONDS = 10;
+
+    std::shared_ptr<MockTimeSource> clock = std::make_shared<MockTimeSource>();
+    WellnessController controller{
+        std::make_unique<WellnessTimer>(WellnessType::Water, INTERVAL_SECONDS, 0, clock),
+        std::make_unique<WellnessTimer>(WellnessType::Standup, INTERVAL_SECONDS, BREAK_SECONDS, clock),
+        std::make_unique<WellnessTimer>(WellnessType::EyeStrain, INTERVAL_SECONDS, BREAK_SECONDS, clock)};
+    std::vector<WellnessType> completed;
+
+    void SetUp() override {
+        [[maybe_unused]] const auto subscription =
+            controller.onTimerComplete.subscribe([this](WellnessType type) { completed.push_back(type); });
+    }
+
+    void advance(std::chrono::seconds duration) {
+        clock->advance(duration);
+        controller.update();
+    }
+};
+
+TEST_F(WellnessControllerTest, FinishedStandupIntervalWaitsForUser) {
+    WellnessTimer& standup = *controller.getStandupTimer();
+    standup.start();
+
+    advance(std::chrono::seconds{INTERVAL_SECONDS});
+    ASSERT_EQ(completed, std::vector{WellnessType::Standup});
+    EXPECT_TRUE(standup.isReminderActive());
+    EXPECT_FALSE(standup.isRunning());
+
+    // Restarting at 0 would fire the reminder again on the next tick
+    advance(1s);
+    advance(1s);
+    EXPECT_EQ(completed.size(), 1U);
+    EXPECT_TRUE(standup.isReminderActive());
+}
+
+TEST_F(WellnessControllerTest, FinishedEyeCareIntervalWaitsForUser) {
+    WellnessTimer& eye_care = *controller.getEyeCareTimer();
+    eye_care.start();
+
+    advance(std::chrono::seconds{INTERVAL_SECONDS});
+    advance(1s);
+    EXPECT_EQ(completed, std::vector{WellnessType::EyeStrain});
+    EXPECT_FALSE(eye_care.isRunning());
+}
+
+TEST_F(WellnessControllerTest, IntervalRestartsAfterBreak) {
+    WellnessTimer& standup = *controller.getStandupTimer();
+    standup.start();
+    advance(std::chrono::seconds{INTERVAL_SECONDS});
+    controller.startStandupBreak();
+
+    advance(std::chrono::seconds{BREAK_SECONDS});
+    EXPECT_EQ(completed.size(), 2U);
+    EXPECT_FALSE(standup.isInBreak());
+    EXPECT_TRUE(standup.isRunning());
+    EXPECT_EQ(standup.getRemainingTime(), INTERVAL_SECONDS);
+    EXPECT_EQ(standup.getCompletedCount(), 1);
+}
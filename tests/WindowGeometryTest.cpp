@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include "system/WindowGeometry.h"
+
+using WorkBalance::System::WindowGeometry;
+
+TEST(WindowGeometryTest, CursorScreenPositionAddsTheOrigin) {
+    WindowGeometry geometry;
+    geometry.x = 100;
+    geometry.y = 50;
+    geometry.cursor_x = 10.5;
+    geometry.cursor_y = 20.0;
+
+    const auto [x, y] = geometry.cursorScreenPosition();
+    EXPECT_DOUBLE_EQ(x, 110.5);
+    EXPECT_DOUBLE_EQ(y, 70.0);
+}
+
+TEST(WindowGeometryTest, MoveKeepsTheCursorWhereItIsOnScreen) {
+    WindowGeometry geometry;
+    geometry.x = 100;
+    geometry.y = 50;
+    geometry.cursor_x = 10.0;
+    geometry.cursor_y = 20.0;
+
+    // A drag step moves the window under a pointer that sends no motion event
+    geometry.moveTo(130, 40);
+
+    EXPECT_EQ(geometry.x, 130);
+    EXPECT_EQ(geometry.y, 40);
+    const auto [x, y] = geometry.cursorScreenPosition();
+    EXPECT_DOUBLE_EQ(x, 110.0);
+    EXPECT_DOUBLE_EQ(y, 70.0);
+    EXPECT_DOUBLE_EQ(geometry.cursor_x, -20.0);
+    EXPECT_DOUBLE_EQ(geometry.cursor_y, 30.0);
+}
+
+TEST(WindowGeometryTest, RepeatedMovesDoNotAccumulateDrift) {
+    WindowGeometry geometry;
+    geometry.cursor_x = 5.0;
+    geometry.cursor_y = 5.0;
+
+    for (int step = 1; step <= 10; ++step) {
+        geometry.moveTo(step * 7, step * -3);
+    }
+
+    const auto [x, y] = geometry.cursorScreenPosition();
+    EXPECT_DOUBLE_EQ(x, 5.0);
+    EXPECT_DOUBLE_EQ(y, 5.0);
+}
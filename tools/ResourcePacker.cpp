@@ -0,0 +1,106 @@
+// Build step: packs the application's assets into the compressed blob that is linked into
+// the executable. Usage: WorkBalanceResourcePacker <output> [--icon] <name>=<file>...
+// An entry preceded by --icon is a PNG that is decoded and scaled into a Core::IconSet here,
+// so the application never decodes images at startup.
+#include <core/IconSet.h>
+#include <core/ResourcePack.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#include "assets/icons/stb_image.h"
+
+#include <array>
+
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+constexpr int COMPRESSION_LEVEL = 19;
+
+// Small icon sizes Windows and GLFW ask for at 100-200% scaling; the source size is always kept
+constexpr std::array ICON_SIZES{16, 20, 24, 32, 40, 48};
+
+std::vector<std::uint8_t> readFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        throw std::runtime_error("cannot open " + path.string());
+    }
+
+    std::vector<std::uint8_t> contents(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(contents.data()), static_cast<std::streamsize>(contents.size()))) {
+        throw std::runtime_error("cannot read " + path.string());
+    }
+    return contents;
+}
+
+std::vector<std::uint8_t> convertIcon(const std::filesystem::path& path) {
+    const auto png = readFile(path);
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    const std::unique_ptr<stbi_uc, decltype(&stbi_image_free)> pixels(
+        stbi_load_from_memory(png.data(), static_cast<int>(png.size()), &width, &height, &channels, 4),
+        &stbi_image_free);
+    if (!pixels) {
+        throw std::runtime_error("cannot decode " + path.string() + ": " + stbi_failure_reason());
+    }
+
+    const auto size = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+    const std::span<const std::uint8_t> rgba{pixels.get(), size};
+    return WorkBalance::Core::IconSet::build(rgba, width, height, ICON_SIZES);
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    using WorkBalance::Core::ResourcePack;
+
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <output> [--icon] <name>=<file>...\n";
+        return 2;
+    }
+
+    try {
+        std::vector<std::vector<std::uint8_t>> contents;
+        std::vector<ResourcePack::Source> sources;
+        contents.reserve(static_cast<size_t>(argc));
+        for (int i = 2; i < argc; ++i) {
+            const bool icon = std::string_view{argv[i]} == "--icon";
+            if (icon && ++i == argc) {
+                std::cerr << "Expected <name>=<file> after --icon\n";
+                return 2;
+            }
+
+            const std::string_view arg{argv[i]};
+            const auto separator = arg.find('=');
+            if (separator == std::string_view::npos || separator == 0) {
+                std::cerr << "Expected <name>=<file>, got: " << arg << '\n';
+                return 2;
+            }
+
+            const std::filesystem::path file{arg.substr(separator + 1)};
+            contents.push_back(icon ? convertIcon(file) : readFile(file));
+            sources.push_back({std::string{arg.substr(0, separator)}, contents.back()});
+        }
+
+        const auto pack = ResourcePack::build(sources, COMPRESSION_LEVEL);
+        std::ofstream output(argv[1], std::ios::binary | std::ios::trunc);
+        output.write(reinterpret_cast<const char*>(pack.data()), static_cast<std::streamsize>(pack.size()));
+        if (!output.good()) {
+            std::cerr << "Failed to write " << argv[1] << '\n';
+            return 1;
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 1;
+    }
+}